@@ -0,0 +1,1328 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * Codec Benchmarks
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Timing loops over the codecs, fed with the cunit sample data, the
+ * RemoteFX capture from server/X11 and a few generated images. Every
+ * benchmark runs for at least --time seconds of CPU time and the results
+ * are written as a single JSON document, so that runs of different builds
+ * can be compared by a script.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <freerdp/freerdp.h>
+#include <freerdp/constants.h>
+#include <freerdp/utils/cpu.h>
+#include <freerdp/utils/memory.h>
+#include <freerdp/utils/stream.h>
+#include <freerdp/utils/pcap.h>
+#include <freerdp/utils/stopwatch.h>
+#include <freerdp/codec/rfx.h>
+#include <freerdp/codec/nsc.h>
+#include <freerdp/codec/h264.h>
+#include <freerdp/codec/jpeg.h>
+#include <freerdp/codec/bitmap.h>
+#include <freerdp/codec/color.h>
+
+#include "rdp.h"
+#include "mppc.h"
+#include "surface.h"
+
+#include "rfx_types.h"
+#include "rfx_rlgr.h"
+#include "rfx_differential.h"
+#include "rfx_quantization.h"
+#include "rfx_decode.h"
+#include "rfx_encode.h"
+
+#include "test_librfx_data.h"
+#include "test_bitmap_data.h"
+#include "test_mppc_data.h"
+
+#ifndef FREERDP_BENCH_PCAP
+#define FREERDP_BENCH_PCAP "rfx_test.pcap"
+#endif
+
+#define BENCH_MAX_STAGES	8
+
+typedef void (*bench_func)(void* arg);
+
+struct _BENCH_STAGE
+{
+	const char* name;
+	double seconds; /* per iteration */
+};
+typedef struct _BENCH_STAGE BENCH_STAGE;
+
+struct _BENCH_RESULT
+{
+	const char* name;
+	const char* corpus;
+	const char* skipped;
+	int iterations;
+	double seconds;
+	int frames; /* per iteration */
+	int bytes; /* uncompressed bytes per iteration */
+	int num_stages;
+	BENCH_STAGE stages[BENCH_MAX_STAGES];
+};
+typedef struct _BENCH_RESULT BENCH_RESULT;
+
+static double bench_min_time = 0.5;
+static uint32 bench_cpu_opt;
+static const char* bench_filter = NULL;
+static const char* bench_pcap = FREERDP_BENCH_PCAP;
+
+static BENCH_RESULT* bench_results = NULL;
+static int bench_num_results = 0;
+
+static boolean bench_selected(const char* name)
+{
+	return (bench_filter == NULL || strstr(name, bench_filter) != NULL);
+}
+
+/**
+ * Call func until at least min_time seconds of CPU time have been spent,
+ * doubling the batch size while the batches are short compared to the clock.
+ */
+static void bench_measure(bench_func func, void* arg, double min_time, int* iterations, double* seconds)
+{
+	int i;
+	int batch = 1;
+	int count = 0;
+	STOPWATCH* sw;
+
+	sw = stopwatch_create();
+
+	func(arg); /* warm up caches and lazily allocated buffers */
+
+	while (1)
+	{
+		stopwatch_start(sw);
+		for (i = 0; i < batch; i++)
+			func(arg);
+		stopwatch_stop(sw);
+
+		count += batch;
+
+		if (stopwatch_get_elapsed_time_in_seconds(sw) >= min_time)
+			break;
+
+		if (stopwatch_get_elapsed_time_in_seconds(sw) < min_time / 16)
+			batch *= 2;
+	}
+
+	*iterations = count;
+	*seconds = stopwatch_get_elapsed_time_in_seconds(sw);
+
+	stopwatch_free(sw);
+}
+
+static BENCH_RESULT* bench_result_new(const char* name, const char* corpus, int frames, int bytes)
+{
+	BENCH_RESULT* result;
+
+	bench_results = xrenew(BENCH_RESULT, bench_results, bench_num_results + 1);
+	result = &bench_results[bench_num_results++];
+	memset(result, 0, sizeof(BENCH_RESULT));
+
+	result->name = name;
+	result->corpus = corpus;
+	result->frames = frames;
+	result->bytes = bytes;
+
+	return result;
+}
+
+static void bench_run(const char* name, const char* corpus, int frames, int bytes, bench_func func, void* arg)
+{
+	BENCH_RESULT* result;
+
+	if (!bench_selected(name))
+		return;
+
+	result = bench_result_new(name, corpus, frames, bytes);
+	bench_measure(func, arg, bench_min_time, &result->iterations, &result->seconds);
+}
+
+static void bench_skip(const char* name, const char* reason)
+{
+	if (!bench_selected(name))
+		return;
+
+	bench_result_new(name, NULL, 0, 0)->skipped = reason;
+}
+
+/**
+ * Stage functions restore their input before running, so that every call
+ * sees the same data. The cost of that copy is measured once as baseline
+ * and subtracted.
+ */
+static void bench_stage(BENCH_RESULT* result, const char* name, bench_func func, void* arg, double baseline)
+{
+	int iterations;
+	double seconds;
+	BENCH_STAGE* stage;
+
+	if (result->num_stages >= BENCH_MAX_STAGES)
+		return;
+
+	bench_measure(func, arg, bench_min_time / 4, &iterations, &seconds);
+
+	stage = &result->stages[result->num_stages++];
+	stage->name = name;
+	stage->seconds = MAX(seconds / iterations - baseline, 0.0);
+}
+
+static double bench_stage_baseline(bench_func func, void* arg)
+{
+	int iterations;
+	double seconds;
+
+	bench_measure(func, arg, bench_min_time / 4, &iterations, &seconds);
+
+	return seconds / iterations;
+}
+
+/* RemoteFX tile pipeline, on the [MS-RDPRFX] 4.2.3 sample tile */
+
+enum
+{
+	TILE_RLGR,
+	TILE_DIFFERENTIAL,
+	TILE_QUANTIZATION,
+	TILE_DWT,
+	TILE_YCBCR,
+	TILE_STATES
+};
+
+struct _BENCH_TILE
+{
+	RFX_CONTEXT* context;
+	RFX_SCRATCH* scratch;
+	uint8 data[4096 * 3];
+	int sizes[3];
+	uint8 encoded[4096 * 3];
+	uint8 rgb[64 * 64 * 4];
+	STREAM* s;
+	sint16* planes[3];
+	sint16 states[TILE_STATES][3][4096]; /* pipeline input of each stage */
+};
+typedef struct _BENCH_TILE BENCH_TILE;
+
+static void bench_tile_restore(BENCH_TILE* tile, int state)
+{
+	int i;
+
+	for (i = 0; i < 3; i++)
+		memcpy(tile->planes[i], tile->states[state][i], 4096 * sizeof(sint16));
+}
+
+static void bench_tile_baseline(void* arg)
+{
+	bench_tile_restore((BENCH_TILE*) arg, 0);
+}
+
+static void bench_tile_decode(void* arg)
+{
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	rfx_decode_tile(tile->context, tile->scratch, tile->data,
+		tile->sizes[0], test_quantization_values,
+		tile->sizes[1], test_quantization_values,
+		tile->sizes[2], test_quantization_values, tile->rgb);
+}
+
+static void bench_tile_rlgr_decode(void* arg)
+{
+	int i;
+	const uint8* data;
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_RLGR);
+
+	for (i = 0, data = tile->data; i < 3; data += tile->sizes[i++])
+		rfx_rlgr_decode(RLGR3, data, tile->sizes[i], tile->planes[i], 4096);
+}
+
+static void bench_tile_differential_decode(void* arg)
+{
+	int i;
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_DIFFERENTIAL);
+
+	for (i = 0; i < 3; i++)
+		rfx_differential_decode(tile->planes[i] + 4032, 64);
+}
+
+static void bench_tile_quantization_decode(void* arg)
+{
+	int i;
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_QUANTIZATION);
+
+	for (i = 0; i < 3; i++)
+		tile->context->quantization_decode(tile->planes[i], test_quantization_values);
+}
+
+static void bench_tile_dwt_decode(void* arg)
+{
+	int i;
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_DWT);
+
+	for (i = 0; i < 3; i++)
+		tile->context->dwt_2d_decode(tile->planes[i], tile->scratch->dwt_buffer);
+}
+
+static void bench_tile_ycbcr_to_rgb(void* arg)
+{
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_YCBCR);
+	tile->context->decode_ycbcr_to_rgb(tile->planes[0], tile->planes[1], tile->planes[2]);
+}
+
+static void bench_tile_encode(void* arg)
+{
+	int sizes[3];
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	stream_set_pos(tile->s, 0);
+	rfx_encode_tile(tile->context, tile->scratch, tile->rgb, 64, 64, 64 * 4,
+		test_quantization_values, test_quantization_values, test_quantization_values,
+		tile->s, &sizes[0], &sizes[1], &sizes[2]);
+}
+
+static void bench_tile_rgb_to_ycbcr(void* arg)
+{
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	tile->context->encode_format_rgb_to_ycbcr(tile->rgb, 64, 64, 64 * 4, RFX_PIXEL_FORMAT_BGRA,
+		tile->planes[0], tile->planes[1], tile->planes[2]);
+}
+
+static void bench_tile_dwt_encode(void* arg)
+{
+	int i;
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_YCBCR);
+
+	for (i = 0; i < 3; i++)
+		tile->context->dwt_2d_encode(tile->planes[i], tile->scratch->dwt_buffer);
+}
+
+static void bench_tile_quantization_encode(void* arg)
+{
+	int i;
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_DWT);
+
+	for (i = 0; i < 3; i++)
+		tile->context->quantization_encode(tile->planes[i], test_quantization_values);
+}
+
+static void bench_tile_differential_encode(void* arg)
+{
+	int i;
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_QUANTIZATION);
+
+	for (i = 0; i < 3; i++)
+		rfx_differential_encode(tile->planes[i] + 4032, 64);
+}
+
+static void bench_tile_rlgr_encode(void* arg)
+{
+	int i;
+	BENCH_TILE* tile = (BENCH_TILE*) arg;
+
+	bench_tile_restore(tile, TILE_DIFFERENTIAL);
+
+	for (i = 0; i < 3; i++)
+		rfx_rlgr_encode(RLGR3, tile->planes[i], 4096, tile->encoded + i * 4096, 4096);
+}
+
+static void bench_tile_snapshot(BENCH_TILE* tile, int state)
+{
+	int i;
+
+	for (i = 0; i < 3; i++)
+		memcpy(tile->states[state][i], tile->planes[i], 4096 * sizeof(sint16));
+}
+
+static void bench_rfx_tile(void)
+{
+	int i;
+	int offset;
+	double baseline;
+	BENCH_TILE* tile;
+	BENCH_RESULT* result;
+	const uint8* data[3] = { y_data, cb_data, cr_data };
+	int sizes[3] = { sizeof(y_data), sizeof(cb_data), sizeof(cr_data) };
+	const char* corpus = "cunit/test_librfx_data.h";
+
+	if (!bench_selected("rfx_tile_decode") && !bench_selected("rfx_tile_encode"))
+		return;
+
+	tile = xnew(BENCH_TILE);
+	tile->context = rfx_context_new();
+	rfx_context_set_cpu_opt(tile->context, bench_cpu_opt);
+	rfx_context_set_pixel_format(tile->context, RFX_PIXEL_FORMAT_BGRA);
+	tile->scratch = &tile->context->priv->scratch;
+	tile->planes[0] = tile->scratch->y_r_buffer;
+	tile->planes[1] = tile->scratch->cb_g_buffer;
+	tile->planes[2] = tile->scratch->cr_b_buffer;
+	tile->s = stream_new(4096 * 3);
+
+	for (i = 0, offset = 0; i < 3; offset += sizes[i++])
+	{
+		memcpy(tile->data + offset, data[i], sizes[i]);
+		tile->sizes[i] = sizes[i];
+	}
+
+	/* run the decoder stage by stage once to record the input of every stage */
+	bench_tile_snapshot(tile, TILE_RLGR);
+	bench_tile_rlgr_decode(tile);
+	bench_tile_snapshot(tile, TILE_DIFFERENTIAL);
+	bench_tile_differential_decode(tile);
+	bench_tile_snapshot(tile, TILE_QUANTIZATION);
+	bench_tile_quantization_decode(tile);
+	bench_tile_snapshot(tile, TILE_DWT);
+	bench_tile_dwt_decode(tile);
+	bench_tile_snapshot(tile, TILE_YCBCR);
+
+	bench_tile_decode(tile);
+	baseline = bench_stage_baseline(bench_tile_baseline, tile);
+
+	if (bench_selected("rfx_tile_decode"))
+	{
+		result = bench_result_new("rfx_tile_decode", corpus, 1, 64 * 64 * 4);
+		bench_measure(bench_tile_decode, tile, bench_min_time, &result->iterations, &result->seconds);
+		bench_stage(result, "rlgr_decode", bench_tile_rlgr_decode, tile, baseline);
+		bench_stage(result, "differential_decode", bench_tile_differential_decode, tile, baseline);
+		bench_stage(result, "quantization_decode", bench_tile_quantization_decode, tile, baseline);
+		bench_stage(result, "dwt_2d_decode", bench_tile_dwt_decode, tile, baseline);
+		bench_stage(result, "ycbcr_to_rgb", bench_tile_ycbcr_to_rgb, tile, baseline);
+	}
+
+	/* the encoder stages run on the output of the decoder, in reverse */
+	bench_tile_decode(tile);
+	bench_tile_rgb_to_ycbcr(tile);
+	bench_tile_snapshot(tile, TILE_YCBCR);
+	bench_tile_dwt_encode(tile);
+	bench_tile_snapshot(tile, TILE_DWT);
+	bench_tile_quantization_encode(tile);
+	bench_tile_snapshot(tile, TILE_QUANTIZATION);
+	bench_tile_differential_encode(tile);
+	bench_tile_snapshot(tile, TILE_DIFFERENTIAL);
+
+	if (bench_selected("rfx_tile_encode"))
+	{
+		result = bench_result_new("rfx_tile_encode", corpus, 1, 64 * 64 * 4);
+		bench_measure(bench_tile_encode, tile, bench_min_time, &result->iterations, &result->seconds);
+		bench_stage(result, "rgb_to_ycbcr", bench_tile_rgb_to_ycbcr, tile, 0.0);
+		bench_stage(result, "dwt_2d_encode", bench_tile_dwt_encode, tile, baseline);
+		bench_stage(result, "quantization_encode", bench_tile_quantization_encode, tile, baseline);
+		bench_stage(result, "differential_encode", bench_tile_differential_encode, tile, baseline);
+		bench_stage(result, "rlgr_encode", bench_tile_rlgr_encode, tile, baseline);
+	}
+
+	stream_free(tile->s);
+	rfx_context_free(tile->context);
+	xfree(tile);
+}
+
+/* RemoteFX messages from the server/X11 capture */
+
+struct _BENCH_PCAP
+{
+	RFX_CONTEXT* context;
+	int num_messages;
+	uint8** messages;
+	uint32* lengths;
+	uint16* lefts;
+	uint16* tops;
+	int frames;
+	int width;
+	int height;
+	int bytes;
+	uint8* surface;
+	STREAM* s;
+	NSC_CONTEXT* nsc;
+};
+typedef struct _BENCH_PCAP BENCH_PCAP;
+
+/**
+ * Keep the RemoteFX payloads of the surface commands of the capture.
+ * See [MS-RDPBCGR] 2.2.9.2 for the command layout.
+ */
+static boolean bench_pcap_load(BENCH_PCAP* pcap, char* name)
+{
+	STREAM* s;
+	rdpPcap* file;
+	pcap_record record;
+	uint16 cmdType;
+	uint16 frameAction;
+	uint16 left, top, right, bottom;
+	uint8 codecID;
+	uint32 length;
+
+	file = pcap_open(name, false);
+
+	if (file == NULL)
+		return false;
+
+	s = stream_new(0);
+
+	while (pcap_has_next_record(file))
+	{
+		pcap_get_next_record_header(file, &record);
+		record.data = xmalloc(record.length);
+		pcap_get_next_record_content(file, &record);
+		stream_attach(s, record.data, record.length);
+
+		stream_read_uint16(s, cmdType);
+
+		if (cmdType == CMDTYPE_FRAME_MARKER)
+		{
+			stream_read_uint16(s, frameAction);
+			if (frameAction == SURFACECMD_FRAMEACTION_END)
+				pcap->frames++;
+		}
+		else if (cmdType == CMDTYPE_SET_SURFACE_BITS || cmdType == CMDTYPE_STREAM_SURFACE_BITS)
+		{
+			stream_read_uint16(s, left);
+			stream_read_uint16(s, top);
+			stream_read_uint16(s, right);
+			stream_read_uint16(s, bottom);
+			stream_seek(s, 3); /* bpp, reserved1, reserved2 */
+			stream_read_uint8(s, codecID);
+			stream_seek(s, 4); /* width, height */
+			stream_read_uint32(s, length);
+
+			if (codecID == CODEC_ID_REMOTEFX && stream_get_left(s) >= length)
+			{
+				pcap->messages = xrenew(uint8*, pcap->messages, pcap->num_messages + 1);
+				pcap->lengths = xrenew(uint32, pcap->lengths, pcap->num_messages + 1);
+				pcap->lefts = xrenew(uint16, pcap->lefts, pcap->num_messages + 1);
+				pcap->tops = xrenew(uint16, pcap->tops, pcap->num_messages + 1);
+
+				pcap->messages[pcap->num_messages] = xmalloc(length);
+				memcpy(pcap->messages[pcap->num_messages], stream_get_tail(s), length);
+				pcap->lengths[pcap->num_messages] = length;
+				pcap->lefts[pcap->num_messages] = left;
+				pcap->tops[pcap->num_messages] = top;
+				pcap->num_messages++;
+
+				pcap->width = MAX(pcap->width, right);
+				pcap->height = MAX(pcap->height, bottom);
+			}
+		}
+
+		stream_detach(s);
+		xfree(record.data);
+	}
+
+	stream_free(s);
+	pcap_close(file);
+
+	if (pcap->frames == 0)
+		pcap->frames = pcap->num_messages;
+
+	return (pcap->num_messages > 0);
+}
+
+static void bench_pcap_decode(void* arg)
+{
+	int i;
+	RFX_MESSAGE* message;
+	BENCH_PCAP* pcap = (BENCH_PCAP*) arg;
+
+	for (i = 0; i < pcap->num_messages; i++)
+	{
+		message = rfx_process_message(pcap->context, pcap->messages[i], pcap->lengths[i]);
+		rfx_message_free(pcap->context, message);
+	}
+}
+
+static void bench_pcap_decode_surface(void* arg)
+{
+	int i;
+	RFX_MESSAGE* message;
+	BENCH_PCAP* pcap = (BENCH_PCAP*) arg;
+
+	for (i = 0; i < pcap->num_messages; i++)
+	{
+		message = rfx_process_message_to_surface(pcap->context, pcap->messages[i], pcap->lengths[i],
+			pcap->surface, pcap->width * 4, RFX_PIXEL_FORMAT_BGRA, pcap->width, pcap->height,
+			pcap->lefts[i], pcap->tops[i]);
+		rfx_message_free(pcap->context, message);
+	}
+}
+
+static void bench_pcap_encode(void* arg)
+{
+	RFX_RECT rect;
+	BENCH_PCAP* pcap = (BENCH_PCAP*) arg;
+
+	rect.x = 0;
+	rect.y = 0;
+	rect.width = pcap->width;
+	rect.height = pcap->height;
+
+	stream_set_pos(pcap->s, 0);
+	rfx_compose_message(pcap->context, pcap->s, &rect, 1, pcap->surface,
+		pcap->width, pcap->height, pcap->width * 4);
+}
+
+static void bench_pcap_nsc_encode(void* arg)
+{
+	BENCH_PCAP* pcap = (BENCH_PCAP*) arg;
+
+	stream_set_pos(pcap->s, 0);
+	nsc_compose_message(pcap->nsc, pcap->s, pcap->surface,
+		pcap->width, pcap->height, pcap->width * 4);
+}
+
+static void bench_rfx_pcap(void)
+{
+	int i;
+	RFX_MESSAGE* message;
+	BENCH_PCAP* pcap;
+
+	if (!bench_selected("rfx_decode") && !bench_selected("rfx_decode_surface") &&
+			!bench_selected("rfx_encode") && !bench_selected("nsc_encode"))
+		return;
+
+	pcap = xnew(BENCH_PCAP);
+
+	if (!bench_pcap_load(pcap, (char*) bench_pcap))
+	{
+		fprintf(stderr, "freerdp-bench: failed to load RemoteFX messages from %s\n", bench_pcap);
+		bench_skip("rfx_decode", "capture not found");
+		bench_skip("rfx_decode_surface", "capture not found");
+		bench_skip("rfx_encode", "capture not found");
+		bench_skip("nsc_encode", "capture not found");
+		xfree(pcap);
+		return;
+	}
+
+	pcap->context = rfx_context_new();
+	rfx_context_set_cpu_opt(pcap->context, bench_cpu_opt);
+	rfx_context_set_pixel_format(pcap->context, RFX_PIXEL_FORMAT_BGRA);
+	pcap->surface = (uint8*) xzalloc(pcap->width * pcap->height * 4);
+
+	/* decoded size, as the number of tiles times the tile size */
+	for (i = 0; i < pcap->num_messages; i++)
+	{
+		message = rfx_process_message(pcap->context, pcap->messages[i], pcap->lengths[i]);
+		pcap->bytes += message->num_tiles * 64 * 64 * 4;
+		rfx_message_free(pcap->context, message);
+	}
+
+	bench_run("rfx_decode", bench_pcap, pcap->frames, pcap->bytes, bench_pcap_decode, pcap);
+	bench_run("rfx_decode_surface", bench_pcap, pcap->frames, pcap->bytes, bench_pcap_decode_surface, pcap);
+
+	/* the encoders compress the last decoded frame of the capture */
+	if (bench_selected("rfx_encode") || bench_selected("nsc_encode"))
+	{
+		bench_pcap_decode_surface(pcap);
+
+		rfx_context_free(pcap->context);
+		pcap->context = rfx_context_new();
+		rfx_context_set_cpu_opt(pcap->context, bench_cpu_opt);
+		rfx_context_set_pixel_format(pcap->context, RFX_PIXEL_FORMAT_BGRA);
+		pcap->context->mode = RLGR3;
+		pcap->context->width = pcap->width;
+		pcap->context->height = pcap->height;
+		pcap->s = stream_new(pcap->width * pcap->height * 4);
+
+		bench_run("rfx_encode", bench_pcap, 1, pcap->width * pcap->height * 4, bench_pcap_encode, pcap);
+
+		pcap->nsc = nsc_context_new();
+		nsc_context_set_cpu_opt(pcap->nsc, bench_cpu_opt);
+
+		bench_run("nsc_encode", bench_pcap, 1, pcap->width * pcap->height * 4, bench_pcap_nsc_encode, pcap);
+
+		nsc_context_free(pcap->nsc);
+		stream_free(pcap->s);
+	}
+
+	rfx_context_free(pcap->context);
+
+	for (i = 0; i < pcap->num_messages; i++)
+		xfree(pcap->messages[i]);
+
+	xfree(pcap->messages);
+	xfree(pcap->lengths);
+	xfree(pcap->lefts);
+	xfree(pcap->tops);
+	xfree(pcap->surface);
+	xfree(pcap);
+}
+
+/* NSCodec, on generated bitmap streams */
+
+struct _BENCH_NSC
+{
+	NSC_CONTEXT* context;
+	int width;
+	int height;
+	uint8* data;
+	uint32 length;
+};
+typedef struct _BENCH_NSC BENCH_NSC;
+
+static void bench_nsc_decode(void* arg)
+{
+	BENCH_NSC* nsc = (BENCH_NSC*) arg;
+
+	nsc->context->width = nsc->width;
+	nsc->context->height = nsc->height;
+	nsc_process_message(nsc->context, nsc->data, nsc->length);
+}
+
+/**
+ * Build an NSCODEC_BITMAP_STREAM ([MS-RDPNSC] 2.2.1) without chroma
+ * subsampling. Raw planes store every sample, run length encoded planes
+ * hold a single run of value followed by the four raw trailing bytes.
+ */
+static void bench_nsc_generate(BENCH_NSC* nsc, boolean rle)
+{
+	int i;
+	int x, y;
+	STREAM* s;
+	uint32 size;
+
+	size = nsc->width * nsc->height;
+	s = stream_new(20 + size * 4);
+
+	for (i = 0; i < 4; i++)
+		stream_write_uint32(s, rle ? 11 : size);
+
+	stream_write_uint8(s, 3); /* colorLossLevel */
+	stream_write_uint8(s, 0); /* ChromaSubSamplingLevel */
+	stream_write_uint16(s, 0); /* Reserved */
+
+	for (i = 0; i < 4; i++)
+	{
+		if (rle)
+		{
+			stream_write_uint8(s, 0x40 + i);
+			stream_write_uint8(s, 0x40 + i);
+			stream_write_uint8(s, 0xFF);
+			stream_write_uint32(s, size - 4);
+			stream_write_uint32(s, 0x40404040 + 0x01010101 * i);
+		}
+		else
+		{
+			for (y = 0; y < nsc->height; y++)
+			{
+				for (x = 0; x < nsc->width; x++)
+					stream_write_uint8(s, (uint8) (x * (i + 1) + y * 3 + ((x * y) >> 4)));
+			}
+		}
+	}
+
+	nsc->length = stream_get_length(s);
+	nsc->data = s->data;
+	stream_detach(s);
+	stream_free(s);
+}
+
+static void bench_nsc(void)
+{
+	BENCH_NSC nsc;
+
+	if (!bench_selected("nsc_decode_raw") && !bench_selected("nsc_decode_rle"))
+		return;
+
+	nsc.context = nsc_context_new();
+	nsc_context_set_cpu_opt(nsc.context, bench_cpu_opt);
+	nsc.width = 256;
+	nsc.height = 256;
+
+	bench_nsc_generate(&nsc, false);
+	bench_run("nsc_decode_raw", "generated 256x256", 1, nsc.width * nsc.height * 4, bench_nsc_decode, &nsc);
+	xfree(nsc.data);
+
+	bench_nsc_generate(&nsc, true);
+	bench_run("nsc_decode_rle", "generated 256x256", 1, nsc.width * nsc.height * 4, bench_nsc_decode, &nsc);
+	xfree(nsc.data);
+
+	nsc_context_free(nsc.context);
+}
+
+/* H.264 YUV 4:2:0 to BGRX conversion, on a generated picture */
+
+struct _BENCH_H264
+{
+	H264_CONTEXT* context;
+	int width;
+	int height;
+	uint8* planes[3];
+	int strides[3];
+	uint8* dst;
+};
+typedef struct _BENCH_H264 BENCH_H264;
+
+static void bench_h264_yuv420_to_bgrx(void* arg)
+{
+	BENCH_H264* h264 = (BENCH_H264*) arg;
+
+	h264->context->yuv420_to_bgrx((const uint8* const*) h264->planes, h264->strides,
+		0, 0, h264->width, h264->height, h264->dst, h264->width * 4);
+}
+
+static void bench_h264(void)
+{
+	int i;
+	int x, y;
+	BENCH_H264 h264;
+
+	if (!bench_selected("h264_yuv420_to_bgrx"))
+		return;
+
+	h264.context = h264_context_new();
+	h264_context_set_cpu_opt(h264.context, bench_cpu_opt);
+	h264.width = 1920;
+	h264.height = 1080;
+
+	for (i = 0; i < 3; i++)
+	{
+		h264.strides[i] = (i == 0) ? h264.width : h264.width / 2;
+		h264.planes[i] = (uint8*) xmalloc(h264.strides[i] * ((i == 0) ? h264.height : h264.height / 2));
+
+		for (y = 0; y < ((i == 0) ? h264.height : h264.height / 2); y++)
+		{
+			for (x = 0; x < h264.strides[i]; x++)
+				h264.planes[i][y * h264.strides[i] + x] = (uint8) (x * (i + 1) + y * 3 + ((x * y) >> 4));
+		}
+	}
+
+	h264.dst = (uint8*) xmalloc(h264.width * h264.height * 4);
+
+	bench_run("h264_yuv420_to_bgrx", "generated 1920x1080", 1, h264.width * h264.height * 4,
+		bench_h264_yuv420_to_bgrx, &h264);
+
+	for (i = 0; i < 3; i++)
+		xfree(h264.planes[i]);
+
+	xfree(h264.dst);
+	h264_context_free(h264.context);
+}
+
+/* JPEG surface bits, on a generated picture */
+
+struct _BENCH_JPEG
+{
+	JPEG_CONTEXT* context;
+	int width;
+	int height;
+	uint8* image;
+	uint8* dst;
+	STREAM* s;
+};
+typedef struct _BENCH_JPEG BENCH_JPEG;
+
+static void bench_jpeg_compose(void* arg)
+{
+	BENCH_JPEG* jpeg = (BENCH_JPEG*) arg;
+
+	stream_set_pos(jpeg->s, 0);
+	jpeg_compose_message(jpeg->context, jpeg->s, jpeg->image, jpeg->width, jpeg->height, jpeg->width * 4);
+}
+
+static void bench_jpeg_decompress(void* arg)
+{
+	BENCH_JPEG* jpeg = (BENCH_JPEG*) arg;
+
+	jpeg_context_decompress(jpeg->context, stream_get_head(jpeg->s) + 2, stream_get_length(jpeg->s) - 2,
+		jpeg->dst, jpeg->width * 4, jpeg->width, jpeg->height, 32);
+}
+
+static void bench_jpeg_decompress_oneshot(void* arg)
+{
+	BENCH_JPEG* jpeg = (BENCH_JPEG*) arg;
+
+	jpeg_decompress(stream_get_head(jpeg->s) + 2, jpeg->dst, jpeg->width, jpeg->height,
+		stream_get_length(jpeg->s) - 2, 32);
+}
+
+static void bench_jpeg(void)
+{
+	int x, y;
+	uint8* p;
+	BENCH_JPEG jpeg;
+
+	if (!bench_selected("jpeg_compose_message") && !bench_selected("jpeg_decompress"))
+		return;
+
+	jpeg.context = jpeg_context_new();
+	jpeg.width = 256;
+	jpeg.height = 256;
+	jpeg.image = (uint8*) xmalloc(jpeg.width * jpeg.height * 4);
+	jpeg.dst = (uint8*) xmalloc(jpeg.width * jpeg.height * 4);
+	jpeg.s = stream_new(jpeg.width * jpeg.height);
+
+	p = jpeg.image;
+
+	for (y = 0; y < jpeg.height; y++)
+	{
+		for (x = 0; x < jpeg.width; x++)
+		{
+			*p++ = (uint8) (x + ((x * y) >> 6));
+			*p++ = (uint8) (y * 3 + (x >> 2));
+			*p++ = (uint8) ((x ^ y) >> 1);
+			*p++ = 0xFF;
+		}
+	}
+
+	bench_run("jpeg_compose_message", "generated 256x256", 1, jpeg.width * jpeg.height * 4,
+		bench_jpeg_compose, &jpeg);
+
+	if (stream_get_length(jpeg.s) == 0)
+		bench_jpeg_compose(&jpeg);
+
+	bench_run("jpeg_decompress", "generated 256x256", 1, jpeg.width * jpeg.height * 4,
+		bench_jpeg_decompress, &jpeg);
+	bench_run("jpeg_decompress_oneshot", "generated 256x256", 1, jpeg.width * jpeg.height * 4,
+		bench_jpeg_decompress_oneshot, &jpeg);
+
+	stream_free(jpeg.s);
+	xfree(jpeg.image);
+	xfree(jpeg.dst);
+	jpeg_context_free(jpeg.context);
+}
+
+/* Interleaved and planar bitmaps, on the cunit samples */
+
+struct _BENCH_BITMAP
+{
+	uint8* data;
+	int size;
+	int width;
+	int height;
+	int bpp;
+	int dst_bpp;
+	uint8* dst;
+	bitmapExtra be;
+	STREAM* s;
+};
+typedef struct _BENCH_BITMAP BENCH_BITMAP;
+
+static void bench_bitmap_decompress(void* arg)
+{
+	BENCH_BITMAP* bitmap = (BENCH_BITMAP*) arg;
+
+	bitmap_decompress_ex(bitmap->data, bitmap->dst, bitmap->width, bitmap->height,
+		bitmap->size, bitmap->bpp, bitmap->dst_bpp, &bitmap->be);
+}
+
+static void bench_bitmap_one(const char* name, uint8* data, int size, int bpp, int dst_bpp)
+{
+	BENCH_BITMAP bitmap;
+
+	memset(&bitmap, 0, sizeof(BENCH_BITMAP));
+	bitmap.data = data;
+	bitmap.size = size;
+	bitmap.width = 32;
+	bitmap.height = 32;
+	bitmap.bpp = bpp;
+	bitmap.dst_bpp = dst_bpp;
+	bitmap.dst = (uint8*) xmalloc(32 * 32 * 4);
+	bitmap.be.temp = (uint8*) xmalloc(32 * 1024);
+
+	bench_run(name, "cunit/test_bitmap_data.h", 1, 32 * 32 * ((bpp + 7) / 8),
+		bench_bitmap_decompress, &bitmap);
+
+	xfree(bitmap.be.temp);
+	xfree(bitmap.dst);
+}
+
+static void bench_bitmap_compress(void* arg)
+{
+	BENCH_BITMAP* bitmap = (BENCH_BITMAP*) arg;
+
+	stream_set_pos(bitmap->s, 0);
+	bitmap_compress(bitmap->data, bitmap->s, bitmap->width, bitmap->height, bitmap->bpp);
+}
+
+static void bench_bitmap_compress_one(const char* name, uint8* data, int bpp)
+{
+	BENCH_BITMAP bitmap;
+
+	memset(&bitmap, 0, sizeof(BENCH_BITMAP));
+	bitmap.data = data;
+	bitmap.width = 32;
+	bitmap.height = 32;
+	bitmap.bpp = bpp;
+	bitmap.s = stream_new(32 * 32 * 4);
+
+	bench_run(name, "cunit/test_bitmap_data.h", 1, 32 * 32 * ((bpp + 7) / 8),
+		bench_bitmap_compress, &bitmap);
+
+	stream_free(bitmap.s);
+}
+
+static void bench_bitmap(void)
+{
+	bench_bitmap_one("interleaved_decompress_8bpp", compressed_32x32x8, sizeof(compressed_32x32x8), 8, 8);
+	bench_bitmap_one("interleaved_decompress_16bpp", compressed_32x32x16, sizeof(compressed_32x32x16), 16, 16);
+	bench_bitmap_one("interleaved_decompress_24bpp", compressed_32x32x24, sizeof(compressed_32x32x24), 24, 24);
+	bench_bitmap_one("interleaved_decompress_16bpp_to_32bpp", compressed_32x32x16, sizeof(compressed_32x32x16), 16, 32);
+	bench_bitmap_one("interleaved_decompress_24bpp_to_32bpp", compressed_32x32x24, sizeof(compressed_32x32x24), 24, 32);
+	bench_bitmap_one("planar_decompress_32bpp", compressed_32x32x32, sizeof(compressed_32x32x32), 32, 32);
+	bench_bitmap_compress_one("interleaved_compress_8bpp", decompressed_32x32x8, 8);
+	bench_bitmap_compress_one("interleaved_compress_16bpp", decompressed_32x32x16, 16);
+	bench_bitmap_compress_one("interleaved_compress_24bpp", decompressed_32x32x24, 24);
+	bench_bitmap_compress_one("planar_compress_32bpp", decompressed_32x32x32, 32);
+}
+
+/* MPPC bulk compression and decompression, on the cunit sample */
+
+struct _BENCH_MPPC
+{
+	rdpRdp rdp;
+	struct rdp_mppc mppc;
+	struct rdp_mppc_enc* enc;
+	uint8* data;
+	int size;
+	int type;
+};
+typedef struct _BENCH_MPPC BENCH_MPPC;
+
+static void bench_mppc_decompress(void* arg)
+{
+	uint32 roff;
+	uint32 rlen;
+	BENCH_MPPC* mppc = (BENCH_MPPC*) arg;
+
+	mppc->mppc.history_ptr = mppc->mppc.history_buf;
+	decompress_rdp(&mppc->rdp, mppc->data, mppc->size, PACKET_COMPRESSED | mppc->type, &roff, &rlen);
+}
+
+static void bench_mppc_compress(void* arg)
+{
+	BENCH_MPPC* mppc = (BENCH_MPPC*) arg;
+
+	/* a full history makes every packet start over, as the first one of a session does */
+	mppc->enc->history_offset = mppc->enc->buf_len;
+	compress_rdp(mppc->enc, decompressed_rd5, sizeof(decompressed_rd5));
+}
+
+static void bench_mppc(void)
+{
+	BENCH_MPPC* mppc;
+
+	if (!bench_selected("mppc_decompress_rdp4") && !bench_selected("mppc_decompress_rdp5") &&
+		!bench_selected("mppc_decompress_rdp6") && !bench_selected("mppc_compress_rdp4") &&
+		!bench_selected("mppc_compress_rdp5"))
+		return;
+
+	mppc = xnew(BENCH_MPPC);
+	mppc->rdp.mppc = &mppc->mppc;
+	mppc->mppc.history_buf = (uint8*) xzalloc(RDP6_HISTORY_BUF_SIZE);
+	mppc->mppc.history_buf_end = mppc->mppc.history_buf + RDP6_HISTORY_BUF_SIZE - 1;
+	mppc->mppc.offset_cache = (uint16*) xzalloc(RDP6_OFFSET_CACHE_SIZE * sizeof(uint16));
+
+	/* there is no RDP 4.0 capture, the sample compressed by compress_rdp_4 stands in */
+	mppc->enc = mppc_enc_new(PACKET_COMPR_TYPE_8K);
+	compress_rdp(mppc->enc, decompressed_rd5, sizeof(decompressed_rd5));
+	mppc->data = mppc->enc->output_buf;
+	mppc->size = mppc->enc->bytes_in_opb;
+	mppc->type = PACKET_COMPR_TYPE_8K;
+	bench_run("mppc_decompress_rdp4", "cunit/test_mppc_data.h", 1, sizeof(decompressed_rd5),
+		bench_mppc_decompress, mppc);
+
+	bench_run("mppc_compress_rdp4", "cunit/test_mppc_data.h", 1, sizeof(decompressed_rd5),
+		bench_mppc_compress, mppc);
+	mppc_enc_free(mppc->enc);
+
+	mppc->data = compressed_rd5;
+	mppc->size = sizeof(compressed_rd5);
+	mppc->type = PACKET_COMPR_TYPE_64K;
+	bench_run("mppc_decompress_rdp5", "cunit/test_mppc_data.h", 1, sizeof(decompressed_rd5),
+		bench_mppc_decompress, mppc);
+
+	mppc->enc = mppc_enc_new(PACKET_COMPR_TYPE_64K);
+	bench_run("mppc_compress_rdp5", "cunit/test_mppc_data.h", 1, sizeof(decompressed_rd5),
+		bench_mppc_compress, mppc);
+	mppc_enc_free(mppc->enc);
+
+	bench_skip("mppc_decompress_rdp6", "no sample data");
+
+	xfree(mppc->mppc.offset_cache);
+	xfree(mppc->mppc.history_buf);
+	xfree(mppc);
+}
+
+/* freerdp_image_convert(), on a generated 1024x768 desktop */
+
+struct _BENCH_CONVERT
+{
+	HCLRCONV clrconv;
+	uint8* src;
+	uint8* dst;
+	int width;
+	int height;
+	int src_bpp;
+	int dst_bpp;
+};
+typedef struct _BENCH_CONVERT BENCH_CONVERT;
+
+static void bench_convert_run(void* arg)
+{
+	BENCH_CONVERT* convert = (BENCH_CONVERT*) arg;
+
+	freerdp_image_convert(convert->src, convert->dst, convert->width, convert->height,
+		convert->src_bpp, convert->dst_bpp, convert->clrconv);
+}
+
+static void bench_convert(void)
+{
+	int i;
+	BENCH_CONVERT convert;
+	static const int paths[][2] =
+	{
+		{ 8, 32 }, { 15, 32 }, { 16, 32 }, { 24, 32 }, { 32, 32 },
+		{ 16, 16 }, { 32, 16 }, { 32, 24 }
+	};
+	static char names[sizeof(paths) / sizeof(paths[0])][32];
+	boolean selected = false;
+
+	for (i = 0; i < sizeof(paths) / sizeof(paths[0]); i++)
+	{
+		snprintf(names[i], sizeof(names[i]), "image_convert_%d_to_%d", paths[i][0], paths[i][1]);
+		selected |= bench_selected(names[i]);
+	}
+
+	if (!selected)
+		return;
+
+	freerdp_image_convert_set_cpu_opt(bench_cpu_opt);
+
+	convert.width = 1024;
+	convert.height = 768;
+	convert.src = (uint8*) xmalloc(convert.width * convert.height * 4);
+	convert.dst = (uint8*) xmalloc(convert.width * convert.height * 4);
+	convert.clrconv = freerdp_clrconv_new(CLRCONV_ALPHA);
+	convert.clrconv->palette->count = 256;
+	convert.clrconv->palette->entries = xnew0(PALETTE_ENTRY, 256);
+
+	for (i = 0; i < 256; i++)
+	{
+		convert.clrconv->palette->entries[i].red = i;
+		convert.clrconv->palette->entries[i].green = 255 - i;
+		convert.clrconv->palette->entries[i].blue = i ^ 0x5A;
+	}
+
+	srand(1);
+	for (i = 0; i < convert.width * convert.height * 4; i++)
+		convert.src[i] = (i / 4096) + (rand() & 0x0F);
+
+	for (i = 0; i < sizeof(paths) / sizeof(paths[0]); i++)
+	{
+		convert.src_bpp = paths[i][0];
+		convert.dst_bpp = paths[i][1];
+
+		bench_run(names[i], "generated 1024x768", 1, convert.width * convert.height * ((convert.dst_bpp + 7) / 8),
+			bench_convert_run, &convert);
+	}
+
+	xfree(convert.clrconv->palette->entries);
+	freerdp_clrconv_free(convert.clrconv);
+	xfree(convert.src);
+	xfree(convert.dst);
+}
+
+/* JSON report */
+
+static void bench_print_string(FILE* fp, const char* str)
+{
+	fputc('"', fp);
+
+	for (; *str; str++)
+	{
+		if (*str == '"' || *str == '\\')
+			fputc('\\', fp);
+
+		if ((uint8) *str < 0x20)
+			fprintf(fp, "\\u%04x", (uint8) *str);
+		else
+			fputc(*str, fp);
+	}
+
+	fputc('"', fp);
+}
+
+static void bench_print_report(FILE* fp)
+{
+	int i, j;
+	double total;
+	double per_iteration;
+	uint32 cpu;
+	BENCH_RESULT* result;
+
+	cpu = freerdp_detect_cpu();
+
+	fprintf(fp, "{\n");
+	fprintf(fp, "\t\"cpu\": { \"sse2\": %s, \"avx2\": %s, \"allowed\": %u },\n",
+		(cpu & CPU_SSE2) ? "true" : "false", (cpu & CPU_AVX2) ? "true" : "false", bench_cpu_opt);
+	fprintf(fp, "\t\"min_time\": %.3f,\n", bench_min_time);
+	fprintf(fp, "\t\"results\": [");
+
+	for (i = 0; i < bench_num_results; i++)
+	{
+		result = &bench_results[i];
+
+		fprintf(fp, "%s\n\t\t{ \"name\": ", (i > 0) ? "," : "");
+		bench_print_string(fp, result->name);
+
+		if (result->skipped != NULL)
+		{
+			fprintf(fp, ", \"skipped\": ");
+			bench_print_string(fp, result->skipped);
+			fprintf(fp, " }");
+			continue;
+		}
+
+		per_iteration = result->seconds / result->iterations;
+
+		fprintf(fp, ", \"corpus\": ");
+		bench_print_string(fp, result->corpus);
+		fprintf(fp, ",\n\t\t  \"iterations\": %d, \"seconds\": %.6f,", result->iterations, result->seconds);
+		fprintf(fp, " \"mb_per_s\": %.2f, \"frames_per_s\": %.2f",
+			result->bytes / per_iteration / (1024 * 1024), result->frames / per_iteration);
+
+		if (result->num_stages > 0)
+		{
+			for (j = 0, total = 0.0; j < result->num_stages; j++)
+				total += result->stages[j].seconds;
+
+			fprintf(fp, ",\n\t\t  \"stages\": [");
+
+			for (j = 0; j < result->num_stages; j++)
+			{
+				fprintf(fp, "%s\n\t\t\t{ \"name\": ", (j > 0) ? "," : "");
+				bench_print_string(fp, result->stages[j].name);
+				fprintf(fp, ", \"us\": %.3f, \"share\": %.3f }", result->stages[j].seconds * 1000000,
+					(total > 0.0) ? result->stages[j].seconds / total : 0.0);
+			}
+
+			fprintf(fp, "\n\t\t  ]");
+		}
+
+		fprintf(fp, " }");
+	}
+
+	fprintf(fp, "\n\t]\n}\n");
+}
+
+static void bench_usage(const char* name)
+{
+	fprintf(stderr,
+		"Usage: %s [options]\n"
+		"  --time <seconds>     minimum CPU time per benchmark (default 0.5)\n"
+		"  --filter <string>    only run benchmarks whose name contains string\n"
+		"  --cpu <c|sse2|avx2>  highest instruction set the codecs may use\n"
+		"  --pcap <file>        RemoteFX capture (default %s)\n"
+		"  --output <file>      write the JSON report to file instead of stdout\n",
+		name, FREERDP_BENCH_PCAP);
+}
+
+int main(int argc, char* argv[])
+{
+	int i;
+	FILE* fp = stdout;
+	const char* output = NULL;
+
+	bench_cpu_opt = freerdp_detect_cpu();
+
+	for (i = 1; i < argc; i++)
+	{
+		if (i + 1 < argc && strcmp(argv[i], "--time") == 0)
+			bench_min_time = atof(argv[++i]);
+		else if (i + 1 < argc && strcmp(argv[i], "--filter") == 0)
+			bench_filter = argv[++i];
+		else if (i + 1 < argc && strcmp(argv[i], "--pcap") == 0)
+			bench_pcap = argv[++i];
+		else if (i + 1 < argc && strcmp(argv[i], "--output") == 0)
+			output = argv[++i];
+		else if (i + 1 < argc && strcmp(argv[i], "--cpu") == 0)
+		{
+			i++;
+			if (strcmp(argv[i], "c") == 0)
+				bench_cpu_opt = 0;
+			else if (strcmp(argv[i], "sse2") == 0)
+				bench_cpu_opt &= CPU_SSE2;
+			else if (strcmp(argv[i], "avx2") != 0)
+			{
+				bench_usage(argv[0]);
+				return 1;
+			}
+		}
+		else
+		{
+			bench_usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (bench_min_time <= 0.0)
+		bench_min_time = 0.5;
+
+	bench_rfx_tile();
+	bench_rfx_pcap();
+	bench_nsc();
+	bench_h264();
+	bench_jpeg();
+	bench_bitmap();
+	bench_mppc();
+	bench_convert();
+
+	if (output != NULL)
+	{
+		fp = fopen(output, "w");
+
+		if (fp == NULL)
+		{
+			fprintf(stderr, "freerdp-bench: cannot open %s\n", output);
+			return 1;
+		}
+	}
+
+	bench_print_report(fp);
+
+	if (fp != stdout)
+		fclose(fp);
+
+	xfree(bench_results);
+
+	return 0;
+}
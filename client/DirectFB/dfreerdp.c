@@ -365,6 +365,16 @@ int dfreerdp_run(freerdp* instance)
 			FD_SET(fds, &rfds_set);
 		}
 
+		for (i = 0; i < wcount; i++)
+		{
+			fds = (int)(long)(wfds[i]);
+
+			if (fds > max_fds)
+				max_fds = fds;
+
+			FD_SET(fds, &wfds_set);
+		}
+
 		if (max_fds == 0)
 			break;
 
@@ -33,6 +33,7 @@
 #include <freerdp/codec/color.h>
 #include <freerdp/codec/bitmap.h>
 #include <freerdp/codec/jpeg.h>
+#include <freerdp/codec/h264.h>
 
 #include "xf_gdi.h"
 
@@ -642,6 +643,170 @@ void xf_gdi_mem3blt(rdpContext* context, MEM3BLT_ORDER* mem3blt)
 
 }
 
+/* JPEG surface commands of a frame, decoded concurrently into one XShm segment */
+struct xf_jpeg_batch
+{
+	JPEG_JOB* jobs;
+	XRectangle* dests;
+	int count;
+	int max;
+
+	struct shm_info_t* shm_info;
+	XShmSegmentInfo shminfo;
+};
+
+/**
+ * Queue a JPEG surface command. Its data lives in the receive buffer, so
+ * the queue is flushed at the latest when the update PDU ends.
+ */
+static void xf_gdi_jpeg_queue(xfInfo* xfi, SURFACE_BITS_COMMAND* surface_bits_command)
+{
+	int header_bytes;
+	JPEG_JOB* job;
+	struct xf_jpeg_batch* batch;
+
+	if (xfi->jpeg_context == NULL)
+		return;
+
+	if (surface_bits_command->bitmapDataLength < 2)
+		return;
+
+	header_bytes = surface_bits_command->bitmapData[0];
+	header_bytes = header_bytes | (surface_bits_command->bitmapData[1] << 8);
+
+	if (surface_bits_command->bitmapDataLength < 2 + header_bytes)
+		return;
+
+	if (xfi->jpeg_batch == NULL)
+		xfi->jpeg_batch = xnew(struct xf_jpeg_batch);
+
+	batch = (struct xf_jpeg_batch*) xfi->jpeg_batch;
+
+	if (batch->count == batch->max)
+	{
+		batch->max = MAX(batch->max * 2, 16);
+		batch->jobs = (JPEG_JOB*) xrealloc(batch->jobs, batch->max * sizeof(JPEG_JOB));
+		batch->dests = (XRectangle*) xrealloc(batch->dests, batch->max * sizeof(XRectangle));
+	}
+
+	job = &batch->jobs[batch->count];
+	job->input = surface_bits_command->bitmapData + (2 + header_bytes);
+	job->size = surface_bits_command->bitmapDataLength - (2 + header_bytes);
+	job->width = surface_bits_command->width;
+	job->height = surface_bits_command->height;
+	job->bpp = 32;
+
+	batch->dests[batch->count].x = surface_bits_command->destLeft;
+	batch->dests[batch->count].y = surface_bits_command->destTop;
+	batch->dests[batch->count].width = surface_bits_command->width;
+	batch->dests[batch->count].height = surface_bits_command->height;
+	batch->count++;
+}
+
+/**
+ * Decode the queued JPEG surface commands on the JPEG context threads and
+ * put them on screen. The segment stays attached to the X server, a single
+ * XSync before returning makes it reusable.
+ */
+void xf_gdi_jpeg_flush(xfInfo* xfi)
+{
+	int i;
+	int bytes;
+	int offset;
+	XImage* image;
+	Drawable dst;
+	XRectangle* rect;
+	struct xf_jpeg_batch* batch = (struct xf_jpeg_batch*) xfi->jpeg_batch;
+
+	if (batch == NULL || batch->count == 0)
+		return;
+
+	for (i = 0, bytes = 0; i < batch->count; i++)
+		bytes += batch->jobs[i].width * batch->jobs[i].height * 4;
+
+	if (batch->shm_info == NULL || batch->shm_info->bytes < bytes)
+	{
+		if (batch->shm_info != NULL)
+		{
+			XShmDetach(xfi->display, &batch->shminfo);
+			XSync(xfi->display, false);
+			delete_shm_info(batch->shm_info);
+		}
+
+		batch->shm_info = create_shm_info(bytes);
+		memset(&batch->shminfo, 0, sizeof(batch->shminfo));
+		batch->shminfo.shmid = batch->shm_info->shmid;
+		batch->shminfo.shmaddr = batch->shm_info->ptr;
+		XShmAttach(xfi->display, &batch->shminfo);
+	}
+
+	for (i = 0, offset = 0; i < batch->count; i++)
+	{
+		batch->jobs[i].output = (uint8*) batch->shm_info->ptr + offset;
+		batch->jobs[i].stride = batch->jobs[i].width * 4;
+		offset += batch->jobs[i].width * batch->jobs[i].height * 4;
+	}
+
+	jpeg_context_decompress_jobs((JPEG_CONTEXT*) xfi->jpeg_context, batch->jobs, batch->count);
+
+	XSetFunction(xfi->display, xfi->gc, GXcopy);
+	XSetFillStyle(xfi->display, xfi->gc, FillSolid);
+	dst = xfi->skip_bs ? xfi->drawable : xfi->primary;
+
+	for (i = 0; i < batch->count; i++)
+	{
+		if (!batch->jobs[i].success)
+		{
+			printf("jpeg_decompress error\n");
+			continue;
+		}
+
+		rect = &batch->dests[i];
+		image = XShmCreateImage(xfi->display, xfi->visual, xfi->depth, ZPixmap,
+				(char*) batch->jobs[i].output, &batch->shminfo, rect->width, rect->height);
+		XShmPutImage(xfi->display, dst, xfi->gc, image, 0, 0,
+				rect->x, rect->y, rect->width, rect->height, false);
+		XFree(image);
+	}
+
+	XSync(xfi->display, false);
+
+	for (i = 0; i < batch->count; i++)
+	{
+		rect = &batch->dests[i];
+
+		if (batch->jobs[i].success && !xfi->remote_app && !xfi->skip_bs)
+		{
+			XCopyArea(xfi->display, xfi->primary, xfi->drawable, xfi->gc,
+					rect->x, rect->y, rect->width, rect->height, rect->x, rect->y);
+		}
+	}
+
+	batch->count = 0;
+
+	xfi->instance->SendFrameAck(xfi->instance, xfi->frameId);
+}
+
+void xf_gdi_jpeg_free(xfInfo* xfi)
+{
+	struct xf_jpeg_batch* batch = (struct xf_jpeg_batch*) xfi->jpeg_batch;
+
+	if (batch == NULL)
+		return;
+
+	if (batch->shm_info != NULL)
+	{
+		XShmDetach(xfi->display, &batch->shminfo);
+		XSync(xfi->display, false);
+		delete_shm_info(batch->shm_info);
+	}
+
+	xfree(batch->jobs);
+	xfree(batch->dests);
+	xfree(batch);
+	xfi->jpeg_batch = NULL;
+}
+
 void xf_gdi_surface_frame_marker(rdpContext* context, SURFACE_FRAME_MARKER* surface_frame_marker)
 {
 	xfInfo* xfi;
@@ -652,6 +817,10 @@ void xf_gdi_surface_frame_marker(rdpContext* context, SURFACE_FRAME_MARKER* surf
 	{
 		xfi->frameId = surface_frame_marker->frameId;
 	}
+	else
+	{
+		xf_gdi_jpeg_flush(xfi);
+	}
 }
 
 void xf_gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits_command)
@@ -663,44 +832,79 @@ void xf_gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits
 	RFX_CONTEXT* rfx_context = (RFX_CONTEXT*) xfi->rfx_context;
 	NSC_CONTEXT* nsc_context = (NSC_CONTEXT*) xfi->nsc_context;
 
+	/* JPEG commands are decoded together when the frame ends */
+	if (surface_bits_command->codecID == CODEC_ID_JPEG)
+	{
+		xf_gdi_jpeg_queue(xfi, surface_bits_command);
+		return;
+	}
+
+	xf_gdi_jpeg_flush(xfi);
+
 	if (surface_bits_command->codecID == CODEC_ID_H264)
 	{
 		STREAM* s;
 		int num_rects;
 		int h264_bytes;
+		int x, y, cx, cy;
+		int bytes;
+		uint16 rx, ry, rcx, rcy;
+		RECTANGLE_16* rects;
+		Drawable dst;
+		XShmSegmentInfo shminfo;
+		H264_CONTEXT* h264_context = (H264_CONTEXT*) xfi->h264_context;
+
+		if (h264_context == NULL)
+			goto done;
 
+		/* uint16 num_rects, num_rects x (uint16 x, y, cx, cy), uint32 h264_bytes, h264 data */
 		s = stream_new(0);
 		stream_attach(s, surface_bits_command->bitmapData, surface_bits_command->bitmapDataLength);
+
+		if (stream_get_left(s) < 2)
+		{
+			stream_attach(s, 0, 0);
+			stream_free(s);
+			goto done;
+		}
+
 		stream_read_uint16(s, num_rects);
-		stream_seek(s, num_rects * 8);
+
+		if (stream_get_left(s) < num_rects * 8 + 4)
+		{
+			stream_attach(s, 0, 0);
+			stream_free(s);
+			goto done;
+		}
+
+		rects = (RECTANGLE_16*) xmalloc(MAX(num_rects, 1) * sizeof(RECTANGLE_16));
+
+		for (i = 0; i < num_rects; i++)
+		{
+			stream_read_uint16(s, rx);
+			stream_read_uint16(s, ry);
+			stream_read_uint16(s, rcx);
+			stream_read_uint16(s, rcy);
+			rects[i].left = rx;
+			rects[i].top = ry;
+			rects[i].right = rx + rcx;
+			rects[i].bottom = ry + rcy;
+		}
+
 		stream_read_uint32(s, h264_bytes);
-		stream_attach(s, 0, 0);
-		stream_free(s);
-		printf("h264 bytes %d num_rects %d h264_bytes %d\n",
-				surface_bits_command->bitmapDataLength, num_rects, h264_bytes);
-	}
-	else if (surface_bits_command->codecID == CODEC_ID_JPEG)
-	{
-		tui8* comp;
-		tbool ok;
-		Drawable dst;
-		int x;
-		int y;
-		int cx;
-		int cy;
-		int header_bytes;
-		int bytes;
-		XShmSegmentInfo shminfo;
 
-		XSetFunction(xfi->display, xfi->gc, GXcopy);
-		XSetFillStyle(xfi->display, xfi->gc, FillSolid);
+		if (h264_bytes < 0 || stream_get_left(s) < h264_bytes)
+		{
+			xfree(rects);
+			stream_attach(s, 0, 0);
+			stream_free(s);
+			goto done;
+		}
+
 		x = surface_bits_command->destLeft;
 		y = surface_bits_command->destTop;
 		cx = surface_bits_command->width;
 		cy = surface_bits_command->height;
-		header_bytes = surface_bits_command->bitmapData[0];
-		header_bytes = header_bytes | (surface_bits_command->bitmapData[1] << 8);
-		comp = surface_bits_command->bitmapData + (2 + header_bytes);
 
 		bytes = cx * cy * 4;
 		if (xfi->shm_info == 0)
@@ -713,29 +917,63 @@ void xf_gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits
 			xfi->shm_info = create_shm_info(bytes);
 		}
 
-		bytes = surface_bits_command->bitmapDataLength - (2 + header_bytes);
-		ok = jpeg_decompress(comp, xfi->shm_info->ptr, cx, cy, bytes, 32);
-		if (ok)
+		/* the decoder may hand back an earlier frame, with the rects and position it came with */
+		num_rects = h264_decompress(h264_context, stream_get_tail(s), h264_bytes,
+				rects, num_rects, x, y, xfi->shm_info->ptr, cx * 4, cx, cy);
+
+		xfree(rects);
+		stream_attach(s, 0, 0);
+		stream_free(s);
+
+		if (num_rects < 0)
 		{
-			dst = xfi->skip_bs ? xfi->drawable : xfi->primary;
-			memset(&shminfo, 0, sizeof(shminfo));
-			shminfo.shmid = xfi->shm_info->shmid;
-			shminfo.shmaddr = xfi->shm_info->ptr;
-			image = XShmCreateImage(xfi->display, xfi->visual, xfi->depth,
-					ZPixmap, xfi->shm_info->ptr, &shminfo, cx, cy);
-			XShmAttach(xfi->display, &shminfo);
-			XShmPutImage(xfi->display, dst, xfi->gc, image, 0, 0, x, y, cx, cy, false);
-			XSync(xfi->display, false);
-			XShmDetach(xfi->display, &shminfo);
-			XFree(image);
+			printf("h264_decompress error\n");
+			goto done;
+		}
+
+		/* the decoder is holding this picture back */
+		if (num_rects == 0)
+			goto done;
+
+		x = h264_context->left;
+		y = h264_context->top;
+
+		XSetFunction(xfi->display, xfi->gc, GXcopy);
+		XSetFillStyle(xfi->display, xfi->gc, FillSolid);
+		dst = xfi->skip_bs ? xfi->drawable : xfi->primary;
+		memset(&shminfo, 0, sizeof(shminfo));
+		shminfo.shmid = xfi->shm_info->shmid;
+		shminfo.shmaddr = xfi->shm_info->ptr;
+		image = XShmCreateImage(xfi->display, xfi->visual, xfi->depth,
+				ZPixmap, xfi->shm_info->ptr, &shminfo, cx, cy);
+		XShmAttach(xfi->display, &shminfo);
+
+		/* only the rects listed in the command changed */
+		for (i = 0; i < num_rects; i++)
+		{
+			rx = h264_context->rects[i].left;
+			ry = h264_context->rects[i].top;
+			rcx = h264_context->rects[i].right - rx;
+			rcy = h264_context->rects[i].bottom - ry;
+			XShmPutImage(xfi->display, dst, xfi->gc, image, rx, ry, x + rx, y + ry, rcx, rcy, false);
+		}
+
+		XSync(xfi->display, false);
+		XShmDetach(xfi->display, &shminfo);
+		XFree(image);
+
+		for (i = 0; i < num_rects; i++)
+		{
+			rx = h264_context->rects[i].left;
+			ry = h264_context->rects[i].top;
+			rcx = h264_context->rects[i].right - rx;
+			rcy = h264_context->rects[i].bottom - ry;
 			if (!xfi->remote_app && !xfi->skip_bs)
 			{
-				XCopyArea(xfi->display, xfi->primary, xfi->drawable, xfi->gc, x, y, cx, cy, x, y);
+				XCopyArea(xfi->display, xfi->primary, xfi->drawable, xfi->gc,
+						x + rx, y + ry, rcx, rcy, x + rx, y + ry);
 			}
-		}
-		else
-		{
-			printf("jpeg_decompress error\n");
+			gdi_InvalidateRegion(xfi->hdc, x + rx, y + ry, rcx, rcy);
 		}
 	}
 	else if (surface_bits_command->codecID == CODEC_ID_REMOTEFX)
@@ -780,8 +1018,10 @@ void xf_gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits
 	{
 		nsc_context->width = surface_bits_command->width;
 		nsc_context->height = surface_bits_command->height;
-		nsc_process_message(nsc_context, surface_bits_command->bitmapData,
-				surface_bits_command->bitmapDataLength);
+		if (!nsc_process_message(nsc_context, surface_bits_command->bitmapData,
+				surface_bits_command->bitmapDataLength))
+			goto done;
+
 		XSetFunction(xfi->display, xfi->gc, GXcopy);
 		XSetFillStyle(xfi->display, xfi->gc, FillSolid);
 		xfi->bmp_codec_nsc = (uint8*) xrealloc(xfi->bmp_codec_nsc,
@@ -805,7 +1045,6 @@ void xf_gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits
 				surface_bits_command->destTop,
 				surface_bits_command->width, surface_bits_command->height);
 		XSetClipMask(xfi->display, xfi->gc, None);
-		nsc_context_destroy(nsc_context);
 	}
 	else if (surface_bits_command->codecID == CODEC_ID_NONE)
 	{
@@ -838,6 +1077,8 @@ void xf_gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits
 		printf("Unsupported codecID %d\n", surface_bits_command->codecID);
 	}
 
+done:
+	/* acked even when the command could not be drawn, so the server keeps sending */
 	LLOGLN(10, ("xf_gdi_surface_bits: sending frame ack"));
 	xfi->instance->SendFrameAck(xfi->instance, xfi->frameId);
 }
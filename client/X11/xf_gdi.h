@@ -25,5 +25,7 @@
 #include "xfreerdp.h"
 
 void xf_gdi_register_update_callbacks(rdpUpdate* update);
+void xf_gdi_jpeg_flush(xfInfo* xfi);
+void xf_gdi_jpeg_free(xfInfo* xfi);
 
 #endif /* __XF_GDI_H */
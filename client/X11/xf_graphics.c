@@ -136,7 +136,8 @@ void xf_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 		uint8* data, int width, int height, int bpp, int length,
 		tbool compressed, int codec_id)
 {
-	uint16 size;
+	int size;
+	int dst_bpp;
 	RFX_MESSAGE* msg;
 	uint8* src;
 	uint8* dst;
@@ -153,7 +154,15 @@ void xf_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 		bpp = 15;
 	}
 
-	size = width * height * (bpp + 7) / 8;
+	/* interleaved bitmaps are decompressed straight to the 32 bpp of the X server */
+	dst_bpp = bpp;
+	if (compressed && (codec_id == CODEC_ID_NONE) && (xfi->bpp == 32) && !xfi->clrconv->invert &&
+		((bpp == 15) || (bpp == 16) || (bpp == 24)))
+	{
+		dst_bpp = 32;
+	}
+
+	size = width * height * (dst_bpp + 7) / 8;
 
 	if (bitmap->data == NULL)
 		bitmap->data = (uint8*) xmalloc(size);
@@ -200,7 +209,7 @@ void xf_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 			{
 				memset(&be, 0, sizeof(be));
 				be.temp = context->temp;
-				status = bitmap_decompress_ex(data, bitmap->data, width, height, length, bpp, bpp, &be);
+				status = bitmap_decompress_ex(data, bitmap->data, width, height, length, bpp, dst_bpp, &be);
 
 				if (status == false)
 				{
@@ -216,7 +225,7 @@ void xf_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 
 	bitmap->compressed = false;
 	bitmap->length = size;
-	bitmap->bpp = bpp;
+	bitmap->bpp = dst_bpp;
 }
 
 void xf_Bitmap_SetSurface(rdpContext* context, rdpBitmap* bitmap, tbool primary)
@@ -43,6 +43,8 @@
 #include <freerdp/constants.h>
 #include <freerdp/codec/nsc.h>
 #include <freerdp/codec/rfx.h>
+#include <freerdp/codec/h264.h>
+#include <freerdp/codec/jpeg.h>
 #include <freerdp/codec/color.h>
 #include <freerdp/codec/bitmap.h>
 #include <freerdp/utils/args.h>
@@ -202,6 +204,9 @@ void xf_hw_end_paint(rdpContext* context)
 
 	xfi = ((xfContext*) context)->xfi;
 
+	/* the queued JPEG commands point into the PDU just processed */
+	xf_gdi_jpeg_flush(xfi);
+
 	if (xfi->remote_app)
 	{
 		if (xfi->hdc->hwnd->invalid->null)
@@ -596,45 +601,12 @@ tbool xf_pre_connect(freerdp* instance)
 	return true;
 }
 
-void cpuid(unsigned info, unsigned *eax, unsigned *ebx, unsigned *ecx, unsigned *edx)
-{
-#ifdef __GNUC__
-#if defined(__i386__) || defined(__x86_64__)
-	*eax = info;
-	__asm volatile
-		("mov %%ebx, %%edi;" /* 32bit PIC: don't clobber ebx */
-		 "cpuid;"
-		 "mov %%ebx, %%esi;"
-		 "mov %%edi, %%ebx;"
-		 :"+a" (*eax), "=S" (*ebx), "=c" (*ecx), "=d" (*edx)
-		 : :"edi");
-#endif
-#endif
-}
-
-uint32 xf_detect_cpu()
-{
-	unsigned int eax, ebx, ecx, edx = 0;
-	uint32 cpu_opt = 0;
-
-	cpuid(1, &eax, &ebx, &ecx, &edx);
-
-	if (edx & (1<<26))
-	{
-		DEBUG("SSE2 detected");
-		cpu_opt |= CPU_SSE2;
-	}
-
-	return cpu_opt;
-}
-
 tbool xf_post_connect(freerdp* instance)
 {
 	xfInfo* xfi;
 	XGCValues gcv;
 	rdpCache* cache;
 	rdpChannels* channels;
-	RFX_CONTEXT* rfx_context = NULL;
 
 	xfi = ((xfContext*) instance->context)->xfi;
 	cache = instance->context->cache;
@@ -660,8 +632,6 @@ tbool xf_post_connect(freerdp* instance)
 		gdi_init(instance, flags, NULL);
 		gdi = instance->context->gdi;
 		xfi->primary_buffer = gdi->primary_buffer;
-
-		rfx_context = gdi->rfx_context;
 	}
 	else
 	{
@@ -671,21 +641,22 @@ tbool xf_post_connect(freerdp* instance)
 		xfi->hdc = gdi_CreateDC(xfi->clrconv, xfi->bpp);
 
 		if (instance->settings->rfx_codec)
-		{
-			rfx_context = (void*) rfx_context_new();
-			xfi->rfx_context = rfx_context;
-		}
+			xfi->rfx_context = (void*) rfx_context_new();
 
 		if (instance->settings->ns_codec)
 			xfi->nsc_context = (void*) nsc_context_new();
-	}
 
-	if (rfx_context)
-	{
-#ifdef WITH_SSE2
-		/* detect only if needed */
-		rfx_context_set_cpu_opt(rfx_context, xf_detect_cpu());
-#endif
+		if (instance->settings->h264_codec)
+		{
+			xfi->h264_context = (void*) h264_context_new();
+			h264_context_set_thread_count(xfi->h264_context, sysconf(_SC_NPROCESSORS_ONLN));
+		}
+
+		if (instance->settings->jpeg_codec)
+		{
+			xfi->jpeg_context = (void*) jpeg_context_new();
+			jpeg_context_set_thread_count(xfi->jpeg_context, sysconf(_SC_NPROCESSORS_ONLN));
+		}
 	}
 
 	xfi->width = instance->settings->width;
@@ -928,6 +899,26 @@ void xf_window_free(xfInfo* xfi)
 		xfi->rfx_context = NULL;
 	}
 
+	if (xfi->nsc_context)
+	{
+		nsc_context_free(xfi->nsc_context);
+		xfi->nsc_context = NULL;
+	}
+
+	if (xfi->h264_context)
+	{
+		h264_context_free(xfi->h264_context);
+		xfi->h264_context = NULL;
+	}
+
+	xf_gdi_jpeg_free(xfi);
+
+	if (xfi->jpeg_context)
+	{
+		jpeg_context_free(xfi->jpeg_context);
+		xfi->jpeg_context = NULL;
+	}
+
 	freerdp_clrconv_free(xfi->clrconv);
 
 	if (xfi->hdc)
@@ -1013,6 +1004,16 @@ int xfreerdp_run(freerdp* instance)
 			FD_SET(fds, &rfds_set);
 		}
 
+		for (i = 0; i < wcount; i++)
+		{
+			fds = (int)(long)(wfds[i]);
+
+			if (fds > max_fds)
+				max_fds = fds;
+
+			FD_SET(fds, &wfds_set);
+		}
+
 		if (max_fds == 0)
 			break;
 
@@ -152,6 +152,9 @@ struct xf_info
 	uint8* bmp_codec_nsc;
 	void* rfx_context;
 	void* nsc_context;
+	void* h264_context;
+	void* jpeg_context;
+	void* jpeg_batch;
 	void* xv_context;
 	void* clipboard_context;
 
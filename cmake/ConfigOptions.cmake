@@ -18,8 +18,10 @@ option(WITH_DEBUG_SCARD "Print smartcard debug messages" OFF)
 option(WITH_DEBUG_ORDERS "Print drawing orders debug messages" OFF)
 option(WITH_MANPAGES "Generate manpages." ON)
 option(WITH_PROFILER "Compile profiler." OFF)
+option(WITH_BENCH "Build codec benchmarks." OFF)
 option(WITH_SSE2 "Use SSE2 optimization." OFF)
 option(WITH_SSE2_TARGET "Allow compiler to generate SSE2 instructions." OFF)
+option(WITH_AVX2 "Use AVX2 optimization, selected at runtime when the CPU supports it." OFF)
 option(WITH_DEBUG_REDIR "Redirection debug messages" OFF)
 option(WITH_DEBUG_CLIPRDR "Print clipboard redirection debug messages" OFF)
 option(WITH_DEBUG_WND "Print window order debug messages" OFF)
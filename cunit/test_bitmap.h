@@ -24,3 +24,5 @@ int clean_bitmap_suite(void);
 int add_bitmap_suite(void);
 
 void test_bitmap(void);
+void test_bitmap_compress(void);
+void test_bitmap_decompress_to_32bpp(void);
@@ -22,6 +22,9 @@
 #include <freerdp/freerdp.h>
 #include <freerdp/gdi/gdi.h>
 #include <freerdp/codec/color.h>
+#include <freerdp/utils/memory.h>
+#include <freerdp/utils/cpu.h>
+#include <freerdp/constants.h>
 #include "test_color.h"
 
 int init_color_suite(void)
@@ -44,6 +47,10 @@ int add_color_suite(void)
 	add_test_function(color_GetRGB16);
 	add_test_function(color_GetBGR_565);
 	add_test_function(color_GetBGR16);
+	add_test_function(color_image_convert_simd);
+	add_test_function(color_image_convert_stride);
+	add_test_function(color_image_swap_color_order);
+	add_test_function(color_bitmap_flip);
 
 	return 0;
 }
@@ -150,3 +157,194 @@ void test_color_GetBGR16(void)
 	CU_ASSERT(b == 0xEF);
 }
 
+static const int color_bpps[] = { 8, 15, 16, 24, 32 };
+
+static void color_palette_init(CLRCONV* clrconv, rdpPalette* palette, PALETTE_ENTRY* entries)
+{
+	int i;
+
+	for (i = 0; i < 256; i++)
+	{
+		entries[i].red = i;
+		entries[i].green = i * 7;
+		entries[i].blue = i ^ 0x5A;
+	}
+
+	palette->count = 256;
+	palette->entries = entries;
+	clrconv->palette = palette;
+}
+
+/* every kernel, at widths around the vector sizes and with padded rows, against the C one */
+void test_color_image_convert_simd(void)
+{
+	int i, j, k;
+	int flags;
+	int width;
+	int height = 5;
+	int stride = 80 * 4;
+	uint8* src;
+	uint8* expected;
+	uint8* actual;
+	CLRCONV clrconv;
+	rdpPalette palette;
+	PALETTE_ENTRY entries[256];
+	uint32 cpu_opts[] = { CPU_SSE2, CPU_SSE2 | CPU_AVX2 };
+
+	color_palette_init(&clrconv, &palette, entries);
+
+	src = (uint8*) xmalloc(stride * height);
+	expected = (uint8*) xmalloc(stride * height);
+	actual = (uint8*) xmalloc(stride * height);
+
+	srand(1);
+	for (i = 0; i < stride * height; i++)
+		src[i] = rand();
+
+	for (k = 0; k < sizeof(cpu_opts) / sizeof(cpu_opts[0]); k++)
+	{
+		if ((cpu_opts[k] & freerdp_detect_cpu()) != cpu_opts[k])
+			continue;
+
+		for (i = 0; i < 5; i++)
+		{
+			for (j = 0; j < 5; j++)
+			{
+				for (flags = 0; flags < 8; flags++)
+				{
+					clrconv.alpha = (flags & CLRCONV_ALPHA) ? 1 : 0;
+					clrconv.invert = (flags & CLRCONV_INVERT) ? 1 : 0;
+					clrconv.rgb555 = (flags & CLRCONV_RGB555) ? 1 : 0;
+
+					for (width = 1; width <= 70; width++)
+					{
+						memset(expected, 0xCD, stride * height);
+						memset(actual, 0xCD, stride * height);
+
+						freerdp_image_convert_set_cpu_opt(0);
+						if (!freerdp_image_convert_ex(src, stride, expected, stride, width, height,
+							color_bpps[i], color_bpps[j], &clrconv))
+							continue;
+
+						freerdp_image_convert_set_cpu_opt(cpu_opts[k]);
+						CU_ASSERT(freerdp_image_convert_ex(src, stride, actual, stride, width, height,
+							color_bpps[i], color_bpps[j], &clrconv) == true);
+
+						if (memcmp(expected, actual, stride * height) != 0)
+						{
+							printf("\n%d to %d bpp, flags 0x%X, width %d, cpu 0x%X differs\n",
+								color_bpps[i], color_bpps[j], flags, width, cpu_opts[k]);
+							CU_FAIL("simd kernel differs from C");
+						}
+					}
+				}
+			}
+		}
+	}
+
+	freerdp_image_convert_set_cpu_opt(freerdp_detect_cpu());
+
+	xfree(src);
+	xfree(expected);
+	xfree(actual);
+}
+
+/* a negative source stride converts and flips in one pass */
+void test_color_image_convert_stride(void)
+{
+	int i, y;
+	int width = 37;
+	int height = 9;
+	int stride = 40 * 4;
+	uint8* src;
+	uint8* expected;
+	uint8* flipped;
+	uint8* actual;
+	CLRCONV clrconv;
+	rdpPalette palette;
+	PALETTE_ENTRY entries[256];
+
+	color_palette_init(&clrconv, &palette, entries);
+	clrconv.alpha = 1;
+	clrconv.invert = 0;
+	clrconv.rgb555 = 0;
+
+	src = (uint8*) xmalloc(width * height * 2);
+	flipped = (uint8*) xmalloc(width * height * 4);
+	actual = (uint8*) xmalloc(stride * height);
+
+	srand(2);
+	for (i = 0; i < width * height * 2; i++)
+		src[i] = rand();
+
+	expected = freerdp_image_convert(src, NULL, width, height, 16, 32, &clrconv);
+	freerdp_image_flip(expected, flipped, width, height, 32);
+
+	memset(actual, 0xCD, stride * height);
+	CU_ASSERT(freerdp_image_convert_ex(src + (height - 1) * width * 2, -width * 2,
+		actual, stride, width, height, 16, 32, &clrconv) == true);
+
+	for (y = 0; y < height; y++)
+	{
+		CU_ASSERT(memcmp(actual + y * stride, flipped + y * width * 4, width * 4) == 0);
+		/* the padding at the end of each row is left alone */
+		CU_ASSERT(actual[y * stride + width * 4] == 0xCD);
+		CU_ASSERT(actual[y * stride + stride - 1] == 0xCD);
+	}
+
+	/* conversions freerdp_image_convert() never did are refused */
+	CU_ASSERT(freerdp_image_convert_ex(src, width * 2, actual, stride, width, height, 16, 15, &clrconv) == false);
+	CU_ASSERT(freerdp_image_convert_select(1, 32, &clrconv) == NULL);
+
+	free(expected);
+	xfree(src);
+	xfree(flipped);
+	xfree(actual);
+}
+
+void test_color_image_swap_color_order(void)
+{
+	int i;
+	uint32 pixels[19];
+
+	for (i = 0; i < 19; i++)
+		pixels[i] = 0x80112233 + i;
+
+	freerdp_image_swap_color_order((uint8*) pixels, 19, 1);
+
+	for (i = 0; i < 19; i++)
+		CU_ASSERT(pixels[i] == 0x80000000 + ((0x33 + i) << 16) + 0x2200 + 0x11);
+}
+
+/* in place and out of place flips agree, for odd heights and rows wider than the swap buffer */
+void test_color_bitmap_flip(void)
+{
+	int i, h;
+	int scanline = 3000;
+	uint8* src;
+	uint8* flipped;
+	uint8* in_place;
+
+	src = (uint8*) xmalloc(scanline * 5);
+	flipped = (uint8*) xmalloc(scanline * 5);
+	in_place = (uint8*) xmalloc(scanline * 5);
+
+	for (i = 0; i < scanline * 5; i++)
+		src[i] = i % 251;
+
+	for (h = 1; h <= 5; h++)
+	{
+		freerdp_bitmap_flip(src, flipped, scanline, h);
+
+		for (i = 0; i < h; i++)
+			CU_ASSERT(memcmp(flipped + i * scanline, src + (h - 1 - i) * scanline, scanline) == 0);
+
+		memcpy(in_place, src, scanline * h);
+		freerdp_bitmap_flip(in_place, in_place, scanline, h);
+		CU_ASSERT(memcmp(in_place, flipped, scanline * h) == 0);
+	}
+
+	xfree(src);
+	xfree(flipped);
+	xfree(in_place);
+}
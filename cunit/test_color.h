@@ -29,3 +29,7 @@ void test_color_GetRGB_565(void);
 void test_color_GetRGB16(void);
 void test_color_GetBGR_565(void);
 void test_color_GetBGR16(void);
+void test_color_image_convert_simd(void);
+void test_color_image_convert_stride(void);
+void test_color_image_swap_color_order(void);
+void test_color_bitmap_flip(void);
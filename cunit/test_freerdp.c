@@ -35,10 +35,15 @@
 #include "test_cliprdr.h"
 #include "test_drdynvc.h"
 #include "test_librfx.h"
+#include "test_nsc.h"
+#include "test_h264.h"
+#include "test_jpeg.h"
 #include "test_freerdp.h"
 #include "test_rail.h"
 #include "test_pcap.h"
 #include "test_mppc.h"
+#include "test_transport.h"
+#include "test_runtime.h"
 
 void dump_data(unsigned char * p, int len, int width, char* name)
 {
@@ -130,6 +135,11 @@ int main(int argc, char* argv[])
 		add_license_suite();
 		add_stream_suite();
 		add_mppc_suite();
+		add_transport_suite();
+		add_runtime_suite();
+		add_nsc_suite();
+		add_h264_suite();
+		add_jpeg_suite();
 	}
 	else
 	{
@@ -187,6 +197,18 @@ int main(int argc, char* argv[])
 			{
 				add_librfx_suite();
 			}
+			else if (strcmp("nsc", argv[*pindex]) == 0)
+			{
+				add_nsc_suite();
+			}
+			else if (strcmp("h264", argv[*pindex]) == 0)
+			{
+				add_h264_suite();
+			}
+			else if (strcmp("jpeg", argv[*pindex]) == 0)
+			{
+				add_jpeg_suite();
+			}
 			else if (strcmp("per", argv[*pindex]) == 0)
 			{
 				add_per_suite();
@@ -211,6 +233,14 @@ int main(int argc, char* argv[])
 			{
 				add_mppc_suite();
 			}
+			else if (strcmp("transport", argv[*pindex]) == 0)
+			{
+				add_transport_suite();
+			}
+			else if (strcmp("runtime", argv[*pindex]) == 0)
+			{
+				add_runtime_suite();
+			}
 
 			*pindex = *pindex + 1;
 		}
@@ -0,0 +1,153 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * H.264 Codec Unit Tests
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <freerdp/types.h>
+#include <freerdp/utils/memory.h>
+#include <freerdp/utils/cpu.h>
+#include <freerdp/codec/h264.h>
+
+#include "test_h264.h"
+
+/* 4x2: white and red chroma pairs, over white, red, black and mid grey luma */
+static const uint8 h264_y[] = { 235, 235, 81, 81, 16, 16, 126, 126 };
+static const uint8 h264_u[] = { 128, 90 };
+static const uint8 h264_v[] = { 128, 240 };
+
+static const uint8 h264_bgrx[] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+	0x34, 0x35, 0xFF, 0xFF, 0x34, 0x35, 0xFF, 0xFF
+};
+
+int init_h264_suite(void)
+{
+	return 0;
+}
+
+int clean_h264_suite(void)
+{
+	return 0;
+}
+
+int add_h264_suite(void)
+{
+	add_test_suite(h264);
+
+	add_test_function(h264_yuv420_to_bgrx);
+	add_test_function(h264_yuv420_to_bgrx_simd);
+
+	return 0;
+}
+
+void test_h264_yuv420_to_bgrx(void)
+{
+	int i;
+	uint8 dst[4 * 2 * 4];
+	const uint8* planes[3] = { h264_y, h264_u, h264_v };
+	int strides[3] = { 4, 2, 2 };
+	uint32 cpu_opts[] = { 0, CPU_SSE2 };
+	H264_CONTEXT* context;
+
+	context = h264_context_new();
+
+	for (i = 0; i < 2; i++)
+	{
+		if ((cpu_opts[i] & freerdp_detect_cpu()) != cpu_opts[i])
+			continue;
+
+		h264_context_set_cpu_opt(context, cpu_opts[i]);
+		memset(dst, 0, sizeof(dst));
+		context->yuv420_to_bgrx(planes, strides, 0, 0, 4, 2, dst, 16);
+		CU_ASSERT(memcmp(dst, h264_bgrx, sizeof(dst)) == 0);
+
+		/* a rect leaves the pixels around it alone */
+		memset(dst, 0, sizeof(dst));
+		context->yuv420_to_bgrx(planes, strides, 1, 1, 2, 1, dst, 16);
+		CU_ASSERT(memcmp(dst + 16 + 4, h264_bgrx + 16 + 4, 8) == 0);
+		CU_ASSERT(dst[16 + 0] == 0 && dst[16 + 12] == 0 && dst[0] == 0);
+	}
+
+	h264_context_free(context);
+}
+
+/* the SIMD routine, with its unaligned starts and column tails, matches the C one */
+void test_h264_yuv420_to_bgrx_simd(void)
+{
+	int i;
+	int width, height;
+	uint32 pixel;
+	uint8* planes[3];
+	int strides[3];
+	uint8* c_dst;
+	uint8* simd_dst;
+	H264_CONTEXT* context;
+
+	if (!(freerdp_detect_cpu() & CPU_SSE2))
+		return;
+
+	width = 67;
+	height = 6;
+	strides[0] = 72;
+	strides[1] = strides[2] = 40;
+	planes[0] = (uint8*) xmalloc(strides[0] * height);
+	planes[1] = (uint8*) xmalloc(strides[1] * height / 2);
+	planes[2] = (uint8*) xmalloc(strides[2] * height / 2);
+	c_dst = (uint8*) xzalloc(width * height * 4);
+	simd_dst = (uint8*) xzalloc(width * height * 4);
+
+	/* cover the clamped ranges too */
+	pixel = 1;
+
+	for (i = 0; i < strides[0] * height; i++)
+	{
+		pixel = pixel * 1103515245 + 12345;
+		planes[0][i] = pixel >> 16;
+	}
+
+	for (i = 0; i < strides[1] * height / 2; i++)
+	{
+		pixel = pixel * 1103515245 + 12345;
+		planes[1][i] = pixel >> 16;
+		pixel = pixel * 1103515245 + 12345;
+		planes[2][i] = pixel >> 16;
+	}
+
+	context = h264_context_new();
+
+	h264_context_set_cpu_opt(context, 0);
+	context->yuv420_to_bgrx((const uint8* const*) planes, strides, 0, 0, width, 3, c_dst, width * 4);
+	context->yuv420_to_bgrx((const uint8* const*) planes, strides, 3, 3, 61, 3, c_dst, width * 4);
+
+	h264_context_set_cpu_opt(context, CPU_SSE2);
+	context->yuv420_to_bgrx((const uint8* const*) planes, strides, 0, 0, width, 3, simd_dst, width * 4);
+	context->yuv420_to_bgrx((const uint8* const*) planes, strides, 3, 3, 61, 3, simd_dst, width * 4);
+
+	CU_ASSERT(memcmp(c_dst, simd_dst, width * height * 4) == 0);
+
+	h264_context_free(context);
+
+	for (i = 0; i < 3; i++)
+		xfree(planes[i]);
+
+	xfree(c_dst);
+	xfree(simd_dst);
+}
@@ -0,0 +1,337 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * JPEG Codec Unit Tests
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <freerdp/types.h>
+#include <freerdp/utils/memory.h>
+#include <freerdp/utils/stream.h>
+#include <freerdp/codec/jpeg.h>
+
+#include "test_jpeg.h"
+
+/* 16x8 RGB, red = x * 16, green = y * 32, blue = 0x80, quality 95 */
+static uint8 jpeg_sample[] =
+{
+	0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01,
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43,
+	0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x04, 0x03, 0x02, 0x02, 0x02, 0x02, 0x05, 0x04,
+	0x04, 0x03, 0x04, 0x06, 0x05, 0x06, 0x06, 0x06, 0x05, 0x06, 0x06, 0x06,
+	0x07, 0x09, 0x08, 0x06, 0x07, 0x09, 0x07, 0x06, 0x06, 0x08, 0x0B, 0x08,
+	0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x06, 0x08, 0x0B, 0x0C, 0x0B, 0x0A,
+	0x0C, 0x09, 0x0A, 0x0A, 0x0A, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x03, 0x05, 0x0A, 0x07, 0x06, 0x07,
+	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+	0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+	0x0A, 0x0A, 0xFF, 0xC0, 0x00, 0x11, 0x08, 0x00, 0x08, 0x00, 0x10, 0x03,
+	0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xFF, 0xC4, 0x00,
+	0x16, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0xFF, 0xC4, 0x00,
+	0x1C, 0x10, 0x00, 0x01, 0x04, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x09, 0x33, 0x06,
+	0x43, 0x51, 0x26, 0xFF, 0xC4, 0x00, 0x15, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x07, 0xFF, 0xC4, 0x00, 0x1E, 0x11, 0x00, 0x00, 0x06, 0x02, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x07, 0x23, 0x51, 0x61, 0x08, 0x22, 0x24, 0xB1, 0xD1, 0xFF, 0xDA,
+	0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00,
+	0x81, 0xB5, 0x11, 0x53, 0x52, 0x26, 0x37, 0xCD, 0x46, 0x99, 0x6A, 0x22,
+	0xA6, 0xAF, 0x37, 0xCD, 0x40, 0x06, 0x8E, 0x2A, 0x69, 0xBF, 0x67, 0xFB,
+	0xF4, 0x4E, 0x71, 0xB5, 0x62, 0x3E, 0x33, 0xC9, 0x89, 0xAB, 0x1F, 0xFF,
+	0xD9,
+};
+
+int init_jpeg_suite(void)
+{
+	return 0;
+}
+
+int clean_jpeg_suite(void)
+{
+	return 0;
+}
+
+int add_jpeg_suite(void)
+{
+	add_test_suite(jpeg);
+
+#if defined(WITH_JPEG) || defined(WITH_TJPEG)
+	add_test_function(jpeg_decompress);
+	add_test_function(jpeg_decompress_stride);
+	add_test_function(jpeg_decompress_jobs);
+	add_test_function(jpeg_compose_message);
+#endif
+	add_test_function(jpeg_decompress_invalid);
+
+	return 0;
+}
+
+/* chroma is subsampled, so the steep red gradient does not come back exactly */
+static boolean test_jpeg_near(int value, int expected, int tolerance)
+{
+	return (value >= expected - tolerance) && (value <= expected + tolerance);
+}
+
+void test_jpeg_decompress(void)
+{
+	int x, y;
+	uint8 rgb[16 * 8 * 3];
+	uint8 bgrx[16 * 8 * 4];
+	boolean near;
+	JPEG_CONTEXT* context;
+
+	context = jpeg_context_new();
+
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), rgb, 16 * 3, 16, 8, 24));
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), bgrx, 16 * 4, 16, 8, 32));
+
+	near = true;
+
+	for (y = 0; y < 8; y++)
+	{
+		for (x = 0; x < 16; x++)
+		{
+			near = near && test_jpeg_near(rgb[(y * 16 + x) * 3 + 0], x * 16, 16);
+			near = near && test_jpeg_near(rgb[(y * 16 + x) * 3 + 1], y * 32, 16);
+			near = near && test_jpeg_near(rgb[(y * 16 + x) * 3 + 2], 0x80, 16);
+		}
+	}
+
+	CU_ASSERT(near);
+
+	/* both depths come out of the same decoder, in a different byte order */
+	for (x = 0; x < 16 * 8; x++)
+	{
+		if (bgrx[x * 4 + 0] != rgb[x * 3 + 2] || bgrx[x * 4 + 1] != rgb[x * 3 + 1] ||
+			bgrx[x * 4 + 2] != rgb[x * 3 + 0])
+			break;
+	}
+
+	CU_ASSERT(x == 16 * 8);
+
+	/* the faster settings stay close */
+	jpeg_context_set_fast_idct(context, true);
+	jpeg_context_set_fancy_upsampling(context, false);
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), rgb, 16 * 3, 16, 8, 24));
+
+	near = true;
+
+	for (x = 0; x < 16 * 8; x++)
+		near = near && test_jpeg_near(rgb[x * 3 + 0], (x % 16) * 16, 32) && test_jpeg_near(rgb[x * 3 + 1], (x / 16) * 32, 32);
+
+	CU_ASSERT(near);
+
+	/* the one-shot decoder gives the same pixels as a context */
+	memset(rgb, 0, sizeof(rgb));
+	jpeg_context_set_fast_idct(context, false);
+	jpeg_context_set_fancy_upsampling(context, true);
+	CU_ASSERT(jpeg_decompress(jpeg_sample, bgrx, 16, 8, sizeof(jpeg_sample), 24));
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), rgb, 16 * 3, 16, 8, 24));
+	CU_ASSERT(memcmp(rgb, bgrx, sizeof(rgb)) == 0);
+
+	jpeg_context_free(context);
+}
+
+void test_jpeg_decompress_stride(void)
+{
+	int y;
+	uint8 packed[16 * 8 * 4];
+	uint8 padded[(16 * 4 + 12) * 8];
+	JPEG_CONTEXT* context;
+
+	context = jpeg_context_new();
+
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), packed, 16 * 4, 16, 8, 32));
+
+	/* rows further apart, padding untouched */
+	memset(padded, 0xAA, sizeof(padded));
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), padded, 16 * 4 + 12, 16, 8, 32));
+
+	for (y = 0; y < 8; y++)
+	{
+		CU_ASSERT(memcmp(&padded[y * (16 * 4 + 12)], &packed[y * 16 * 4], 16 * 4) == 0);
+		CU_ASSERT(padded[y * (16 * 4 + 12) + 16 * 4] == 0xAA);
+	}
+
+	/* bottom-up */
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample),
+		&padded[7 * 16 * 4], -16 * 4, 16, 8, 32));
+
+	for (y = 0; y < 8; y++)
+		CU_ASSERT(memcmp(&padded[(7 - y) * 16 * 4], &packed[y * 16 * 4], 16 * 4) == 0);
+
+	jpeg_context_free(context);
+}
+
+void test_jpeg_decompress_invalid(void)
+{
+	uint8 garbage[64];
+	uint8 bgrx[16 * 8 * 4];
+	JPEG_CONTEXT* context;
+
+	memset(garbage, 0x5A, sizeof(garbage));
+	context = jpeg_context_new();
+
+	CU_ASSERT(!jpeg_context_decompress(context, garbage, sizeof(garbage), bgrx, 16 * 4, 16, 8, 32));
+	CU_ASSERT(!jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), bgrx, 8 * 4, 8, 8, 32));
+	CU_ASSERT(!jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), bgrx, 16 * 2, 16, 8, 16));
+
+#if defined(WITH_JPEG) || defined(WITH_TJPEG)
+	/* the decoder is still usable after an error */
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), bgrx, 16 * 4, 16, 8, 32));
+#endif
+
+	jpeg_context_free(context);
+}
+
+void test_jpeg_decompress_jobs(void)
+{
+	int i;
+	uint8 garbage[64];
+	uint8 expected[16 * 8 * 4];
+	uint8* outputs;
+	JPEG_JOB jobs[9];
+	JPEG_CONTEXT* context;
+
+	memset(garbage, 0x5A, sizeof(garbage));
+	context = jpeg_context_new();
+
+	CU_ASSERT(jpeg_context_decompress(context, jpeg_sample, sizeof(jpeg_sample), expected, 16 * 4, 16, 8, 32));
+
+	jpeg_context_set_thread_count(context, 3);
+	outputs = (uint8*) xzalloc(9 * sizeof(expected));
+
+	for (i = 0; i < 9; i++)
+	{
+		jobs[i].input = (i == 4) ? garbage : jpeg_sample;
+		jobs[i].size = (i == 4) ? sizeof(garbage) : sizeof(jpeg_sample);
+		jobs[i].output = outputs + i * sizeof(expected);
+		jobs[i].stride = 16 * 4;
+		jobs[i].width = 16;
+		jobs[i].height = 8;
+		jobs[i].bpp = 32;
+	}
+
+	CU_ASSERT(jpeg_context_decompress_jobs(context, jobs, 9) == 8);
+
+	for (i = 0; i < 9; i++)
+	{
+		CU_ASSERT(jobs[i].success == (i != 4));
+
+		if (i != 4)
+			CU_ASSERT(memcmp(jobs[i].output, expected, sizeof(expected)) == 0);
+	}
+
+	xfree(outputs);
+	jpeg_context_free(context);
+}
+
+/* mean absolute error of the colour channels */
+static int test_jpeg_error(const uint8* a, const uint8* b, int pixels)
+{
+	int i, j;
+	int sum;
+
+	for (i = 0, sum = 0; i < pixels; i++)
+	{
+		for (j = 0; j < 3; j++)
+			sum += abs(a[i * 4 + j] - b[i * 4 + j]);
+	}
+
+	return sum / (pixels * 3);
+}
+
+void test_jpeg_compose_message(void)
+{
+	int x, y;
+	int low_length;
+	int high_length;
+	int low_error;
+	int high_error;
+	int rowstride;
+	STREAM* s;
+	STREAM* flipped_s;
+	uint8* image;
+	uint8* flipped;
+	uint8 packed[64 * 32 * 4];
+	uint8 decoded[64 * 32 * 4];
+	JPEG_CONTEXT* context;
+
+	/* padded rows, as in an XShm capture */
+	rowstride = 64 * 4 + 32;
+	image = (uint8*) xzalloc(rowstride * 32);
+	flipped = (uint8*) xzalloc(rowstride * 32);
+
+	for (y = 0; y < 32; y++)
+	{
+		for (x = 0; x < 64; x++)
+		{
+			packed[(y * 64 + x) * 4 + 0] = x * 4;
+			packed[(y * 64 + x) * 4 + 1] = y * 8;
+			packed[(y * 64 + x) * 4 + 2] = (x + y) * 2;
+			packed[(y * 64 + x) * 4 + 3] = 0xFF;
+		}
+
+		memcpy(&image[y * rowstride], &packed[y * 64 * 4], 64 * 4);
+		memcpy(&flipped[(31 - y) * rowstride], &packed[y * 64 * 4], 64 * 4);
+	}
+
+	context = jpeg_context_new();
+	s = stream_new(16);
+
+	/* header_bytes, no header, then the image */
+	jpeg_context_set_quality(context, 20);
+	CU_ASSERT(jpeg_compose_message(context, s, image, 64, 32, rowstride));
+	low_length = stream_get_length(s);
+	CU_ASSERT(s->data[0] == 0 && s->data[1] == 0);
+	CU_ASSERT(s->data[2] == 0xFF && s->data[3] == 0xD8);
+	CU_ASSERT(jpeg_context_decompress(context, s->data + 2, low_length - 2, decoded, 64 * 4, 64, 32, 32));
+	low_error = test_jpeg_error(decoded, packed, 64 * 32);
+
+	/* the quality knob trades size for accuracy */
+	stream_set_pos(s, 0);
+	jpeg_context_set_quality(context, 95);
+	CU_ASSERT(jpeg_compose_message(context, s, image, 64, 32, rowstride));
+	high_length = stream_get_length(s);
+	CU_ASSERT(jpeg_context_decompress(context, s->data + 2, high_length - 2, decoded, 64 * 4, 64, 32, 32));
+	high_error = test_jpeg_error(decoded, packed, 64 * 32);
+
+	CU_ASSERT(high_length > low_length);
+	CU_ASSERT(high_error <= low_error);
+	CU_ASSERT(high_error <= 3);
+
+	/* bottom-up input encodes to the same image */
+	flipped_s = stream_new(16);
+	CU_ASSERT(jpeg_compose_message(context, flipped_s, &flipped[31 * rowstride], 64, 32, -rowstride));
+	CU_ASSERT(stream_get_length(flipped_s) == high_length);
+	CU_ASSERT(memcmp(flipped_s->data, s->data, high_length) == 0);
+
+	/* appended to what is already in the stream, nothing written on failure */
+	CU_ASSERT(!jpeg_compose_message(context, s, image, 0, 32, rowstride));
+	CU_ASSERT(stream_get_length(s) == high_length);
+
+	stream_free(flipped_s);
+	stream_free(s);
+	jpeg_context_free(context);
+	xfree(image);
+	xfree(flipped);
+}
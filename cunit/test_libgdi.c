@@ -72,6 +72,7 @@ int add_libgdi_suite(void)
 	add_test_function(gdi_BitBlt_32bpp);
 	add_test_function(gdi_BitBlt_16bpp);
 	add_test_function(gdi_BitBlt_8bpp);
+	add_test_function(gdi_BitBlt_bottom_up);
 	add_test_function(gdi_ClipCoords);
 	add_test_function(gdi_InvalidateRegion);
 
@@ -1531,6 +1532,7 @@ void test_gdi_LineTo(void)
 	clrconv = (HCLRCONV) malloc(sizeof(CLRCONV));
 	clrconv->alpha = 1;
 	clrconv->invert = 0;
+	clrconv->rgb555 = 0;
 	clrconv->palette = hPalette;
 
 	data = (uint8*) freerdp_image_convert((uint8*) line_to_case_1, NULL, 16, 16, 8, bitsPerPixel, clrconv);
@@ -1849,6 +1851,7 @@ void test_gdi_Ellipse(void)
 	clrconv = (HCLRCONV) malloc(sizeof(CLRCONV));
 	clrconv->alpha = 1;
 	clrconv->invert = 0;
+	clrconv->rgb555 = 0;
 	clrconv->palette = hPalette;
 
 	data = (uint8*) freerdp_image_convert((uint8*) ellipse_case_1, NULL, 16, 16, 8, bitsPerPixel, clrconv);
@@ -2007,6 +2010,7 @@ void test_gdi_BitBlt_32bpp(void)
 	clrconv = (HCLRCONV) malloc(sizeof(CLRCONV));
 	clrconv->alpha = 1;
 	clrconv->invert = 0;
+	clrconv->rgb555 = 0;
 	clrconv->palette = hPalette;
 
 	data = (uint8*) freerdp_image_convert((uint8*) bmp_SRC, NULL, 16, 16, 8, bitsPerPixel, clrconv);
@@ -2261,6 +2265,7 @@ void test_gdi_BitBlt_16bpp(void)
 	clrconv = (HCLRCONV) malloc(sizeof(CLRCONV));
 	clrconv->alpha = 1;
 	clrconv->invert = 0;
+	clrconv->rgb555 = 0;
 	clrconv->palette = hPalette;
 
 	data = (uint8*) freerdp_image_convert((uint8*) bmp_SRC, NULL, 16, 16, 8, bitsPerPixel, clrconv);
@@ -2515,6 +2520,7 @@ void test_gdi_BitBlt_8bpp(void)
 	clrconv = (HCLRCONV) malloc(sizeof(CLRCONV));
 	clrconv->alpha = 1;
 	clrconv->invert = 0;
+	clrconv->rgb555 = 0;
 	clrconv->palette = hPalette;
 
 	data = (uint8*) freerdp_image_convert((uint8*) bmp_SRC, NULL, 16, 16, 8, bitsPerPixel, clrconv);
@@ -2724,6 +2730,56 @@ void test_gdi_BitBlt_8bpp(void)
 	CU_ASSERT(CompareBitmaps(hBmpDst, hBmp_SPna) == 1)
 }
 
+void test_gdi_BitBlt_bottom_up(void)
+{
+	int i, x, y;
+	uint32* dst;
+	uint32* pixels;
+	HGDI_DC hdcSrc;
+	HGDI_DC hdcDst;
+	HGDI_BITMAP hBmpSrc;
+	HGDI_BITMAP hBmpDst;
+
+	hdcSrc = gdi_GetDC();
+	hdcSrc->bytesPerPixel = 4;
+	hdcSrc->bitsPerPixel = 32;
+
+	hdcDst = gdi_GetDC();
+	hdcDst->bytesPerPixel = 4;
+	hdcDst->bitsPerPixel = 32;
+
+	pixels = (uint32*) malloc(8 * 6 * 4);
+
+	for (i = 0; i < 8 * 6; i++)
+		pixels[i] = 0xFF000000 | i;
+
+	/* rows stored bottom row first, data points to the top row */
+	hBmpSrc = gdi_CreateBitmap(8, 6, 32, (uint8*) &pixels[5 * 8]);
+	hBmpSrc->scanline = -8 * 4;
+	gdi_SelectObject(hdcSrc, (HGDIOBJECT) hBmpSrc);
+
+	hBmpDst = gdi_CreateCompatibleBitmap(hdcDst, 8, 6);
+	gdi_SelectObject(hdcDst, (HGDIOBJECT) hBmpDst);
+
+	gdi_BitBlt(hdcDst, 0, 0, 8, 6, hdcSrc, 0, 0, GDI_SRCCOPY);
+
+	dst = (uint32*) hBmpDst->data;
+
+	for (y = 0; y < 6; y++)
+	{
+		for (x = 0; x < 8; x++)
+			CU_ASSERT(dst[y * 8 + x] == pixels[(5 - y) * 8 + x]);
+	}
+
+	CU_ASSERT(gdi_GetPixel(hdcSrc, 3, 0) == pixels[5 * 8 + 3]);
+
+	hBmpSrc->data = (uint8*) pixels;
+	gdi_DeleteObject((HGDIOBJECT) hBmpSrc);
+	gdi_DeleteObject((HGDIOBJECT) hBmpDst);
+	gdi_DeleteDC(hdcSrc);
+	gdi_DeleteDC(hdcDst);
+}
+
 void test_gdi_ClipCoords(void)
 {
 	HGDI_DC hdc;
@@ -2871,6 +2927,7 @@ void test_gdi_InvalidateRegion(void)
 	
 	hdc->hwnd->count = 16;
 	hdc->hwnd->cinvalid = (HGDI_RGN) malloc(sizeof(GDI_RGN) * hdc->hwnd->count);
+	hdc->hwnd->ninvalid = 0;
 
 	rgn1 = gdi_CreateRectRgn(0, 0, 0, 0);
 	rgn2 = gdi_CreateRectRgn(0, 0, 0, 0);
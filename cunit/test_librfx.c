@@ -17,11 +17,6 @@
  * limitations under the License.
  */
 
-/**
- * The sample data comes from [MS-RDPRFX] 4.2.3, which is decoded into three
- * vertical bands in red (21x64), green (23x64) and blue(20x64) color.
- */
-
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -29,6 +24,7 @@
 #include <freerdp/utils/print.h>
 #include <freerdp/utils/memory.h>
 #include <freerdp/utils/hexdump.h>
+#include <freerdp/utils/cpu.h>
 #include <freerdp/codec/rfx.h>
 #include "rfx_types.h"
 #include "rfx_bitstream.h"
@@ -40,122 +36,7 @@
 #include "rfx_encode.h"
 
 #include "test_librfx.h"
-
-static const uint8 y_data[] =
-{
-	                  0x19, 0x82, 0x1d, 0x10, 0x62, 0x9d, 0x28, 0x85, 0x2c, 0xa2, 0x14, 0xb2, 0x88,
-	0x52, 0xca, 0x21, 0x4b, 0x28, 0x85, 0x2c, 0xa2, 0x14, 0xb2, 0x88, 0x52, 0xca, 0x21, 0x4b, 0x28,
-	0x85, 0x2c, 0xa2, 0x14, 0xb2, 0x88, 0x52, 0xca, 0x21, 0x4b, 0x28, 0x85, 0x2c, 0xa2, 0x14, 0xb2,
-	0x88, 0x52, 0xca, 0x21, 0x4b, 0x28, 0x85, 0x2c, 0xa2, 0x14, 0xb2, 0x88, 0x52, 0xca, 0x21, 0x4b,
-	0x28, 0x85, 0x2c, 0xa2, 0x14, 0xb2, 0x88, 0x52, 0xca, 0x21, 0x4b, 0x28, 0x85, 0x2c, 0xa2, 0x14,
-	0xb2, 0x88, 0x52, 0xca, 0x21, 0x4b, 0x28, 0x85, 0x2c, 0xa2, 0x14, 0xb0, 0x00, 0x20, 0xf4, 0x40,
-	0x0c, 0xc1, 0x1e, 0x20, 0x26, 0x22, 0x20, 0x33, 0x23, 0xc4, 0x23, 0x88, 0x86, 0x50, 0xf1, 0x22,
-	0x68, 0x4c, 0x91, 0x85, 0x10, 0x34, 0x4c, 0x84, 0x78, 0xa2, 0x0d, 0x13, 0x21, 0x1e, 0x29, 0x06,
-	0x89, 0x90, 0x8f, 0x14, 0x83, 0x44, 0xf4, 0x23, 0xc5, 0x20, 0xd1, 0x3d, 0x08, 0xf1, 0x48, 0x34,
-	0x4f, 0x42, 0x3c, 0x52, 0x0d, 0x13, 0xd0, 0x8f, 0x14, 0x83, 0x44, 0xf4, 0x23, 0xc5, 0x20, 0xd1,
-	0x3d, 0x08, 0xf1, 0x48, 0x34, 0x4f, 0x42, 0x3c, 0x52, 0x0d, 0x13, 0xd0, 0x8f, 0x14, 0x83, 0x44,
-	0xf4, 0x23, 0xc5, 0x20, 0x00, 0x08, 0x47, 0x70, 0x15, 0x02, 0xe0, 0x7f, 0xe4, 0x9d, 0xc2, 0x51,
-	0x71, 0xf4, 0x99, 0xc9, 0x57, 0xff, 0x32, 0x87, 0x9d, 0x17, 0xd6, 0x50, 0x6e, 0x06, 0x2f, 0xac,
-	0xa0, 0x9c, 0x0c, 0x5f, 0x59, 0x41, 0x38, 0x18, 0xbe, 0xb2, 0x82, 0x70, 0x31, 0x7d, 0x65, 0x00,
-	0x00, 0x10, 0xff, 0x9c, 0x33, 0x41, 0xf1, 0xc4, 0xb0, 0x3c, 0xff, 0xa2, 0x15, 0xbd, 0x7b, 0xea,
-	0x86, 0x9b, 0x5f, 0xfc, 0x78, 0x8c, 0xf5, 0xed, 0xa8, 0x68, 0xda, 0xfd, 0x3c, 0x45, 0x7a, 0xf4,
-	0xd4, 0x34, 0x6d, 0x7e, 0x9e, 0x22, 0xbd, 0x7a, 0x6a, 0x1a, 0x36, 0xbf, 0x4f, 0x11, 0x5e, 0xbd,
-	0x35, 0x0d, 0x1b, 0x5f, 0xa7, 0x88, 0xaf, 0x5e, 0x9a, 0x86, 0x8d, 0xaf, 0xd3, 0xc4, 0x57, 0xaf,
-	0x4d, 0x43, 0x46, 0xd7, 0xe9, 0xe2, 0x20, 0x30, 0x00
-};
-
-static const uint8 cb_data[] =
-{
-	                                                      0x1b, 0x04, 0x7f, 0x04, 0x31, 0x5f, 0xc2,
-	0x94, 0xaf, 0x05, 0x29, 0x5e, 0x0a, 0x52, 0xbc, 0x14, 0xa5, 0x78, 0x29, 0x25, 0x78, 0x29, 0x25,
-	0x78, 0x29, 0x25, 0x68, 0x52, 0x4a, 0xf0, 0x52, 0x4a, 0xf0, 0x52, 0x4a, 0xd0, 0xa4, 0x95, 0xe0,
-	0xa4, 0x95, 0xe0, 0xa4, 0x95, 0xa1, 0x49, 0x2b, 0xc1, 0x49, 0x2b, 0xc1, 0x49, 0x2b, 0x42, 0x92,
-	0x57, 0x82, 0x92, 0x57, 0x82, 0x92, 0x56, 0x85, 0x24, 0xaf, 0x05, 0x24, 0xaf, 0x05, 0x24, 0xad,
-	0x0a, 0x49, 0x5e, 0x0a, 0x49, 0x5e, 0x0a, 0x49, 0x5a, 0x14, 0x92, 0xbc, 0x14, 0x92, 0xbc, 0x14,
-	0x92, 0xb4, 0x29, 0x25, 0x78, 0x29, 0x25, 0x78, 0x00, 0x02, 0x0f, 0x02, 0x00, 0xac, 0x13, 0xfc,
-	0xc0, 0x0a, 0x20, 0x10, 0x2b, 0x27, 0xf9, 0x80, 0xb0, 0x08, 0xaa, 0x3d, 0x60, 0x8c, 0x0b, 0x24,
-	0xff, 0x30, 0x80, 0xc0, 0xaa, 0x13, 0xfc, 0xc2, 0x03, 0x05, 0x90, 0x9f, 0xe6, 0x10, 0x18, 0x2c,
-	0x84, 0xff, 0x30, 0x81, 0x82, 0xc8, 0x4f, 0xf3, 0x08, 0x18, 0x2c, 0x84, 0xff, 0x31, 0x03, 0x05,
-	0x90, 0x9f, 0xff, 0xd8, 0x40, 0x60, 0x59, 0x09, 0xfe, 0x61, 0x01, 0x81, 0x64, 0x27, 0xf9, 0x84,
-	0x06, 0x0b, 0x21, 0x3f, 0xcc, 0x20, 0x30, 0x59, 0x09, 0xfe, 0x61, 0x03, 0x05, 0x90, 0x9f, 0xe6,
-	0x10, 0x30, 0x59, 0x09, 0xfe, 0x62, 0x00, 0x00, 0x42, 0x15, 0x00, 0x10, 0x15, 0x01, 0xfe, 0x20,
-	0x84, 0xd5, 0x01, 0x0a, 0x8f, 0xf1, 0x40, 0x33, 0x78, 0x17, 0xf9, 0xc2, 0x03, 0x83, 0x01, 0x78,
-	0xe1, 0x01, 0xc1, 0x00, 0xbc, 0x70, 0x80, 0xe0, 0x80, 0x5e, 0x38, 0x40, 0x70, 0x40, 0x2f, 0x1c,
-	0x20, 0x38, 0x20, 0x17, 0x8e, 0x10, 0x00, 0x00, 0x87, 0xd5, 0x08, 0x70, 0xef, 0x81, 0xa2, 0xd8,
-	0xff, 0xff, 0xff, 0xfb, 0xd1, 0x2d, 0x4e, 0xa6, 0xce, 0x20, 0xa4, 0xef, 0x05, 0x78, 0x35, 0x3a,
-	0x9b, 0x38, 0x82, 0x93, 0xbc, 0x15, 0xe0, 0xd4, 0xea, 0x66, 0x71, 0x05, 0x27, 0x78, 0x2b, 0xc1,
-	0x29, 0xd4, 0xcc, 0xe2, 0x0a, 0x4e, 0xf0, 0x57, 0x82, 0x53, 0xa9, 0x99, 0xc4, 0x14, 0x9d, 0xe0,
-	0xaf, 0x04, 0xa7, 0x53, 0x33, 0x88, 0x29, 0x3b, 0xc1, 0x5e, 0x09, 0x4e, 0xa6, 0x67, 0x10, 0x52,
-	0x77, 0x82, 0xbc, 0x00, 0x18, 0x00
-};
-
-static const uint8 cr_data[] =
-{
-	                                    0x1b, 0xfc, 0x11, 0xc1, 0x0f, 0x4a, 0xc1, 0x4f, 0x4a, 0xc1,
-	0x4f, 0x4a, 0xa1, 0x4d, 0x95, 0x42, 0x9e, 0x95, 0x42, 0x9e, 0x95, 0x42, 0x9b, 0x2a, 0x85, 0x3d,
-	0x2a, 0x85, 0x3d, 0x2a, 0x85, 0x36, 0x55, 0x0a, 0x7a, 0x55, 0x0a, 0x7a, 0x55, 0x0a, 0x6c, 0xaa,
-	0x14, 0xf4, 0xaa, 0x14, 0xf4, 0xaa, 0x14, 0xd9, 0x54, 0x29, 0xe9, 0x54, 0x29, 0xe9, 0x54, 0x29,
-	0xb2, 0xa8, 0x53, 0xd2, 0xa8, 0x53, 0xd2, 0xa8, 0x53, 0x65, 0x50, 0xa7, 0xa5, 0x50, 0xa7, 0xa5,
-	0x50, 0xa6, 0xca, 0xa1, 0x4f, 0x4a, 0xa1, 0x4f, 0x4a, 0xa1, 0x4d, 0x95, 0x42, 0x9e, 0x95, 0x42,
-	0x9e, 0x95, 0x42, 0x9b, 0x2a, 0x80, 0x00, 0x41, 0xe3, 0x80, 0x3f, 0xe2, 0x09, 0x9c, 0x00, 0x22,
-	0x07, 0x03, 0xe1, 0x26, 0x70, 0x06, 0x07, 0x1f, 0x04, 0x67, 0x00, 0x61, 0xdf, 0x02, 0x67, 0x00,
-	0x0c, 0x3b, 0xfe, 0x01, 0x33, 0x80, 0x06, 0x1d, 0xff, 0x00, 0x99, 0xc0, 0x03, 0x0e, 0xff, 0x80,
-	0x4c, 0xe0, 0x01, 0x87, 0x7f, 0xc0, 0x26, 0x70, 0x00, 0xc3, 0xbf, 0xe0, 0x13, 0x38, 0x00, 0x61,
-	0xdf, 0xf0, 0x09, 0x9c, 0x00, 0x30, 0xef, 0xf8, 0x04, 0xce, 0x00, 0x18, 0x77, 0xfc, 0x02, 0x67,
-	0x00, 0x0c, 0x3b, 0xfe, 0x01, 0x33, 0x80, 0x06, 0x1d, 0xff, 0x00, 0x99, 0xc0, 0x03, 0x0e, 0xff,
-	0x80, 0x4c, 0xe0, 0x01, 0x87, 0x7f, 0xc0, 0x26, 0x70, 0x00, 0x00, 0x08, 0x3c, 0x20, 0x1f, 0xf1,
-	0x00, 0xf0, 0x05, 0x02, 0x93, 0x84, 0x3d, 0x20, 0xf0, 0x52, 0x81, 0xc7, 0xff, 0xff, 0xea, 0x54,
-	0x01, 0x80, 0x05, 0xf5, 0x4a, 0x80, 0x30, 0x00, 0xb6, 0xa5, 0x40, 0x18, 0x00, 0x5f, 0x54, 0xa8,
-	0x03, 0x00, 0x0b, 0xea, 0x95, 0x00, 0x60, 0x01, 0x6d, 0x4a, 0x80, 0x30, 0x00, 0x00, 0x22, 0x3f,
-	0xba, 0x08, 0x10, 0x2b, 0x1f, 0xf2, 0x20, 0x3e, 0x49, 0x9c, 0x1f, 0x6e, 0x0f, 0x5a, 0x0f, 0xfb,
-	0x18, 0x46, 0xae, 0x27, 0x9b, 0x83, 0xcb, 0x41, 0xf3, 0x18, 0x46, 0xae, 0x27, 0x9b, 0x83, 0xc5,
-	0xa0, 0xf9, 0x8c, 0x22, 0xd7, 0x13, 0x8d, 0xc1, 0xe2, 0xd0, 0x7c, 0xc6, 0x11, 0x6b, 0x89, 0xc6,
-	0xe0, 0xf1, 0x68, 0x3e, 0x63, 0x08, 0xb5, 0xc4, 0xe3, 0x70, 0x78, 0xb4, 0x1f, 0x31, 0x84, 0x5a,
-	0xe2, 0x71, 0xb8, 0x3c, 0x5a, 0x0f, 0x98, 0xc2, 0x2d, 0x71, 0x30, 0x83, 0xc0, 0x00
-};
-
-/* HL1, LH1, HH1, HL2, LH2, HH2, HL3, LH3, HH3, LL3 */
-static const unsigned int test_quantization_values[] =
-{
-	6, 6, 6, 6, 7, 7, 8, 8, 8, 9
-};
-
-static const uint8 rgb_scanline_data[] =
-{
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
-	0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
-	0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF
-};
+#include "test_librfx_data.h"
 
 static uint8* rgb_data;
 
@@ -176,12 +57,22 @@ int add_librfx_suite(void)
 	add_test_function(bitstream);
 	add_test_function(bitstream_enc);
 	add_test_function(rlgr);
+	add_test_function(rlgr_roundtrip);
 	add_test_function(differential);
 	add_test_function(quantization);
 	add_test_function(dwt);
 	add_test_function(decode);
 	add_test_function(encode);
 	add_test_function(message);
+	add_test_function(message_threaded);
+	add_test_function(encode_threaded);
+	add_test_function(message_surface);
+	add_test_function(encode_tile_cache);
+	add_test_function(rate_control);
+	add_test_function(rate_control_tile_cache);
+	add_test_function(message_no_alloc);
+	add_test_function(avx2);
+	add_test_function(encode_fused);
 
 	return 0;
 }
@@ -251,6 +142,51 @@ void test_rlgr(void)
 	//dump_buffer(buffer, n);
 }
 
+void test_rlgr_roundtrip(void)
+{
+	int i, j;
+	int size;
+	int mode;
+	uint8 encoded[16384];
+	static sint16 input[4096];
+	static sint16 output[4096];
+
+	srand(2);
+
+	for (i = 0; i < 64; i++)
+	{
+		mode = (i & 1) ? RLGR1 : RLGR3;
+
+		/* alternate between sparse tiles, dense tiles and long zero runs */
+		for (j = 0; j < 4096; j++)
+		{
+			switch (i % 3)
+			{
+				case 0:
+					input[j] = (rand() % 8 == 0) ? (rand() % 81) - 40 : 0;
+					break;
+				case 1:
+					input[j] = (rand() % 4001) - 2000;
+					break;
+				default:
+					input[j] = (j % 1000 == 999) ? (rand() % 11) - 5 : 0;
+					break;
+			}
+		}
+
+		/* a trailing zero reached in RL mode is coded as a magnitude of 1, keep it out */
+		if (input[4095] == 0)
+			input[4095] = 1;
+
+		size = rfx_rlgr_encode(mode, input, 4096, encoded, sizeof(encoded));
+		CU_ASSERT(size > 0 && size < sizeof(encoded));
+
+		memset(output, 0x55, sizeof(output));
+		CU_ASSERT(rfx_rlgr_decode(mode, encoded, size, output, 4096) == 4096);
+		CU_ASSERT(memcmp(input, output, sizeof(input)) == 0);
+	}
+}
+
 void test_differential(void)
 {
 	rfx_differential_decode(buffer + 4032, 64);
@@ -268,7 +204,7 @@ void test_dwt(void)
 	RFX_CONTEXT* context;
 
 	context = rfx_context_new();
-	rfx_dwt_2d_decode(buffer, context->priv->dwt_buffer);
+	rfx_dwt_2d_decode(buffer, context->priv->scratch.dwt_buffer);
 	//dump_buffer(buffer, 4096);
 	rfx_context_free(context);
 }
@@ -341,7 +277,7 @@ void test_encode(void)
 	rfx_encode_rgb(context, rgb_data, 64, 64, 64 * 3,
 		test_quantization_values, test_quantization_values, test_quantization_values,
 		enc_stream, &y_size, &cb_size, &cr_size);
-	//dump_buffer(context->priv->cb_g_buffer, 4096);
+	//dump_buffer(context->priv->scratch.cb_g_buffer, 4096);
 
 	/*printf("*** Y ***\n");
 	freerdp_hexdump(stream_get_head(enc_stream), y_size);
@@ -408,3 +344,725 @@ void test_message(void)
 	rfx_context_free(context);
 	free(rgb_data);
 }
+
+void test_message_threaded(void)
+{
+	int i, j;
+	STREAM* s;
+	RFX_CONTEXT* context;
+	RFX_MESSAGE* message;
+	RFX_MESSAGE* threaded_message;
+	RFX_RECT rect = {0, 0, 300, 200};
+
+	rgb_data = (uint8 *) malloc(300 * 200 * 3);
+	for (i = 0; i < 200 * 300 * 3; i++)
+		rgb_data[i] = rgb_scanline_data[i % sizeof(rgb_scanline_data)] ^ (i / 1024);
+
+	context = rfx_context_new();
+	context->mode = RLGR3;
+	context->width = 800;
+	context->height = 600;
+	rfx_context_set_pixel_format(context, RFX_PIXEL_FORMAT_RGB);
+
+	s = stream_new(65536);
+	stream_clear(s);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	stream_seal(s);
+
+	message = rfx_process_message(context, s->data, s->size);
+
+	rfx_context_set_thread_count(context, 4);
+	threaded_message = rfx_process_message(context, s->data, s->size);
+
+	CU_ASSERT(message->num_tiles == 20);
+	CU_ASSERT(threaded_message->num_tiles == message->num_tiles);
+
+	for (j = 0; j < message->num_tiles; j++)
+	{
+		CU_ASSERT(threaded_message->tiles[j]->x == message->tiles[j]->x);
+		CU_ASSERT(threaded_message->tiles[j]->y == message->tiles[j]->y);
+		CU_ASSERT(memcmp(threaded_message->tiles[j]->data, message->tiles[j]->data, 4096 * 3) == 0);
+	}
+
+	rfx_message_free(context, threaded_message);
+	rfx_message_free(context, message);
+
+	rfx_context_free(context);
+	stream_free(s);
+	free(rgb_data);
+}
+
+void test_encode_threaded(void)
+{
+	int i;
+	STREAM* s;
+	STREAM* threaded_s;
+	RFX_CONTEXT* context;
+	RFX_CONTEXT* threaded_context;
+	RFX_RECT rect = {0, 0, 300, 200};
+
+	rgb_data = (uint8 *) malloc(300 * 200 * 3);
+	for (i = 0; i < 200 * 300 * 3; i++)
+		rgb_data[i] = rgb_scanline_data[i % sizeof(rgb_scanline_data)] ^ (i / 1024);
+
+	context = rfx_context_new();
+	context->mode = RLGR3;
+	context->width = 800;
+	context->height = 600;
+	rfx_context_set_pixel_format(context, RFX_PIXEL_FORMAT_RGB);
+
+	threaded_context = rfx_context_new();
+	threaded_context->mode = RLGR3;
+	threaded_context->width = 800;
+	threaded_context->height = 600;
+	rfx_context_set_pixel_format(threaded_context, RFX_PIXEL_FORMAT_RGB);
+	rfx_context_set_thread_count(threaded_context, 3);
+
+	s = stream_new(1024);
+	threaded_s = stream_new(1024);
+
+	/* the second frame reuses the per-tile buffers of the first one */
+	for (i = 0; i < 2; i++)
+	{
+		stream_set_pos(s, 0);
+		stream_set_pos(threaded_s, 0);
+
+		rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+		rfx_compose_message(threaded_context, threaded_s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+
+		CU_ASSERT(stream_get_length(threaded_s) == stream_get_length(s));
+		CU_ASSERT(memcmp(stream_get_head(threaded_s), stream_get_head(s), stream_get_length(s)) == 0);
+	}
+
+	rfx_context_free(threaded_context);
+	rfx_context_free(context);
+	stream_free(threaded_s);
+	stream_free(s);
+	free(rgb_data);
+}
+
+static void blit_message_clipped(RFX_MESSAGE* message, uint8* dst, int width, int height,
+	int dest_left, int dest_top)
+{
+	int i, j, x, y;
+	int left, top, right, bottom;
+	RFX_TILE* tile;
+	RFX_RECT* rect;
+
+	for (i = 0; i < message->num_tiles; i++)
+	{
+		tile = message->tiles[i];
+
+		for (j = 0; j < message->num_rects; j++)
+		{
+			rect = &message->rects[j];
+
+			left = MAX(MAX(rect->x, tile->x) + dest_left, 0);
+			top = MAX(MAX(rect->y, tile->y) + dest_top, 0);
+			right = MIN(MIN(rect->x + rect->width, tile->x + 64) + dest_left, width);
+			bottom = MIN(MIN(rect->y + rect->height, tile->y + 64) + dest_top, height);
+
+			for (y = top; y < bottom; y++)
+			{
+				for (x = left; x < right; x++)
+				{
+					memcpy(dst + (y * width + x) * 4,
+						tile->data + ((y - dest_top - tile->y) * 64 + (x - dest_left - tile->x)) * 4, 4);
+				}
+			}
+		}
+	}
+}
+
+void test_message_surface(void)
+{
+	int i;
+	STREAM* s;
+	uint8* ref_surface;
+	uint8* surface;
+	RFX_CONTEXT* context;
+	RFX_MESSAGE* message;
+	RFX_RECT rects[2] = { { 10, 5, 150, 70 }, { 120, 100, 180, 100 } };
+
+	rgb_data = (uint8 *) malloc(300 * 200 * 3);
+	for (i = 0; i < 200 * 300 * 3; i++)
+		rgb_data[i] = rgb_scanline_data[i % sizeof(rgb_scanline_data)] ^ (i / 1024);
+
+	/* the surface is narrower than the frame, so the second rect is clipped */
+	ref_surface = (uint8*) malloc(280 * 230 * 4);
+	surface = (uint8*) malloc(280 * 230 * 4);
+	memset(ref_surface, 0x5A, 280 * 230 * 4);
+
+	context = rfx_context_new();
+	context->mode = RLGR3;
+	context->width = 800;
+	context->height = 600;
+	rfx_context_set_pixel_format(context, RFX_PIXEL_FORMAT_BGRA);
+
+	s = stream_new(65536);
+	stream_clear(s);
+	rfx_compose_message(context, s, rects, 2, rgb_data, 300, 200, 300 * 3);
+	stream_seal(s);
+
+	message = rfx_process_message(context, s->data, s->size);
+	blit_message_clipped(message, ref_surface, 280, 230, 20, 18);
+	rfx_message_free(context, message);
+
+	for (i = 0; i < 2; i++)
+	{
+		if (i == 1)
+			rfx_context_set_thread_count(context, 3);
+
+		memset(surface, 0x5A, 280 * 230 * 4);
+		message = rfx_process_message_to_surface(context, s->data, s->size,
+			surface, 280 * 4, RFX_PIXEL_FORMAT_BGRA, 280, 230, 20, 18);
+
+		CU_ASSERT(message != NULL);
+		CU_ASSERT(message->num_rects == 2);
+		CU_ASSERT(message->num_tiles == 0);
+		CU_ASSERT(memcmp(surface, ref_surface, 280 * 230 * 4) == 0);
+
+		rfx_message_free(context, message);
+	}
+
+	CU_ASSERT(rfx_process_message_to_surface(context, s->data, s->size,
+		surface, 280 * 2, RFX_PIXEL_FORMAT_RGB565_LE, 280, 230, 0, 0) == NULL);
+
+	rfx_context_free(context);
+	stream_free(s);
+	free(surface);
+	free(ref_surface);
+	free(rgb_data);
+}
+
+void test_encode_tile_cache(void)
+{
+	int i;
+	STREAM* s;
+	RFX_CONTEXT* context;
+	RFX_CONTEXT* dec_context;
+	RFX_MESSAGE* message;
+	RFX_RECT rect = {0, 0, 300, 200};
+	RFX_RECT small_rect = {100, 60, 60, 20};
+
+	rgb_data = (uint8 *) malloc(300 * 200 * 3);
+	for (i = 0; i < 200 * 300 * 3; i++)
+		rgb_data[i] = rgb_scanline_data[i % sizeof(rgb_scanline_data)] ^ (i / 1024);
+
+	context = rfx_context_new();
+	context->mode = RLGR3;
+	context->width = 800;
+	context->height = 600;
+	rfx_context_set_pixel_format(context, RFX_PIXEL_FORMAT_RGB);
+	rfx_context_set_tile_cache(context, true);
+
+	dec_context = rfx_context_new();
+	rfx_context_set_pixel_format(dec_context, RFX_PIXEL_FORMAT_RGB);
+
+	s = stream_new(65536);
+
+	/* the first frame is sent in full */
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	message = rfx_process_message(dec_context, stream_get_head(s), stream_get_length(s));
+	CU_ASSERT(message->num_tiles == 20);
+	rfx_message_free(dec_context, message);
+
+	/* an identical frame produces nothing */
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	CU_ASSERT(stream_get_length(s) == 0);
+
+	/* a single changed pixel only resends its tile, clipped to the rect */
+	rgb_data[(70 * 300 + 150) * 3] ^= 0xFF;
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	message = rfx_process_message(dec_context, stream_get_head(s), stream_get_length(s));
+	CU_ASSERT(message->num_tiles == 1);
+	CU_ASSERT(message->num_tiles == 1 && message->tiles[0]->x == 128 && message->tiles[0]->y == 64);
+	CU_ASSERT(message->num_rects == 1);
+	CU_ASSERT(message->num_rects == 1 && message->rects[0].x == 128 && message->rects[0].y == 64 &&
+		message->rects[0].width == 64 && message->rects[0].height == 64);
+	rfx_message_free(dec_context, message);
+
+	/* tiles outside the rects are ignored, changed tiles inside are sent whole */
+	rgb_data[(10 * 300 + 10) * 3] ^= 0xFF;
+	rgb_data[(70 * 300 + 150) * 3] ^= 0xFF;
+	rgb_data[(70 * 300 + 120) * 3] ^= 0xFF;
+	rgb_data[(100 * 300 + 70) * 3] ^= 0xFF;
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &small_rect, 1, rgb_data, 300, 200, 300 * 3);
+	message = rfx_process_message(dec_context, stream_get_head(s), stream_get_length(s));
+	CU_ASSERT(message->num_tiles == 2);
+	CU_ASSERT(message->num_rects == 1);
+	CU_ASSERT(message->num_rects == 1 && message->rects[0].x == 64 && message->rects[0].y == 64 &&
+		message->rects[0].width == 128 && message->rects[0].height == 64);
+	rfx_message_free(dec_context, message);
+
+	/* the tile left out above was not recorded as sent */
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	message = rfx_process_message(dec_context, stream_get_head(s), stream_get_length(s));
+	CU_ASSERT(message->num_tiles == 1 && message->tiles[0]->x == 0 && message->tiles[0]->y == 0);
+	rfx_message_free(dec_context, message);
+
+	/* edge tiles are clipped to the image */
+	rgb_data[(199 * 300 + 299) * 3] ^= 0xFF;
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	message = rfx_process_message(dec_context, stream_get_head(s), stream_get_length(s));
+	CU_ASSERT(message->num_rects == 1 && message->rects[0].x == 256 && message->rects[0].y == 192 &&
+		message->rects[0].width == 44 && message->rects[0].height == 8);
+	rfx_message_free(dec_context, message);
+
+	/* a reset forgets all tiles */
+	rfx_context_reset(context);
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	message = rfx_process_message(dec_context, stream_get_head(s), stream_get_length(s));
+	CU_ASSERT(message->num_tiles == 20);
+	rfx_message_free(dec_context, message);
+
+	rfx_context_free(dec_context);
+	rfx_context_free(context);
+	stream_free(s);
+	free(rgb_data);
+}
+
+void test_rate_control(void)
+{
+	int i;
+	STREAM* s;
+	uint32 default_bits;
+	RFX_RATE_STATS stats;
+	RFX_CONTEXT* context;
+	RFX_CONTEXT* dec_context;
+	RFX_MESSAGE* message;
+	RFX_RECT rect = {0, 0, 300, 200};
+
+	rgb_data = (uint8 *) malloc(300 * 200 * 3);
+	for (i = 0; i < 200 * 300 * 3; i++)
+		rgb_data[i] = rgb_scanline_data[i % sizeof(rgb_scanline_data)] ^ (i / 1024);
+
+	context = rfx_context_new();
+	context->mode = RLGR3;
+	context->width = 800;
+	context->height = 600;
+	rfx_context_set_pixel_format(context, RFX_PIXEL_FORMAT_RGB);
+
+	dec_context = rfx_context_new();
+	rfx_context_set_pixel_format(dec_context, RFX_PIXEL_FORMAT_RGB);
+
+	s = stream_new(65536);
+
+	/* without rate control the default table is used and no quality is reported */
+	rfx_compose_message_header(context, s);
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	rfx_context_get_rate_stats(context, &stats);
+	default_bits = stats.frame_bits;
+	CU_ASSERT(default_bits == stream_get_length(s) * 8);
+	CU_ASSERT(stats.quality == -1);
+
+	/* half the default size forces coarser tables */
+	rfx_context_set_target_frame_bits(context, default_bits / 2);
+
+	for (i = 0; i < 8; i++)
+	{
+		stream_set_pos(s, 0);
+		rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	}
+
+	rfx_context_get_rate_stats(context, &stats);
+	CU_ASSERT(stats.quality >= 0 && stats.quality < RFX_QUALITY_LEVELS - 3);
+	CU_ASSERT(stats.frame_bits <= default_bits / 2 + default_bits / 10);
+
+	message = rfx_process_message(dec_context, stream_get_head(s), stream_get_length(s));
+	CU_ASSERT(message->num_tiles == 20);
+	rfx_message_free(dec_context, message);
+
+	/* a generous budget goes back to the finest table */
+	rfx_context_set_target_bitrate(context, default_bits * 40, 10);
+
+	for (i = 0; i < 4; i++)
+	{
+		stream_set_pos(s, 0);
+		rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	}
+
+	rfx_context_get_rate_stats(context, &stats);
+	CU_ASSERT(stats.quality == RFX_QUALITY_LEVELS - 1);
+	CU_ASSERT(stats.frame_bits > default_bits);
+	CU_ASSERT(stats.bitrate == stats.average_frame_bits * 10);
+
+	rfx_context_free(dec_context);
+	rfx_context_free(context);
+	stream_free(s);
+	free(rgb_data);
+}
+
+void test_rate_control_tile_cache(void)
+{
+	int i;
+	STREAM* s;
+	RFX_RATE_STATS stats;
+	RFX_CONTEXT* context;
+	RFX_CONTEXT* dec_context;
+	RFX_MESSAGE* message;
+	RFX_RECT rect = {0, 0, 300, 200};
+
+	rgb_data = (uint8 *) malloc(300 * 200 * 3);
+	for (i = 0; i < 200 * 300 * 3; i++)
+		rgb_data[i] = rgb_scanline_data[i % sizeof(rgb_scanline_data)] ^ (i / 1024);
+
+	context = rfx_context_new();
+	context->mode = RLGR3;
+	context->width = 800;
+	context->height = 600;
+	rfx_context_set_pixel_format(context, RFX_PIXEL_FORMAT_RGB);
+	rfx_context_set_tile_cache(context, true);
+
+	dec_context = rfx_context_new();
+	rfx_context_set_pixel_format(dec_context, RFX_PIXEL_FORMAT_RGB);
+
+	s = stream_new(65536);
+
+	/* with a tiny budget, the second full frame has every tile at the coarsest level */
+	rfx_context_set_target_frame_bits(context, 1000);
+
+	for (i = 0; i < 2; i++)
+	{
+		rfx_context_reset(context);
+		stream_set_pos(s, 0);
+		rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	}
+
+	rfx_context_get_rate_stats(context, &stats);
+	CU_ASSERT(stats.quality == 0);
+
+	/* nothing changed and there is no room to improve anything */
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	CU_ASSERT(stream_get_length(s) == 0);
+
+	/* once the budget allows, the same tiles are sent again at the finest level */
+	rfx_context_set_target_frame_bits(context, 10000000);
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	message = rfx_process_message(dec_context, stream_get_head(s), stream_get_length(s));
+	CU_ASSERT(message->num_tiles == 20);
+	rfx_message_free(dec_context, message);
+	rfx_context_get_rate_stats(context, &stats);
+	CU_ASSERT(stats.quality == RFX_QUALITY_LEVELS - 1);
+
+	/* and then left alone */
+	stream_set_pos(s, 0);
+	rfx_compose_message(context, s, &rect, 1, rgb_data, 300, 200, 300 * 3);
+	CU_ASSERT(stream_get_length(s) == 0);
+
+	rfx_context_free(dec_context);
+	rfx_context_free(context);
+	stream_free(s);
+	free(rgb_data);
+}
+
+/* alloc_hook of the context's pool, only set while a test watches it */
+static void test_count_alloc(void* arg, size_t size)
+{
+	(*((int*) arg))++;
+}
+
+void test_message_no_alloc(void)
+{
+	int i, j;
+	STREAM* s;
+	uint8* surface;
+	boolean aligned;
+	int alloc_count;
+	RFX_CONTEXT* context;
+	RFX_MESSAGE* message;
+	RFX_RECT rects[2] = { { 0, 0, 300, 100 }, { 40, 100, 200, 100 } };
+
+	rgb_data = (uint8 *) malloc(300 * 200 * 3);
+	for (i = 0; i < 200 * 300 * 3; i++)
+		rgb_data[i] = rgb_scanline_data[i % sizeof(rgb_scanline_data)] ^ (i / 1024);
+
+	surface = (uint8*) malloc(300 * 200 * 4);
+
+	context = rfx_context_new();
+	context->mode = RLGR3;
+	context->width = 800;
+	context->height = 600;
+	rfx_context_set_pixel_format(context, RFX_PIXEL_FORMAT_BGRA);
+	rfx_context_set_thread_count(context, 2);
+
+	s = stream_new(65536);
+	rfx_compose_message(context, s, rects, 2, rgb_data, 300, 200, 300 * 3);
+	stream_seal(s);
+
+	/* the first frame sizes the arena */
+	message = rfx_process_message(context, s->data, s->size);
+	rfx_message_free(context, message);
+	message = rfx_process_message_to_surface(context, s->data, s->size,
+		surface, 300 * 4, RFX_PIXEL_FORMAT_BGRA, 300, 200, 0, 0);
+	rfx_message_free(context, message);
+
+	aligned = true;
+
+	alloc_count = 0;
+	context->priv->pool->alloc_hook = test_count_alloc;
+	context->priv->pool->alloc_hook_arg = &alloc_count;
+
+	for (i = 0; i < 1000; i++)
+	{
+		message = rfx_process_message(context, s->data, s->size);
+
+		for (j = 0; j < message->num_tiles; j++)
+		{
+			if (((size_t) message->tiles[j]->data & 63) != 0)
+				aligned = false;
+		}
+
+		rfx_message_free(context, message);
+
+		if ((i % 10) == 0)
+		{
+			message = rfx_process_message_to_surface(context, s->data, s->size,
+				surface, 300 * 4, RFX_PIXEL_FORMAT_BGRA, 300, 200, 0, 0);
+			rfx_message_free(context, message);
+		}
+	}
+
+	context->priv->pool->alloc_hook = NULL;
+	CU_ASSERT(alloc_count == 0);
+	CU_ASSERT(aligned);
+
+	rfx_context_free(context);
+	stream_free(s);
+	free(surface);
+	free(rgb_data);
+}
+
+static sint16 simd_ref[3][4096];
+static sint16 simd_opt[3][4096];
+static sint16 simd_planes[3][4096];
+
+static void fill_random(sint16* buf, int min, int max)
+{
+	int i;
+
+	for (i = 0; i < 4096; i++)
+		buf[i] = min + (rand() % (max - min + 1));
+}
+
+static void copy_ref_to_opt(void)
+{
+	memcpy(simd_opt, simd_ref, sizeof(simd_ref));
+}
+
+static int compare_ref_opt(int n)
+{
+	return memcmp(simd_opt, simd_ref, n * sizeof(simd_ref[0])) == 0;
+}
+
+/* Run the reference C routines and the active context routines on the same input */
+static void check_component_decode(RFX_CONTEXT* context, const uint32* quants)
+{
+	sint16* dwt_buffer = context->priv->scratch.dwt_buffer;
+
+	copy_ref_to_opt();
+	rfx_quantization_decode(simd_ref[0], quants);
+	context->quantization_decode(simd_opt[0], quants);
+	CU_ASSERT(compare_ref_opt(1));
+
+	copy_ref_to_opt();
+	rfx_dwt_2d_decode(simd_ref[0], dwt_buffer);
+	context->dwt_2d_decode(simd_opt[0], dwt_buffer);
+	CU_ASSERT(compare_ref_opt(1));
+}
+
+static void check_component_encode(RFX_CONTEXT* context, const uint32* quants)
+{
+	sint16* dwt_buffer = context->priv->scratch.dwt_buffer;
+
+	copy_ref_to_opt();
+	rfx_dwt_2d_encode(simd_ref[0], dwt_buffer);
+	context->dwt_2d_encode(simd_opt[0], dwt_buffer);
+	CU_ASSERT(compare_ref_opt(1));
+
+	copy_ref_to_opt();
+	rfx_quantization_encode(simd_ref[0], quants);
+	context->quantization_encode(simd_opt[0], quants);
+	CU_ASSERT(compare_ref_opt(1));
+}
+
+void test_avx2(void)
+{
+	int i, j;
+	RFX_CONTEXT* context;
+	uint32 quants[10];
+	const uint8* data[3] = { y_data, cb_data, cr_data };
+	int size[3] = { sizeof(y_data), sizeof(cb_data), sizeof(cr_data) };
+
+	context = rfx_context_new();
+	rfx_context_set_cpu_opt(context, CPU_AVX2);
+
+	if (!(freerdp_detect_cpu() & CPU_AVX2) || context->dwt_2d_decode == rfx_dwt_2d_decode)
+	{
+		/* not compiled in, or not supported by this CPU */
+		rfx_context_free(context);
+		return;
+	}
+
+	/* the sample tile, through the decoder and back through the encoder */
+	for (i = 0; i < 3; i++)
+	{
+		rfx_rlgr_decode(RLGR3, data[i], size[i], simd_ref[0], 4096);
+		rfx_differential_decode(simd_ref[0] + 4032, 64);
+		check_component_decode(context, test_quantization_values);
+		memcpy(simd_planes[i], simd_ref[0], sizeof(simd_ref[0]));
+	}
+	memcpy(simd_ref, simd_planes, sizeof(simd_ref));
+
+	copy_ref_to_opt();
+	rfx_decode_ycbcr_to_rgb(simd_ref[0], simd_ref[1], simd_ref[2]);
+	context->decode_ycbcr_to_rgb(simd_opt[0], simd_opt[1], simd_opt[2]);
+	CU_ASSERT(compare_ref_opt(3));
+
+	copy_ref_to_opt();
+	rfx_encode_rgb_to_ycbcr(simd_ref[0], simd_ref[1], simd_ref[2]);
+	context->encode_rgb_to_ycbcr(simd_opt[0], simd_opt[1], simd_opt[2]);
+	CU_ASSERT(compare_ref_opt(3));
+
+	check_component_encode(context, test_quantization_values);
+
+	/* random input over the full sint16 range, which exercises every rounding and overflow path */
+	srand(1);
+
+	for (i = 0; i < 16; i++)
+	{
+		for (j = 0; j < 10; j++)
+			quants[j] = 6 + rand() % 10;
+
+		fill_random(simd_ref[0], -32768, 32767);
+		check_component_decode(context, quants);
+
+		fill_random(simd_ref[0], -32768, 32767);
+		check_component_encode(context, quants);
+
+		for (j = 0; j < 3; j++)
+			fill_random(simd_ref[j], -32768, 32767);
+		copy_ref_to_opt();
+		rfx_encode_rgb_to_ycbcr(simd_ref[0], simd_ref[1], simd_ref[2]);
+		context->encode_rgb_to_ycbcr(simd_opt[0], simd_opt[1], simd_opt[2]);
+		CU_ASSERT(compare_ref_opt(3));
+
+		/* keep the shifted products of the reference within sint32 */
+		for (j = 0; j < 3; j++)
+			fill_random(simd_ref[j], -8192, 8191);
+		copy_ref_to_opt();
+		rfx_decode_ycbcr_to_rgb(simd_ref[0], simd_ref[1], simd_ref[2]);
+		context->decode_ycbcr_to_rgb(simd_opt[0], simd_opt[1], simd_opt[2]);
+		CU_ASSERT(compare_ref_opt(3));
+	}
+
+	rfx_context_free(context);
+}
+
+/* Expand one pixel the way the encoder does before the colour conversion */
+static void expand_pixel(const uint8* src, RFX_PIXEL_FORMAT pixel_format, sint16* r, sint16* g, sint16* b)
+{
+	uint16 px;
+
+	switch (pixel_format)
+	{
+		case RFX_PIXEL_FORMAT_BGRA:
+			*b = src[0]; *g = src[1]; *r = src[2];
+			break;
+		case RFX_PIXEL_FORMAT_RGBA:
+			*r = src[0]; *g = src[1]; *b = src[2];
+			break;
+		default:
+			px = src[0] | (src[1] << 8);
+			*b = ((px >> 8) & 0xF8) | (px >> 13);
+			*g = (px >> 3) & 0xFC;
+			*r = ((px << 3) & 0xF8) | ((px >> 2) & 0x07);
+			if (pixel_format == RFX_PIXEL_FORMAT_RGB565_LE)
+			{
+				px = *r; *r = *b; *b = px;
+			}
+			break;
+	}
+}
+
+void test_encode_fused(void)
+{
+	int i, f, t;
+	int x, y;
+	int bpp, rowstride;
+	int width, height;
+	uint8* pixels;
+	sint16* ref;
+	sint16* opt;
+	RFX_CONTEXT* context;
+	static const RFX_PIXEL_FORMAT formats[] = { RFX_PIXEL_FORMAT_BGRA, RFX_PIXEL_FORMAT_RGBA,
+		RFX_PIXEL_FORMAT_BGR565_LE, RFX_PIXEL_FORMAT_RGB565_LE };
+	static const int sizes[][2] = { { 64, 64 }, { 37, 21 }, { 1, 64 }, { 64, 1 } };
+	uint32 cpu_opts[] = { 0, CPU_SSE2, CPU_SSE2 | CPU_AVX2 };
+
+	pixels = (uint8*) xmalloc(64 * (64 * 4 + 3));
+	ref = (sint16*) xmalloc(3 * 4096 * sizeof(sint16));
+	opt = (sint16*) xmalloc(3 * 4096 * sizeof(sint16));
+
+	srand(3);
+
+	for (i = 0; i < 64 * (64 * 4 + 3); i++)
+		pixels[i] = rand() & 0xFF;
+
+	for (i = 0; i < 3; i++)
+	{
+		if ((cpu_opts[i] & freerdp_detect_cpu()) != cpu_opts[i])
+			continue;
+
+		context = rfx_context_new();
+		rfx_context_set_cpu_opt(context, cpu_opts[i]);
+
+		for (f = 0; f < 4; f++)
+		{
+			bpp = (f < 2) ? 4 : 2;
+			rowstride = 64 * bpp + 3;
+
+			for (t = 0; t < 4; t++)
+			{
+				width = sizes[t][0];
+				height = sizes[t][1];
+
+				/* the two pass path: padded planes, then the context colour conversion */
+				for (y = 0; y < 64; y++)
+				{
+					for (x = 0; x < 64; x++)
+					{
+						expand_pixel(pixels + MIN(y, height - 1) * rowstride + MIN(x, width - 1) * bpp,
+							formats[f], &ref[y * 64 + x], &ref[4096 + y * 64 + x], &ref[8192 + y * 64 + x]);
+					}
+				}
+				context->encode_rgb_to_ycbcr(ref, ref + 4096, ref + 8192);
+
+				memset(opt, 0x55, 3 * 4096 * sizeof(sint16));
+				CU_ASSERT(context->encode_format_rgb_to_ycbcr(pixels, width, height, rowstride,
+					formats[f], opt, opt + 4096, opt + 8192) == true);
+				CU_ASSERT(memcmp(ref, opt, 3 * 4096 * sizeof(sint16)) == 0);
+			}
+		}
+
+		/* palette formats are left to the two pass path */
+		CU_ASSERT(context->encode_format_rgb_to_ycbcr(pixels, 64, 64, 64, RFX_PIXEL_FORMAT_PALETTE8,
+			opt, opt + 4096, opt + 8192) == false);
+
+		rfx_context_free(context);
+	}
+
+	xfree(pixels);
+	xfree(ref);
+	xfree(opt);
+}
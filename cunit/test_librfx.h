@@ -26,9 +26,19 @@ int add_librfx_suite(void);
 void test_bitstream(void);
 void test_bitstream_enc(void);
 void test_rlgr(void);
+void test_rlgr_roundtrip(void);
 void test_differential(void);
 void test_quantization(void);
 void test_dwt(void);
 void test_decode(void);
 void test_encode(void);
 void test_message(void);
+void test_message_threaded(void);
+void test_encode_threaded(void);
+void test_message_surface(void);
+void test_encode_tile_cache(void);
+void test_rate_control(void);
+void test_rate_control_tile_cache(void);
+void test_message_no_alloc(void);
+void test_avx2(void);
+void test_encode_fused(void);
@@ -24,3 +24,6 @@ int clean_mppc_suite(void);
 int add_mppc_suite(void);
 
 void test_mppc(void);
+void test_mppc_compress(void);
+void test_mppc_large(void);
+void test_mppc_malformed(void);
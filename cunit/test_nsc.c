@@ -0,0 +1,444 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * NSCodec Library Unit Tests
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <freerdp/types.h>
+#include <freerdp/constants.h>
+#include <freerdp/utils/memory.h>
+#include <freerdp/utils/cpu.h>
+#include <freerdp/utils/stream.h>
+#include <freerdp/codec/nsc.h>
+#include <freerdp/codec/color.h>
+
+#include "test_nsc.h"
+
+/* 2x2, colorLossLevel 1, no subsampling, all planes raw */
+static const uint8 nsc_raw_stream[] =
+{
+	0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00,
+	0x64, 0xC8, 0x00, 0xFF,	/* Y */
+	0x00, 0x0A, 0xF6, 0x80,	/* Co */
+	0x00, 0x00, 0x00, 0x7F,	/* Cg */
+	0x01, 0x02, 0x03, 0x04	/* A */
+};
+
+static const uint8 nsc_raw_bgra[] =
+{
+	0x64, 0x64, 0x64, 0x01,	0xBE, 0xC8, 0xD2, 0x02,
+	0x0A, 0x00, 0x00, 0x03,	0xFF, 0xFF, 0x00, 0x04
+};
+
+/* 4x4, colorLossLevel 2, no subsampling, Y and Co run length encoded, no alpha */
+static const uint8 nsc_rle_stream[] =
+{
+	0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00,
+	0x50, 0x50, 0x0A, 0x50, 0x50, 0x50, 0x60,	/* Y: run of 12, short form */
+	0x02, 0x02, 0xFF, 0x0C, 0x00, 0x00, 0x00,	/* Co: run of 12, long form */
+	0x02, 0x02, 0x02, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	/* Cg */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+int init_nsc_suite(void)
+{
+	return 0;
+}
+
+int clean_nsc_suite(void)
+{
+	return 0;
+}
+
+int add_nsc_suite(void)
+{
+	add_test_suite(nsc);
+
+	add_test_function(nsc_decode_raw);
+	add_test_function(nsc_decode_rle);
+	add_test_function(nsc_decode_subsampling);
+	add_test_function(nsc_decode_invalid);
+	add_test_function(nsc_encode_roundtrip);
+	add_test_function(nsc_encode_opaque);
+	add_test_function(nsc_encode_orientation);
+
+	return 0;
+}
+
+/* decode with the C routine and, when available, with the SIMD one */
+static boolean test_nsc_decode(NSC_CONTEXT* context, const uint8* data, uint32 length,
+	int width, int height, const uint8* expected)
+{
+	int i;
+	uint32 cpu_opts[] = { 0, CPU_SSE2 };
+
+	for (i = 0; i < 2; i++)
+	{
+		if ((cpu_opts[i] & freerdp_detect_cpu()) != cpu_opts[i])
+			continue;
+
+		nsc_context_set_cpu_opt(context, cpu_opts[i]);
+		context->width = width;
+		context->height = height;
+
+		if (!nsc_process_message(context, (uint8*) data, length))
+			return false;
+
+		if (memcmp(context->bmpdata, expected, width * height * 4) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+void test_nsc_decode_raw(void)
+{
+	NSC_CONTEXT* context;
+
+	context = nsc_context_new();
+	CU_ASSERT(test_nsc_decode(context, nsc_raw_stream, sizeof(nsc_raw_stream), 2, 2, nsc_raw_bgra));
+	nsc_context_free(context);
+}
+
+void test_nsc_decode_rle(void)
+{
+	int i;
+	uint8 expected[4 * 4 * 4];
+	NSC_CONTEXT* context;
+
+	/* y = 0x50, co = 2 << 1, cg = 0 */
+	for (i = 0; i < 16; i++)
+	{
+		expected[i * 4 + 0] = 0x4C;
+		expected[i * 4 + 1] = 0x50;
+		expected[i * 4 + 2] = 0x54;
+		expected[i * 4 + 3] = 0xFF;
+	}
+
+	/* the last raw luma sample is 0x60 */
+	expected[15 * 4 + 0] = 0x5C;
+	expected[15 * 4 + 1] = 0x60;
+	expected[15 * 4 + 2] = 0x64;
+
+	context = nsc_context_new();
+	CU_ASSERT(test_nsc_decode(context, nsc_rle_stream, sizeof(nsc_rle_stream), 4, 4, expected));
+
+	/* buffers are reused, a second message decodes the same */
+	CU_ASSERT(test_nsc_decode(context, nsc_rle_stream, sizeof(nsc_rle_stream), 4, 4, expected));
+	CU_ASSERT(test_nsc_decode(context, nsc_raw_stream, sizeof(nsc_raw_stream), 2, 2, nsc_raw_bgra));
+	nsc_context_free(context);
+}
+
+static uint8 test_nsc_clamp(int v)
+{
+	return (v < 0) ? 0 : ((v > 0xFF) ? 0xFF : v);
+}
+
+void test_nsc_decode_subsampling(void)
+{
+	int x, y;
+	int width = 37;
+	int height = 5;
+	int y_stride, c_stride, c_height;
+	int shift = 2;
+	sint8 co, cg;
+	uint8 yv;
+	uint8* data;
+	uint8* yplane;
+	uint8* coplane;
+	uint8* cgplane;
+	uint8* expected;
+	uint32 length;
+	NSC_CONTEXT* context;
+
+	/* luma rows are padded to 8, chroma is half that in both directions */
+	y_stride = ROUND_UP_TO(width, 8);
+	c_stride = y_stride / 2;
+	c_height = ROUND_UP_TO(height, 2) / 2;
+
+	length = 20 + y_stride * height + 2 * c_stride * c_height;
+	data = (uint8*) xzalloc(length);
+	expected = (uint8*) xmalloc(width * height * 4);
+
+	data[0] = y_stride * height;
+	data[4] = c_stride * c_height;
+	data[8] = c_stride * c_height;
+	data[16] = shift + 1;
+	data[17] = 1;
+
+	yplane = data + 20;
+	coplane = yplane + y_stride * height;
+	cgplane = coplane + c_stride * c_height;
+
+	for (x = 0; x < y_stride * height; x++)
+		yplane[x] = (uint8) (x * 7 + 13);
+
+	for (x = 0; x < c_stride * c_height; x++)
+	{
+		coplane[x] = (uint8) (x * 29);
+		cgplane[x] = (uint8) (x * 53 + 100);
+	}
+
+	for (y = 0; y < height; y++)
+	{
+		for (x = 0; x < width; x++)
+		{
+			yv = yplane[y * y_stride + x];
+			co = (sint8) (coplane[(y / 2) * c_stride + x / 2] << shift);
+			cg = (sint8) (cgplane[(y / 2) * c_stride + x / 2] << shift);
+
+			expected[(y * width + x) * 4 + 0] = test_nsc_clamp(yv - co - cg);
+			expected[(y * width + x) * 4 + 1] = test_nsc_clamp(yv + cg);
+			expected[(y * width + x) * 4 + 2] = test_nsc_clamp(yv + co - cg);
+			expected[(y * width + x) * 4 + 3] = 0xFF;
+		}
+	}
+
+	context = nsc_context_new();
+	CU_ASSERT(test_nsc_decode(context, data, length, width, height, expected));
+	nsc_context_free(context);
+
+	xfree(expected);
+	xfree(data);
+}
+
+void test_nsc_decode_invalid(void)
+{
+	uint8 data[sizeof(nsc_rle_stream)];
+	NSC_CONTEXT* context;
+
+	context = nsc_context_new();
+	context->width = 4;
+	context->height = 4;
+
+	/* truncated header */
+	CU_ASSERT(nsc_process_message(context, (uint8*) nsc_rle_stream, 19) == false);
+
+	/* plane byte counts beyond the end of the stream */
+	CU_ASSERT(nsc_process_message(context, (uint8*) nsc_rle_stream, sizeof(nsc_rle_stream) - 1) == false);
+
+	/* colorLossLevel out of range */
+	memcpy(data, nsc_rle_stream, sizeof(data));
+	data[16] = 0;
+	CU_ASSERT(nsc_process_message(context, data, sizeof(data)) == false);
+	data[16] = 8;
+	CU_ASSERT(nsc_process_message(context, data, sizeof(data)) == false);
+
+	/* run longer than the plane */
+	memcpy(data, nsc_rle_stream, sizeof(data));
+	data[22] = 0x0F;
+	CU_ASSERT(nsc_process_message(context, data, sizeof(data)) == false);
+
+	/* run covering the four raw bytes at the end of the plane */
+	data[22] = 0x0E;
+	CU_ASSERT(nsc_process_message(context, data, sizeof(data)) == false);
+	data[22] = 0x0B;
+	CU_ASSERT(nsc_process_message(context, data, sizeof(data)) == false);
+
+	nsc_context_free(context);
+}
+
+static void test_nsc_fill_image(uint8* image, int width, int height, boolean opaque)
+{
+	int x, y;
+	uint8* p = image;
+
+	for (y = 0; y < height; y++)
+	{
+		for (x = 0; x < width; x++)
+		{
+			*p++ = (uint8) (x * 255 / width);
+			*p++ = (uint8) (y * 255 / height);
+			*p++ = (uint8) ((x + y) * 255 / (width + height));
+			*p++ = opaque ? 0xFF : (uint8) (x ^ y);
+		}
+	}
+}
+
+static int test_nsc_max_error(const uint8* a, const uint8* b, int count)
+{
+	int i;
+	int d, max = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		d = a[i] - b[i];
+		d = (d < 0) ? -d : d;
+
+		if (d > max)
+			max = d;
+	}
+
+	return max;
+}
+
+void test_nsc_encode_roundtrip(void)
+{
+	int i, j, k;
+	int width = 67;
+	int height = 35;
+	int levels[] = { 1, 3, 7 };
+	uint8* image;
+	uint8* output;
+	STREAM* s_c;
+	STREAM* s;
+	NSC_CONTEXT* encoder;
+	NSC_CONTEXT* decoder;
+
+	image = (uint8*) xmalloc(width * height * 4);
+	output = (uint8*) xmalloc(width * height * 4);
+	test_nsc_fill_image(image, width, height, false);
+
+	encoder = nsc_context_new();
+	decoder = nsc_context_new();
+	s_c = stream_new(1024);
+	s = stream_new(1024);
+
+	for (i = 0; i < 3; i++)
+	{
+		for (j = 0; j < 2; j++)
+		{
+			nsc_context_set_color_loss_level(encoder, levels[i]);
+			nsc_context_set_chroma_subsampling(encoder, j);
+
+			nsc_context_set_cpu_opt(encoder, 0);
+			stream_set_pos(s_c, 0);
+			nsc_compose_message(encoder, s_c, image, width, height, width * 4);
+
+			/* the SIMD routines must produce the same stream */
+			nsc_context_set_cpu_opt(encoder, freerdp_detect_cpu());
+			stream_set_pos(s, 0);
+			nsc_compose_message(encoder, s, image, width, height, width * 4);
+
+			CU_ASSERT(stream_get_length(s) == stream_get_length(s_c));
+			CU_ASSERT(memcmp(s->data, s_c->data, stream_get_length(s)) == 0);
+
+			decoder->width = width;
+			decoder->height = height;
+			CU_ASSERT(nsc_process_message(decoder, s->data, stream_get_length(s)) == true);
+			freerdp_image_flip(decoder->bmpdata, output, width, height, 32);
+
+			/* chroma is kept in steps of 2^level, alpha survives untouched */
+			for (k = 0; k < width * height * 4; k += 4)
+			{
+				if (test_nsc_max_error(&output[k], &image[k], 3) > (1 << levels[i]) + 3 ||
+						output[k + 3] != image[k + 3])
+					break;
+			}
+
+			CU_ASSERT(k == width * height * 4);
+		}
+	}
+
+	stream_free(s_c);
+	stream_free(s);
+	nsc_context_free(encoder);
+	nsc_context_free(decoder);
+	xfree(output);
+	xfree(image);
+}
+
+void test_nsc_encode_opaque(void)
+{
+	int i;
+	int width = 40;
+	int height = 20;
+	uint8* image;
+	uint8* output;
+	STREAM* s;
+	NSC_CONTEXT* context;
+
+	/* grey has no chroma, so it round trips exactly */
+	image = (uint8*) xmalloc(width * height * 4);
+	memset(image, 0xFF, width * height * 4);
+
+	for (i = 0; i < width * height; i++)
+		image[i * 4] = image[i * 4 + 1] = image[i * 4 + 2] = (i < 400) ? 0x80 : 0x20;
+
+	context = nsc_context_new();
+	s = stream_new(64);
+
+	nsc_compose_message(context, s, image, width, height, width * 4);
+
+	/* no alpha plane, and the flat planes are run length encoded */
+	CU_ASSERT(s->data[12] == 0 && s->data[13] == 0 && s->data[14] == 0 && s->data[15] == 0);
+	CU_ASSERT(stream_get_length(s) < 64);
+
+	CU_ASSERT(nsc_process_message(context, s->data, stream_get_length(s)) == true);
+
+	output = (uint8*) xmalloc(width * height * 4);
+	freerdp_image_flip(context->bmpdata, output, width, height, 32);
+	CU_ASSERT(memcmp(output, image, width * height * 4) == 0);
+
+	stream_free(s);
+	nsc_context_free(context);
+	xfree(output);
+	xfree(image);
+}
+
+void test_nsc_encode_orientation(void)
+{
+	int x, y;
+	int width = 24;
+	int height = 6;
+	uint8* image;
+	uint8* row;
+	STREAM* s;
+	NSC_CONTEXT* encoder;
+	NSC_CONTEXT* decoder;
+
+	/* a white top row over a black image */
+	image = (uint8*) xzalloc(width * height * 4);
+	memset(image, 0xFF, width * 4);
+
+	for (x = 0; x < width * height; x++)
+		image[x * 4 + 3] = 0xFF;
+
+	encoder = nsc_context_new();
+	decoder = nsc_context_new();
+	s = stream_new(64);
+
+	nsc_compose_message(encoder, s, image, width, height, width * 4);
+
+	decoder->width = width;
+	decoder->height = height;
+	CU_ASSERT(nsc_process_message(decoder, s->data, stream_get_length(s)) == true);
+
+	/* the stream is bottom-up: the clients blit its last row at the top */
+	for (y = 0; y < height; y++)
+	{
+		row = decoder->bmpdata + (height - 1 - y) * width * 4;
+
+		for (x = 0; x < width * 4; x += 4)
+		{
+			if (row[x] != ((y == 0) ? 0xFF : 0x00))
+				break;
+		}
+
+		CU_ASSERT(x == width * 4);
+	}
+
+	stream_free(s);
+	nsc_context_free(encoder);
+	nsc_context_free(decoder);
+	xfree(image);
+}
@@ -355,7 +355,6 @@ void test_read_polyline_order(void)
 	CU_ASSERT(polyline.points[29].x == 13);
 	CU_ASSERT(polyline.points[30].x == -77);
 	CU_ASSERT(polyline.points[31].x == -153);
-	CU_ASSERT(polyline.points[32].x == 0);
 
 	CU_ASSERT(stream_get_length(s) == (sizeof(polyline_order) - 1));
 }
@@ -0,0 +1,275 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * Server Runtime Unit Tests
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <freerdp/runtime.h>
+#include <freerdp/utils/sleep.h>
+#include <freerdp/utils/memory.h>
+
+#include "test_runtime.h"
+
+int init_runtime_suite(void)
+{
+	return 0;
+}
+
+int clean_runtime_suite(void)
+{
+	return 0;
+}
+
+int add_runtime_suite(void)
+{
+	add_test_suite(runtime);
+
+#ifdef HAVE_SYS_EPOLL_H
+	add_test_function(runtime_sessions);
+	add_test_function(runtime_timer);
+	add_test_function(runtime_free);
+#endif
+
+	return 0;
+}
+
+#ifdef HAVE_SYS_EPOLL_H
+
+#define TEST_RUNTIME_PEERS	8
+
+/**
+ * A peer without a connection: the runtime only sees its callbacks, which
+ * read what the test writes to the other end of a socket pair.
+ */
+struct test_runtime_peer
+{
+	freerdp_peer client;
+	int sv[2];
+	int bytes;
+	int ticks;
+	int max_ticks;
+};
+typedef struct test_runtime_peer testRuntimePeer;
+
+static int peers_closed;
+
+static tbool test_runtime_get_fds(freerdp_peer* client, void** rfds, int* rcount)
+{
+	testRuntimePeer* peer = (testRuntimePeer*) client;
+
+	rfds[*rcount] = (void*)(long) peer->sv[1];
+	(*rcount)++;
+
+	return true;
+}
+
+static tbool test_runtime_check_fds(freerdp_peer* client)
+{
+	int status;
+	uint8 buffer[256];
+	testRuntimePeer* peer = (testRuntimePeer*) client;
+
+	while ((status = read(peer->sv[1], buffer, sizeof(buffer))) > 0)
+		__sync_add_and_fetch(&peer->bytes, status);
+
+	/* the other end is closed */
+	if (status == 0)
+		return false;
+
+	return true;
+}
+
+static boolean test_runtime_tick(freerdp_peer* client, void* param)
+{
+	testRuntimePeer* peer = (testRuntimePeer*) client;
+
+	return (__sync_add_and_fetch(&peer->ticks, 1) < peer->max_ticks) ? true : false;
+}
+
+static void test_runtime_peer_closed(freerdp_runtime* instance, freerdp_peer* client)
+{
+	testRuntimePeer* peer = (testRuntimePeer*) client;
+
+	close(peer->sv[0]);
+	close(peer->sv[1]);
+	xfree(peer);
+
+	__sync_add_and_fetch(&peers_closed, 1);
+}
+
+static testRuntimePeer* test_runtime_peer_new(void)
+{
+	testRuntimePeer* peer;
+
+	peer = xnew(testRuntimePeer);
+	socketpair(AF_UNIX, SOCK_STREAM, 0, peer->sv);
+	fcntl(peer->sv[1], F_SETFL, fcntl(peer->sv[1], F_GETFL) | O_NONBLOCK);
+
+	peer->client.GetFileDescriptor = test_runtime_get_fds;
+	peer->client.CheckFileDescriptor = test_runtime_check_fds;
+
+	return peer;
+}
+
+/* the peer may be freed as soon as the runtime sees the hangup */
+static void test_runtime_peer_hangup(testRuntimePeer* peer)
+{
+	shutdown(peer->sv[0], SHUT_WR);
+}
+
+/* wait for up to two seconds for a counter updated by the workers */
+static int test_runtime_wait(int* value, int expected)
+{
+	int i;
+
+	for (i = 0; i < 2000 && __sync_add_and_fetch(value, 0) < expected; i++)
+		freerdp_usleep(1000);
+
+	return __sync_add_and_fetch(value, 0);
+}
+
+static freerdp_runtime* test_runtime_new(int workers)
+{
+	freerdp_runtime* runtime;
+
+	peers_closed = 0;
+
+	runtime = freerdp_runtime_new(workers);
+
+	if (runtime != NULL)
+		runtime->PeerClosed = test_runtime_peer_closed;
+
+	return runtime;
+}
+
+void test_runtime_sessions(void)
+{
+	int i, j;
+	uint8 data[100];
+	freerdp_runtime* runtime;
+	testRuntimePeer* peers[TEST_RUNTIME_PEERS];
+
+	runtime = test_runtime_new(3);
+	CU_ASSERT_FATAL(runtime != NULL);
+
+	memset(data, 0x5A, sizeof(data));
+
+	for (i = 0; i < TEST_RUNTIME_PEERS; i++)
+	{
+		peers[i] = test_runtime_peer_new();
+		CU_ASSERT(freerdp_runtime_add_peer(runtime, &peers[i]->client) == true);
+	}
+
+	/* every peer gets its own amount of data, spread over several writes */
+	for (j = 0; j < 4; j++)
+	{
+		for (i = 0; i < TEST_RUNTIME_PEERS; i++)
+			CU_ASSERT(write(peers[i]->sv[0], data, i + 1) == i + 1);
+
+		freerdp_usleep(1000);
+	}
+
+	for (i = 0; i < TEST_RUNTIME_PEERS; i++)
+		CU_ASSERT(test_runtime_wait(&peers[i]->bytes, 4 * (i + 1)) == 4 * (i + 1));
+
+	/* a hangup closes that session only */
+	test_runtime_peer_hangup(peers[0]);
+	CU_ASSERT(test_runtime_wait(&peers_closed, 1) == 1);
+
+	CU_ASSERT(write(peers[1]->sv[0], data, sizeof(data)) == sizeof(data));
+	CU_ASSERT(test_runtime_wait(&peers[1]->bytes, 8 + sizeof(data)) == 8 + sizeof(data));
+
+	for (i = 1; i < TEST_RUNTIME_PEERS; i++)
+		test_runtime_peer_hangup(peers[i]);
+
+	CU_ASSERT(test_runtime_wait(&peers_closed, TEST_RUNTIME_PEERS) == TEST_RUNTIME_PEERS);
+
+	freerdp_runtime_free(runtime);
+	CU_ASSERT(__sync_add_and_fetch(&peers_closed, 0) == TEST_RUNTIME_PEERS);
+}
+
+void test_runtime_timer(void)
+{
+	freerdp_runtime* runtime;
+	testRuntimePeer* peer;
+
+	runtime = test_runtime_new(1);
+	CU_ASSERT_FATAL(runtime != NULL);
+
+	/* the session closes itself when the timer returns false on its fifth tick */
+	peer = test_runtime_peer_new();
+	peer->max_ticks = 5;
+
+	CU_ASSERT(freerdp_runtime_add_timer(runtime, &peer->client, 5, test_runtime_tick, NULL) == true);
+	CU_ASSERT(freerdp_runtime_add_peer(runtime, &peer->client) == true);
+
+	CU_ASSERT(test_runtime_wait(&peers_closed, 1) == 1);
+
+	freerdp_runtime_free(runtime);
+	CU_ASSERT(__sync_add_and_fetch(&peers_closed, 0) == 1);
+}
+
+static boolean test_runtime_source_get_fds(void* object, void** rfds, int* rcount)
+{
+	return test_runtime_get_fds((freerdp_peer*) object, rfds, rcount);
+}
+
+static boolean test_runtime_source_check_fds(void* object)
+{
+	return test_runtime_check_fds((freerdp_peer*) object);
+}
+
+void test_runtime_free(void)
+{
+	uint8 data[16];
+	freerdp_runtime* runtime;
+	testRuntimePeer* served;
+	testRuntimePeer* source;
+	testRuntimePeer* unstarted;
+
+	runtime = test_runtime_new(2);
+	CU_ASSERT_FATAL(runtime != NULL);
+
+	memset(data, 0, sizeof(data));
+
+	/* a peer whose own fds come from a source, polled along with the peer */
+	source = test_runtime_peer_new();
+	source->client.GetFileDescriptor = NULL;
+	source->client.CheckFileDescriptor = NULL;
+
+	CU_ASSERT(freerdp_runtime_add_source(runtime, &source->client, &source->client,
+		test_runtime_source_get_fds, test_runtime_source_check_fds) == true);
+	CU_ASSERT(freerdp_runtime_add_peer(runtime, &source->client) == true);
+
+	served = test_runtime_peer_new();
+	CU_ASSERT(freerdp_runtime_add_peer(runtime, &served->client) == true);
+
+	/* a peer that was never handed to a worker */
+	unstarted = test_runtime_peer_new();
+	CU_ASSERT(freerdp_runtime_add_timer(runtime, &unstarted->client, 1000, test_runtime_tick, NULL) == true);
+
+	CU_ASSERT(write(source->sv[0], data, sizeof(data)) == sizeof(data));
+	CU_ASSERT(test_runtime_wait(&source->bytes, sizeof(data)) == sizeof(data));
+
+	/* the runtime closes what is left */
+	freerdp_runtime_free(runtime);
+	CU_ASSERT(__sync_add_and_fetch(&peers_closed, 0) == 3);
+}
+
+#endif
@@ -0,0 +1,392 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * Network Transport Layer Unit Tests
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <freerdp/freerdp.h>
+#include <freerdp/utils/stream.h>
+
+#include "transport.h"
+#include "test_transport.h"
+
+int init_transport_suite(void)
+{
+	return 0;
+}
+
+int clean_transport_suite(void)
+{
+	return 0;
+}
+
+int add_transport_suite(void)
+{
+	add_test_suite(transport);
+
+	add_test_function(transport_check_fds);
+	add_test_function(transport_ring_wrap);
+	add_test_function(transport_read);
+	add_test_function(transport_write);
+	add_test_function(transport_write_limit);
+
+	return 0;
+}
+
+/* what the receive callback got, each PDU is checked against its sequence number */
+static int pdu_count;
+static int pdu_bytes;
+static int pdu_errors;
+
+static tbool test_transport_recv(rdpTransport* transport, STREAM* s, void* extra)
+{
+	int i;
+	int length;
+	uint8* data;
+
+	data = stream_get_head(s);
+	length = stream_get_size(s);
+
+	for (i = 4; i < length; i++)
+	{
+		if (data[i] != (uint8) (pdu_count + i))
+			pdu_errors++;
+	}
+
+	pdu_count++;
+	pdu_bytes += length;
+
+	return true;
+}
+
+/* a TPKT header, or a fast-path header padded to 4 bytes, and the sequence pattern */
+static int test_transport_pdu(uint8* data, int length, int sequence)
+{
+	int i;
+
+	if (length <= 0x7F)
+	{
+		data[0] = 0x00;
+		data[1] = length;
+		data[2] = 0;
+		data[3] = 0;
+	}
+	else if (length <= 0x7FFF && (sequence & 1))
+	{
+		data[0] = 0x00;
+		data[1] = 0x80 | (length >> 8);
+		data[2] = length & 0xFF;
+		data[3] = 0;
+	}
+	else
+	{
+		data[0] = 0x03;
+		data[1] = 0x00;
+		data[2] = length >> 8;
+		data[3] = length & 0xFF;
+	}
+
+	for (i = 4; i < length; i++)
+		data[i] = (uint8) (sequence + i);
+
+	return length;
+}
+
+static rdpTransport* test_transport_new(rdpSettings* settings, int* sv)
+{
+	rdpTransport* transport;
+
+	CU_ASSERT_FATAL(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == 0);
+
+	transport = transport_new(settings);
+	transport_attach(transport, sv[0]);
+	transport->tcp_out = transport->tcp_in;
+	transport->recv_callback = test_transport_recv;
+	transport_set_blocking_mode(transport, false);
+
+	pdu_count = 0;
+	pdu_bytes = 0;
+	pdu_errors = 0;
+
+	return transport;
+}
+
+static void test_transport_free(rdpTransport* transport, int* sv)
+{
+	transport_free(transport);
+	close(sv[0]);
+	close(sv[1]);
+}
+
+void test_transport_check_fds(void)
+{
+	int sv[2];
+	int length;
+	uint8 data[1024];
+	rdpSettings* settings;
+	rdpTransport* transport;
+
+	settings = settings_new(NULL);
+	transport = test_transport_new(settings, sv);
+
+	/* nothing there yet */
+	CU_ASSERT(transport_check_fds(transport) == 0);
+	CU_ASSERT(pdu_count == 0);
+
+	/* three PDUs and the first bytes of a fourth in one wakeup */
+	length = test_transport_pdu(data, 20, 0);
+	length += test_transport_pdu(data + length, 300, 1);
+	length += test_transport_pdu(data + length, 400, 2);
+	test_transport_pdu(data + length, 100, 3);
+	CU_ASSERT(write(sv[1], data, length + 5) == length + 5);
+
+	CU_ASSERT(transport_check_fds(transport) == 0);
+	CU_ASSERT(pdu_count == 3);
+	CU_ASSERT(pdu_bytes == 720);
+
+	CU_ASSERT(write(sv[1], data + length + 5, 95) == 95);
+	CU_ASSERT(transport_check_fds(transport) == 0);
+	CU_ASSERT(pdu_count == 4);
+	CU_ASSERT(pdu_bytes == 820);
+	CU_ASSERT(pdu_errors == 0);
+
+	/* a fast-path PDU shorter than its own header */
+	data[0] = 0x00;
+	data[1] = 0x01;
+	CU_ASSERT(write(sv[1], data, 2) == 2);
+	CU_ASSERT(transport_check_fds(transport) < 0);
+
+	test_transport_free(transport, sv);
+
+	/* a closed connection is an error */
+	transport = test_transport_new(settings, sv);
+	close(sv[1]);
+	CU_ASSERT(transport_check_fds(transport) < 0);
+	transport_free(transport);
+	close(sv[0]);
+
+	settings_free(settings);
+}
+
+void test_transport_ring_wrap(void)
+{
+	int i, j;
+	int sv[2];
+	int length;
+	int total;
+	uint8* data;
+	rdpSettings* settings;
+	rdpTransport* transport;
+
+	settings = settings_new(NULL);
+	transport = test_transport_new(settings, sv);
+	data = (uint8*) xmalloc(0x10000);
+	total = 0;
+
+	/* PDUs of odd sizes, so some of them wrap around the end of the ring */
+	for (i = 0; i < 64; i++)
+	{
+		length = 0;
+
+		for (j = 0; j < 4; j++)
+			length += test_transport_pdu(data + length, 1000 + 3331 * ((i * 4 + j) % 5), i * 4 + j);
+
+		/* split the last one between two wakeups */
+		CU_ASSERT(write(sv[1], data, length - 7) == length - 7);
+		CU_ASSERT(transport_check_fds(transport) == 0);
+		CU_ASSERT(write(sv[1], data + length - 7, 7) == 7);
+		total += length;
+	}
+
+	CU_ASSERT(transport_check_fds(transport) == 0);
+	CU_ASSERT(pdu_count == 256);
+	CU_ASSERT(pdu_bytes == total);
+	CU_ASSERT(pdu_errors == 0);
+
+	/* one PDU as large as a TPKT can be */
+	pdu_count = 0;
+	length = test_transport_pdu(data, 0xFFFF, 0);
+	CU_ASSERT(write(sv[1], data, 0x8000) == 0x8000);
+	CU_ASSERT(transport_check_fds(transport) == 0);
+	CU_ASSERT(write(sv[1], data + 0x8000, length - 0x8000) == length - 0x8000);
+	CU_ASSERT(transport_check_fds(transport) == 0);
+	CU_ASSERT(pdu_count == 1);
+	CU_ASSERT(pdu_errors == 0);
+
+	xfree(data);
+	test_transport_free(transport, sv);
+	settings_free(settings);
+}
+
+void test_transport_read(void)
+{
+	int sv[2];
+	int length;
+	uint8 data[1024];
+	STREAM* s;
+	rdpSettings* settings;
+	rdpTransport* transport;
+
+	settings = settings_new(NULL);
+	transport = test_transport_new(settings, sv);
+
+	/* two PDUs in one write come out one at a time */
+	length = test_transport_pdu(data, 300, 1);
+	length += test_transport_pdu(data + length, 50, 2);
+	CU_ASSERT(write(sv[1], data, length) == length);
+
+	s = transport_recv_stream_init(transport, 1024);
+	CU_ASSERT(transport_read(transport, s) == 300);
+	CU_ASSERT(memcmp(stream_get_head(s), data, 300) == 0);
+
+	s = transport_recv_stream_init(transport, 1024);
+	CU_ASSERT(transport_read(transport, s) == 50);
+	CU_ASSERT(memcmp(stream_get_head(s), data + 300, 50) == 0);
+
+	/* non-blocking with nothing left */
+	s = transport_recv_stream_init(transport, 1024);
+	CU_ASSERT(transport_read(transport, s) == 0);
+
+	test_transport_free(transport, sv);
+	settings_free(settings);
+}
+
+/* read everything the transport sends, flushing its queue in between */
+static int test_transport_drain(rdpTransport* transport, int fd, uint8* data, int size)
+{
+	int status;
+	int length;
+
+	length = 0;
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+	while (true)
+	{
+		status = read(fd, data + length, size - length);
+
+		if (status > 0)
+		{
+			length += status;
+			continue;
+		}
+
+		if (transport_get_queued_bytes(transport) == 0)
+			break;
+
+		CU_ASSERT(transport_flush(transport) >= 0);
+	}
+
+	return length;
+}
+
+void test_transport_write(void)
+{
+	int i;
+	int sv[2];
+	int length;
+	int total;
+	uint8* data;
+	uint8* received;
+	STREAM* s;
+	rdpSettings* settings;
+	rdpTransport* transport;
+
+	settings = settings_new(NULL);
+	transport = test_transport_new(settings, sv);
+	data = (uint8*) xmalloc(0x400000);
+	received = (uint8*) xmalloc(0x400000);
+
+	/* more than the socket takes, the rest waits in the queue */
+	total = 0;
+
+	for (i = 0; i < 256; i++)
+	{
+		s = transport_send_stream_init(transport, 0x4000);
+		length = test_transport_pdu(s->data, 0x4000, i);
+		stream_seek(s, length);
+		memcpy(data + total, s->data, length);
+		total += length;
+
+		CU_ASSERT(transport_write(transport, s) == length);
+	}
+
+	CU_ASSERT(transport_get_queued_bytes(transport) > 0);
+	CU_ASSERT(test_transport_drain(transport, sv[1], received, 0x400000) == total);
+	CU_ASSERT(memcmp(received, data, total) == 0);
+
+	/* corked PDUs are only sent at the end */
+	total = 0;
+	transport_cork(transport);
+
+	for (i = 0; i < 3; i++)
+	{
+		s = transport_send_stream_init(transport, 100);
+		length = test_transport_pdu(s->data, 100, i);
+		stream_seek(s, length);
+		memcpy(data + total, s->data, length);
+		total += length;
+
+		CU_ASSERT(transport_write(transport, s) == length);
+	}
+
+	CU_ASSERT(transport_get_queued_bytes(transport) == total);
+	CU_ASSERT(read(sv[1], received, total) < 0);
+	CU_ASSERT(transport_uncork(transport) == 0);
+	CU_ASSERT(read(sv[1], received, total) == total);
+	CU_ASSERT(memcmp(received, data, total) == 0);
+
+	/* a write to a closed connection fails */
+	close(sv[1]);
+	s = transport_send_stream_init(transport, 100);
+	stream_seek(s, test_transport_pdu(s->data, 100, 0));
+	CU_ASSERT(transport_write(transport, s) < 0);
+
+	xfree(data);
+	xfree(received);
+	transport_free(transport);
+	close(sv[0]);
+	settings_free(settings);
+}
+
+void test_transport_write_limit(void)
+{
+	int i;
+	int sv[2];
+	STREAM* s;
+	rdpSettings* settings;
+	rdpTransport* transport;
+
+	settings = settings_new(NULL);
+	transport = test_transport_new(settings, sv);
+
+	/* a client that stops reading fails the write once the queue is full */
+	for (i = 0; i < TRANSPORT_MAX_QUEUED / 0x4000 * 2; i++)
+	{
+		s = transport_send_stream_init(transport, 0x4000);
+		stream_seek(s, test_transport_pdu(s->data, 0x4000, i));
+
+		if (transport_write(transport, s) < 0)
+			break;
+	}
+
+	CU_ASSERT(i < TRANSPORT_MAX_QUEUED / 0x4000 * 2);
+	CU_ASSERT(transport_get_queued_bytes(transport) <= TRANSPORT_MAX_QUEUED);
+
+	test_transport_free(transport, sv);
+	settings_free(settings);
+}
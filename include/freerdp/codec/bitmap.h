@@ -21,6 +21,7 @@
 #define __BITMAP_H
 
 #include <freerdp/types.h>
+#include <freerdp/utils/stream.h>
 
 struct bitmap_extra
 {
@@ -35,5 +36,6 @@ typedef struct bitmap_extra bitmapExtra;
 
 FREERDP_API tbool bitmap_decompress(uint8* srcData, uint8* dstData, int width, int height, int size, int srcBpp, int dstBpp);
 FREERDP_API tbool bitmap_decompress_ex(uint8* srcData, uint8* dstData, int width, int height, int size, int srcBpp, int dstBpp, bitmapExtra* be);
+FREERDP_API int bitmap_compress(uint8* srcData, STREAM* s, int width, int height, int bpp);
 
 #endif /* __BITMAP_H */
@@ -236,8 +236,12 @@ typedef CLRCONV* HCLRCONV;
 #define IBPP(_bpp) (((_bpp + 1)/ 8) % 5)
 
 typedef uint8* (*p_freerdp_image_convert)(uint8* srcData, uint8* dstData, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv);
+typedef void (*p_freerdp_image_convert_ex)(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
 
 FREERDP_API uint8* freerdp_image_convert(uint8* srcData, uint8 *dstData, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv);
+FREERDP_API boolean freerdp_image_convert_ex(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv);
+FREERDP_API p_freerdp_image_convert_ex freerdp_image_convert_select(int srcBpp, int dstBpp, HCLRCONV clrconv);
+FREERDP_API void freerdp_image_convert_set_cpu_opt(uint32 cpu_opt);
 FREERDP_API uint8* freerdp_glyph_convert(int width, int height, uint8* data);
 FREERDP_API void   freerdp_bitmap_flip(uint8 * src, uint8 * dst, int scanLineSz, int height);
 FREERDP_API uint8* freerdp_image_flip(uint8* srcData, uint8* dstData, int width, int height, int bpp);
@@ -0,0 +1,61 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * H.264 Surface Bits Decoder
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __H264_H
+#define __H264_H
+
+#include <freerdp/api.h>
+#include <freerdp/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _H264_CONTEXT H264_CONTEXT;
+
+struct _H264_CONTEXT
+{
+	/* size of the last frame out of the decoder */
+	int width;
+	int height;
+
+	/* destination and rects of the last frame out of the decoder, as given with its packet */
+	int left;
+	int top;
+	RECTANGLE_16* rects;
+	int num_rects;
+
+	/* libavcodec state, NULL when built without H.264 support */
+	void* priv;
+
+	/* routines */
+	void (*yuv420_to_bgrx)(const uint8* const planes[3], const int strides[3],
+		int x, int y, int width, int height, uint8* dst, int dst_stride);
+};
+
+FREERDP_API H264_CONTEXT* h264_context_new(void);
+FREERDP_API void h264_context_free(H264_CONTEXT* context);
+FREERDP_API void h264_context_set_cpu_opt(H264_CONTEXT* context, uint32 cpu_opt);
+FREERDP_API void h264_context_set_thread_count(H264_CONTEXT* context, int thread_count);
+FREERDP_API int h264_decompress(H264_CONTEXT* context, uint8* data, int size, RECTANGLE_16* rects, int num_rects,
+	int left, int top, uint8* dst, int dst_stride, int dst_width, int dst_height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __H264_H */
@@ -20,9 +20,60 @@
 #ifndef __JPEG_H
 #define __JPEG_H
 
+#include <freerdp/api.h>
 #include <freerdp/types.h>
+#include <freerdp/utils/stream.h>
 
-boolean
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* one image of a batch for jpeg_context_decompress_jobs() */
+struct _JPEG_JOB
+{
+	uint8* input;
+	int size;
+	uint8* output;
+	int stride;	/* bytes between output rows, negative for bottom-up output */
+	int width;
+	int height;
+	int bpp;
+	boolean success;
+};
+typedef struct _JPEG_JOB JPEG_JOB;
+
+typedef struct _JPEG_CONTEXT JPEG_CONTEXT;
+
+struct _JPEG_CONTEXT
+{
+	/* decoder settings, fast_idct also selects the encoder DCT */
+	boolean fast_idct;
+	boolean fancy_upsampling;
+
+	/* encoder settings */
+	int quality;
+
+	/* decoder and encoder state, kept across images */
+	void* priv;
+};
+
+FREERDP_API JPEG_CONTEXT* jpeg_context_new(void);
+FREERDP_API void jpeg_context_free(JPEG_CONTEXT* context);
+FREERDP_API void jpeg_context_set_fast_idct(JPEG_CONTEXT* context, boolean enabled);
+FREERDP_API void jpeg_context_set_fancy_upsampling(JPEG_CONTEXT* context, boolean enabled);
+FREERDP_API void jpeg_context_set_quality(JPEG_CONTEXT* context, int quality);
+FREERDP_API void jpeg_context_set_thread_count(JPEG_CONTEXT* context, int count);
+FREERDP_API boolean jpeg_context_decompress(JPEG_CONTEXT* context, uint8* input, int size,
+	uint8* output, int stride, int width, int height, int bpp);
+FREERDP_API int jpeg_context_decompress_jobs(JPEG_CONTEXT* context, JPEG_JOB* jobs, int count);
+FREERDP_API boolean jpeg_compose_message(JPEG_CONTEXT* context, STREAM* s,
+	uint8* data, int width, int height, int rowstride);
+
+FREERDP_API boolean
 jpeg_decompress(uint8* input, uint8* output, int width, int height, int size, int bpp);
 
-#endif /* __BITMAP_H */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __JPEG_H */
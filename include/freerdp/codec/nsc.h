@@ -28,8 +28,7 @@
 extern "C" {
 #endif
 
-#define BYTESUM(_bs) (_bs[0] + _bs[1] + _bs[2] + _bs[3])
-#define ROUND_UP_TO(_b, _n) (_b + ((~(_b & (_n-1)) + 0x1) & (_n-1)));
+#define ROUND_UP_TO(_b, _n) (_b + ((~(_b & (_n-1)) + 0x1) & (_n-1)))
 
 /* NSCODEC_BITMAP_STREAM */
 struct _NSC_STREAM
@@ -38,10 +37,12 @@ struct _NSC_STREAM
 	uint8 colorLossLevel;
 	uint8 ChromaSubSamplingLevel;
 	uint16 Reserved;
-	STREAM* pdata;
+	uint8* pdata;
 };
 typedef struct _NSC_STREAM NSC_STREAM;
 
+typedef struct _NSC_CONTEXT NSC_CONTEXT;
+
 struct _NSC_CONTEXT
 {
 	uint32 OrgByteCount[4];	/* original byte length of luma, chroma orange, chroma green, alpha variable in order */
@@ -49,22 +50,32 @@ struct _NSC_CONTEXT
 	uint16 width;
 	uint16 height;
 	uint8* bmpdata;     /* final argb values in little endian order */
-	STREAM* org_buf[4];	/* Decompressed Plane Buffers in the respective order */
+	uint32 bmpdata_length;
+
+	/* planes of the current message, NULL for an alpha plane left out by the encoder */
+	const uint8* planes[4];
+
+	/* plane buffers, kept across messages */
+	uint8* plane_buf[4];
+	uint32 plane_buf_length[4];
+
+	/* encoder settings */
+	uint8 color_loss_level;
+	boolean chroma_subsampling;
+
+	/* routines */
+	void (*decode)(NSC_CONTEXT* context);
+	void (*encode)(NSC_CONTEXT* context, const uint8* bmpdata, int rowstride);
 };
-typedef struct _NSC_CONTEXT NSC_CONTEXT;
 
 FREERDP_API NSC_CONTEXT* nsc_context_new(void);
-FREERDP_API void nsc_process_message(NSC_CONTEXT* context, uint8* data, uint32 length);
-FREERDP_API void nsc_context_initialize(NSC_CONTEXT* context, STREAM* s);
-FREERDP_API void nsc_stream_initialize(NSC_CONTEXT* context, STREAM* s);
-FREERDP_API void nsc_rle_decompress_data(NSC_CONTEXT* context);
-FREERDP_API void nsc_ycocg_rgb_convert(NSC_CONTEXT* context);
-FREERDP_API void nsc_rle_decode(STREAM* in, STREAM* out, uint32 origsz);
-FREERDP_API void nsc_chroma_supersample(NSC_CONTEXT* context);
-FREERDP_API void nsc_cl_expand(STREAM* stream, uint8 shiftcount, uint32 origsz);
-FREERDP_API void nsc_colorloss_recover(NSC_CONTEXT* context);
-FREERDP_API void nsc_ycocg_rgb(NSC_CONTEXT* context);
-FREERDP_API void nsc_context_destroy(NSC_CONTEXT* context);
+FREERDP_API void nsc_context_free(NSC_CONTEXT* context);
+FREERDP_API void nsc_context_set_cpu_opt(NSC_CONTEXT* context, uint32 cpu_opt);
+FREERDP_API void nsc_context_set_color_loss_level(NSC_CONTEXT* context, int color_loss_level);
+FREERDP_API void nsc_context_set_chroma_subsampling(NSC_CONTEXT* context, boolean enabled);
+FREERDP_API boolean nsc_process_message(NSC_CONTEXT* context, uint8* data, uint32 length);
+FREERDP_API void nsc_compose_message(NSC_CONTEXT* context, STREAM* s,
+	uint8* bmpdata, int width, int height, int rowstride);
 
 #ifdef __cplusplus
 }
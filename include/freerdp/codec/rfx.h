@@ -85,6 +85,17 @@ struct _RFX_MESSAGE
 };
 typedef struct _RFX_MESSAGE RFX_MESSAGE;
 
+#define RFX_QUALITY_LEVELS 9
+
+struct _RFX_RATE_STATS
+{
+	uint32 frame_bits; /* size of the last encoded frame */
+	uint32 average_frame_bits; /* running average over the last frames */
+	uint32 bitrate; /* average bits per second, 0 if the frame rate is unknown */
+	int quality; /* quantization level of the last frame, 0 (coarsest) to RFX_QUALITY_LEVELS - 1, or -1 */
+};
+typedef struct _RFX_RATE_STATS RFX_RATE_STATS;
+
 typedef struct _RFX_CONTEXT_PRIV RFX_CONTEXT_PRIV;
 
 struct _RFX_CONTEXT
@@ -115,6 +126,8 @@ struct _RFX_CONTEXT
 	/* routines */
 	void (*decode_ycbcr_to_rgb)(sint16* y_r_buf, sint16* cb_g_buf, sint16* cr_b_buf);
 	void (*encode_rgb_to_ycbcr)(sint16* y_r_buf, sint16* cb_g_buf, sint16* cr_b_buf);
+	boolean (*encode_format_rgb_to_ycbcr)(const uint8* rgb_data, int width, int height, int rowstride,
+		RFX_PIXEL_FORMAT pixel_format, sint16* y_buf, sint16* cb_buf, sint16* cr_buf);
 	void (*quantization_decode)(sint16* buffer, const uint32* quantization_values);
 	void (*quantization_encode)(sint16* buffer, const uint32* quantization_values);
 	void (*dwt_2d_decode)(sint16* buffer, sint16* dwt_buffer);
@@ -128,10 +141,18 @@ typedef struct _RFX_CONTEXT RFX_CONTEXT;
 FREERDP_API RFX_CONTEXT* rfx_context_new(void);
 FREERDP_API void rfx_context_free(RFX_CONTEXT* context);
 FREERDP_API void rfx_context_set_cpu_opt(RFX_CONTEXT* context, uint32 cpu_opt);
+FREERDP_API void rfx_context_set_thread_count(RFX_CONTEXT* context, int count);
+FREERDP_API void rfx_context_set_tile_cache(RFX_CONTEXT* context, boolean enabled);
+FREERDP_API void rfx_context_set_target_frame_bits(RFX_CONTEXT* context, uint32 bits_per_frame);
+FREERDP_API void rfx_context_set_target_bitrate(RFX_CONTEXT* context, uint32 bits_per_second, uint32 frame_rate);
+FREERDP_API void rfx_context_get_rate_stats(RFX_CONTEXT* context, RFX_RATE_STATS* stats);
 FREERDP_API void rfx_context_set_pixel_format(RFX_CONTEXT* context, RFX_PIXEL_FORMAT pixel_format);
 FREERDP_API void rfx_context_reset(RFX_CONTEXT* context);
 
 FREERDP_API RFX_MESSAGE* rfx_process_message(RFX_CONTEXT* context, uint8* data, uint32 length);
+FREERDP_API RFX_MESSAGE* rfx_process_message_to_surface(RFX_CONTEXT* context, uint8* data, uint32 length,
+	uint8* dst, int dst_stride, RFX_PIXEL_FORMAT dst_format, int dst_width, int dst_height,
+	int dest_left, int dest_top);
 FREERDP_API uint16 rfx_message_get_tile_count(RFX_MESSAGE* message);
 FREERDP_API RFX_TILE* rfx_message_get_tile(RFX_MESSAGE* message, int index);
 FREERDP_API uint16 rfx_message_get_rect_count(RFX_MESSAGE* message);
@@ -145,6 +145,13 @@ struct _GDI_BITMAP
 typedef struct _GDI_BITMAP GDI_BITMAP;
 typedef GDI_BITMAP* HGDI_BITMAP;
 
+/**
+ * Byte offset of row y. A negative scanline marks a bottom-up bitmap, its
+ * data then points to the top row; otherwise rows are width pixels apart.
+ */
+#define GDI_BITMAP_ROW_OFFSET(_hBmp, _y, _bytesPerPixel) \
+	(((_hBmp)->scanline < 0) ? ((_y) * (_hBmp)->scanline) : ((_y) * (_hBmp)->width * (_bytesPerPixel)))
+
 struct _GDI_PEN
 {
 	uint8 objectType;
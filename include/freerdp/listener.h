@@ -52,6 +52,9 @@ struct rdp_freerdp_listener
 	psListenerClose Close;
 
 	psPeerAccepted PeerAccepted;
+
+	/* when set, accepted peers are handed to this freerdp_runtime after PeerAccepted */
+	void* runtime;
 };
 
 FREERDP_API freerdp_listener* freerdp_listener_new(void);
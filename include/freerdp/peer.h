@@ -65,6 +65,9 @@ struct rdp_freerdp_peer
 
 	psPeerSendChannelData SendChannelData;
 	psPeerReceiveChannelData ReceiveChannelData;
+
+	/* the runtime session serving this peer, if any */
+	void* runtime;
 };
 
 FREERDP_API void freerdp_peer_context_new(freerdp_peer* client);
@@ -73,5 +76,7 @@ FREERDP_API void freerdp_peer_context_free(freerdp_peer* client);
 FREERDP_API freerdp_peer* freerdp_peer_new(int sockfd);
 FREERDP_API void freerdp_peer_free(freerdp_peer* client);
 
+FREERDP_API uint32 freerdp_peer_get_queued_bytes(freerdp_peer* client);
+
 #endif /* __FREERDP_PEER_H */
 
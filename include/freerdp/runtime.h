@@ -0,0 +1,71 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * RDP Server Runtime
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __FREERDP_RUNTIME_H
+#define __FREERDP_RUNTIME_H
+
+typedef struct rdp_freerdp_runtime freerdp_runtime;
+
+#include <freerdp/api.h>
+#include <freerdp/types.h>
+#include <freerdp/peer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A runtime serves many peers on a few worker threads. Each peer is a
+ * session that stays on one worker: the file descriptors of the peer and
+ * of the sources added for it are polled there, its timers fire there, and
+ * none of its callbacks ever run concurrently. A session is closed when one
+ * of its callbacks returns false.
+ *
+ * Sources and timers are added before freerdp_runtime_add_peer(), or later
+ * from the callbacks of the same session.
+ */
+
+typedef boolean (*psRuntimeGetFileDescriptor)(void* object, void** rfds, int* rcount);
+typedef boolean (*psRuntimeCheckFileDescriptor)(void* object);
+typedef boolean (*psRuntimeTimer)(freerdp_peer* client, void* param);
+typedef void (*psRuntimePeerClosed)(freerdp_runtime* instance, freerdp_peer* client);
+
+struct rdp_freerdp_runtime
+{
+	void* info;
+	void* runtime;
+	void* param1;
+	void* param2;
+
+	/* called on the worker once a session is closed, by default the peer is disconnected and freed */
+	psRuntimePeerClosed PeerClosed;
+};
+
+FREERDP_API freerdp_runtime* freerdp_runtime_new(int workers);
+FREERDP_API void freerdp_runtime_free(freerdp_runtime* instance);
+
+FREERDP_API boolean freerdp_runtime_add_peer(freerdp_runtime* instance, freerdp_peer* client);
+FREERDP_API boolean freerdp_runtime_add_source(freerdp_runtime* instance, freerdp_peer* client, void* object,
+	psRuntimeGetFileDescriptor GetFileDescriptor, psRuntimeCheckFileDescriptor CheckFileDescriptor);
+FREERDP_API boolean freerdp_runtime_add_timer(freerdp_runtime* instance, freerdp_peer* client,
+	uint32 interval, psRuntimeTimer callback, void* param);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FREERDP_RUNTIME_H */
@@ -270,7 +270,8 @@ struct rdp_settings
 	boolean compression; /* 59 */
 	uint32 performance_flags; /* 60 */
 	rdpBlob* password_cookie; /* 61 */
-	uint32 paddingC[80 - 62]; /* 62 */
+	uint32 compression_type; /* 62 */
+	uint32 paddingC[80 - 63]; /* 63 */
 
 	/* User Interface Parameters */
 	boolean sw_gdi; /* 80 */
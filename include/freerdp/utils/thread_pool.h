@@ -0,0 +1,38 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * Thread Pool Utils
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __THREAD_POOL_UTILS_H
+#define __THREAD_POOL_UTILS_H
+
+#include <freerdp/api.h>
+#include <freerdp/types.h>
+
+typedef struct _freerdp_thread_pool freerdp_thread_pool;
+
+/**
+ * Job callback, invoked once for every index in [0, count).
+ * worker is in [0, freerdp_thread_pool_get_size()] and identifies the thread
+ * running the job, so that callers can index per-thread scratch buffers.
+ */
+typedef void (*freerdp_thread_pool_func)(void* arg, int worker, int index);
+
+FREERDP_API freerdp_thread_pool* freerdp_thread_pool_new(int size);
+FREERDP_API void freerdp_thread_pool_free(freerdp_thread_pool* pool);
+FREERDP_API int freerdp_thread_pool_get_size(freerdp_thread_pool* pool);
+FREERDP_API void freerdp_thread_pool_run(freerdp_thread_pool* pool, freerdp_thread_pool_func func, void* arg, int count);
+
+#endif /* __THREAD_POOL_UTILS_H */
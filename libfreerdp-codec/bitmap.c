@@ -51,6 +51,10 @@
 #define SPECIAL_WHITE               0xFD
 #define SPECIAL_BLACK               0xFE
 
+/* RDP6_BITMAP_STREAM format header flags */
+#define PLANAR_FORMAT_HEADER_RLE    0x10
+#define PLANAR_FORMAT_HEADER_NA     0x20
+
 #define BLACK_PIXEL 0x000000
 #define WHITE_PIXEL 0xFFFFFF
 
@@ -238,6 +242,226 @@ static uint32 ExtractRunLength(uint32 code, uint8* pbOrderHdr, uint32* advance)
 #define RLEEXTRA
 #include "include/bitmap.c"
 
+/*
+ * Decoders writing 32 bpp straight away, laid out as freerdp_image_convert()
+ * would without CLRCONV_INVERT. Orders still work on source pixels, so
+ * reading a pixel back converts it to the source depth, which is lossless.
+ * 15 and 16 bpp pixels are expanded one byte at a time through the tables
+ * below, the green field being split across both bytes.
+ */
+
+static const uint32 g_RGB16LowTo32[256] =
+{
+	0x000000, 0x000008, 0x000010, 0x000018, 0x000021, 0x000029, 0x000031, 0x000039,
+	0x000042, 0x00004A, 0x000052, 0x00005A, 0x000063, 0x00006B, 0x000073, 0x00007B,
+	0x000084, 0x00008C, 0x000094, 0x00009C, 0x0000A5, 0x0000AD, 0x0000B5, 0x0000BD,
+	0x0000C6, 0x0000CE, 0x0000D6, 0x0000DE, 0x0000E7, 0x0000EF, 0x0000F7, 0x0000FF,
+	0x000400, 0x000408, 0x000410, 0x000418, 0x000421, 0x000429, 0x000431, 0x000439,
+	0x000442, 0x00044A, 0x000452, 0x00045A, 0x000463, 0x00046B, 0x000473, 0x00047B,
+	0x000484, 0x00048C, 0x000494, 0x00049C, 0x0004A5, 0x0004AD, 0x0004B5, 0x0004BD,
+	0x0004C6, 0x0004CE, 0x0004D6, 0x0004DE, 0x0004E7, 0x0004EF, 0x0004F7, 0x0004FF,
+	0x000800, 0x000808, 0x000810, 0x000818, 0x000821, 0x000829, 0x000831, 0x000839,
+	0x000842, 0x00084A, 0x000852, 0x00085A, 0x000863, 0x00086B, 0x000873, 0x00087B,
+	0x000884, 0x00088C, 0x000894, 0x00089C, 0x0008A5, 0x0008AD, 0x0008B5, 0x0008BD,
+	0x0008C6, 0x0008CE, 0x0008D6, 0x0008DE, 0x0008E7, 0x0008EF, 0x0008F7, 0x0008FF,
+	0x000C00, 0x000C08, 0x000C10, 0x000C18, 0x000C21, 0x000C29, 0x000C31, 0x000C39,
+	0x000C42, 0x000C4A, 0x000C52, 0x000C5A, 0x000C63, 0x000C6B, 0x000C73, 0x000C7B,
+	0x000C84, 0x000C8C, 0x000C94, 0x000C9C, 0x000CA5, 0x000CAD, 0x000CB5, 0x000CBD,
+	0x000CC6, 0x000CCE, 0x000CD6, 0x000CDE, 0x000CE7, 0x000CEF, 0x000CF7, 0x000CFF,
+	0x001000, 0x001008, 0x001010, 0x001018, 0x001021, 0x001029, 0x001031, 0x001039,
+	0x001042, 0x00104A, 0x001052, 0x00105A, 0x001063, 0x00106B, 0x001073, 0x00107B,
+	0x001084, 0x00108C, 0x001094, 0x00109C, 0x0010A5, 0x0010AD, 0x0010B5, 0x0010BD,
+	0x0010C6, 0x0010CE, 0x0010D6, 0x0010DE, 0x0010E7, 0x0010EF, 0x0010F7, 0x0010FF,
+	0x001400, 0x001408, 0x001410, 0x001418, 0x001421, 0x001429, 0x001431, 0x001439,
+	0x001442, 0x00144A, 0x001452, 0x00145A, 0x001463, 0x00146B, 0x001473, 0x00147B,
+	0x001484, 0x00148C, 0x001494, 0x00149C, 0x0014A5, 0x0014AD, 0x0014B5, 0x0014BD,
+	0x0014C6, 0x0014CE, 0x0014D6, 0x0014DE, 0x0014E7, 0x0014EF, 0x0014F7, 0x0014FF,
+	0x001800, 0x001808, 0x001810, 0x001818, 0x001821, 0x001829, 0x001831, 0x001839,
+	0x001842, 0x00184A, 0x001852, 0x00185A, 0x001863, 0x00186B, 0x001873, 0x00187B,
+	0x001884, 0x00188C, 0x001894, 0x00189C, 0x0018A5, 0x0018AD, 0x0018B5, 0x0018BD,
+	0x0018C6, 0x0018CE, 0x0018D6, 0x0018DE, 0x0018E7, 0x0018EF, 0x0018F7, 0x0018FF,
+	0x001C00, 0x001C08, 0x001C10, 0x001C18, 0x001C21, 0x001C29, 0x001C31, 0x001C39,
+	0x001C42, 0x001C4A, 0x001C52, 0x001C5A, 0x001C63, 0x001C6B, 0x001C73, 0x001C7B,
+	0x001C84, 0x001C8C, 0x001C94, 0x001C9C, 0x001CA5, 0x001CAD, 0x001CB5, 0x001CBD,
+	0x001CC6, 0x001CCE, 0x001CD6, 0x001CDE, 0x001CE7, 0x001CEF, 0x001CF7, 0x001CFF
+};
+
+static const uint32 g_RGB16HighTo32[256] =
+{
+	0x000000, 0x002000, 0x004100, 0x006100, 0x008200, 0x00A200, 0x00C300, 0x00E300,
+	0x080000, 0x082000, 0x084100, 0x086100, 0x088200, 0x08A200, 0x08C300, 0x08E300,
+	0x100000, 0x102000, 0x104100, 0x106100, 0x108200, 0x10A200, 0x10C300, 0x10E300,
+	0x180000, 0x182000, 0x184100, 0x186100, 0x188200, 0x18A200, 0x18C300, 0x18E300,
+	0x210000, 0x212000, 0x214100, 0x216100, 0x218200, 0x21A200, 0x21C300, 0x21E300,
+	0x290000, 0x292000, 0x294100, 0x296100, 0x298200, 0x29A200, 0x29C300, 0x29E300,
+	0x310000, 0x312000, 0x314100, 0x316100, 0x318200, 0x31A200, 0x31C300, 0x31E300,
+	0x390000, 0x392000, 0x394100, 0x396100, 0x398200, 0x39A200, 0x39C300, 0x39E300,
+	0x420000, 0x422000, 0x424100, 0x426100, 0x428200, 0x42A200, 0x42C300, 0x42E300,
+	0x4A0000, 0x4A2000, 0x4A4100, 0x4A6100, 0x4A8200, 0x4AA200, 0x4AC300, 0x4AE300,
+	0x520000, 0x522000, 0x524100, 0x526100, 0x528200, 0x52A200, 0x52C300, 0x52E300,
+	0x5A0000, 0x5A2000, 0x5A4100, 0x5A6100, 0x5A8200, 0x5AA200, 0x5AC300, 0x5AE300,
+	0x630000, 0x632000, 0x634100, 0x636100, 0x638200, 0x63A200, 0x63C300, 0x63E300,
+	0x6B0000, 0x6B2000, 0x6B4100, 0x6B6100, 0x6B8200, 0x6BA200, 0x6BC300, 0x6BE300,
+	0x730000, 0x732000, 0x734100, 0x736100, 0x738200, 0x73A200, 0x73C300, 0x73E300,
+	0x7B0000, 0x7B2000, 0x7B4100, 0x7B6100, 0x7B8200, 0x7BA200, 0x7BC300, 0x7BE300,
+	0x840000, 0x842000, 0x844100, 0x846100, 0x848200, 0x84A200, 0x84C300, 0x84E300,
+	0x8C0000, 0x8C2000, 0x8C4100, 0x8C6100, 0x8C8200, 0x8CA200, 0x8CC300, 0x8CE300,
+	0x940000, 0x942000, 0x944100, 0x946100, 0x948200, 0x94A200, 0x94C300, 0x94E300,
+	0x9C0000, 0x9C2000, 0x9C4100, 0x9C6100, 0x9C8200, 0x9CA200, 0x9CC300, 0x9CE300,
+	0xA50000, 0xA52000, 0xA54100, 0xA56100, 0xA58200, 0xA5A200, 0xA5C300, 0xA5E300,
+	0xAD0000, 0xAD2000, 0xAD4100, 0xAD6100, 0xAD8200, 0xADA200, 0xADC300, 0xADE300,
+	0xB50000, 0xB52000, 0xB54100, 0xB56100, 0xB58200, 0xB5A200, 0xB5C300, 0xB5E300,
+	0xBD0000, 0xBD2000, 0xBD4100, 0xBD6100, 0xBD8200, 0xBDA200, 0xBDC300, 0xBDE300,
+	0xC60000, 0xC62000, 0xC64100, 0xC66100, 0xC68200, 0xC6A200, 0xC6C300, 0xC6E300,
+	0xCE0000, 0xCE2000, 0xCE4100, 0xCE6100, 0xCE8200, 0xCEA200, 0xCEC300, 0xCEE300,
+	0xD60000, 0xD62000, 0xD64100, 0xD66100, 0xD68200, 0xD6A200, 0xD6C300, 0xD6E300,
+	0xDE0000, 0xDE2000, 0xDE4100, 0xDE6100, 0xDE8200, 0xDEA200, 0xDEC300, 0xDEE300,
+	0xE70000, 0xE72000, 0xE74100, 0xE76100, 0xE78200, 0xE7A200, 0xE7C300, 0xE7E300,
+	0xEF0000, 0xEF2000, 0xEF4100, 0xEF6100, 0xEF8200, 0xEFA200, 0xEFC300, 0xEFE300,
+	0xF70000, 0xF72000, 0xF74100, 0xF76100, 0xF78200, 0xF7A200, 0xF7C300, 0xF7E300,
+	0xFF0000, 0xFF2000, 0xFF4100, 0xFF6100, 0xFF8200, 0xFFA200, 0xFFC300, 0xFFE300
+};
+
+#define RGB16_TO_32(_p) (g_RGB16LowTo32[(_p) & 0xFF] | g_RGB16HighTo32[((_p) >> 8) & 0xFF])
+#define RGB32_TO_16(_p) (((((_p) >> 19) & 0x1F) << 11) | ((((_p) >> 10) & 0x3F) << 5) | \
+  (((_p) >> 3) & 0x1F))
+static const uint32 g_RGB15LowTo32[256] =
+{
+	0x000000, 0x000008, 0x000010, 0x000018, 0x000021, 0x000029, 0x000031, 0x000039,
+	0x000042, 0x00004A, 0x000052, 0x00005A, 0x000063, 0x00006B, 0x000073, 0x00007B,
+	0x000084, 0x00008C, 0x000094, 0x00009C, 0x0000A5, 0x0000AD, 0x0000B5, 0x0000BD,
+	0x0000C6, 0x0000CE, 0x0000D6, 0x0000DE, 0x0000E7, 0x0000EF, 0x0000F7, 0x0000FF,
+	0x000800, 0x000808, 0x000810, 0x000818, 0x000821, 0x000829, 0x000831, 0x000839,
+	0x000842, 0x00084A, 0x000852, 0x00085A, 0x000863, 0x00086B, 0x000873, 0x00087B,
+	0x000884, 0x00088C, 0x000894, 0x00089C, 0x0008A5, 0x0008AD, 0x0008B5, 0x0008BD,
+	0x0008C6, 0x0008CE, 0x0008D6, 0x0008DE, 0x0008E7, 0x0008EF, 0x0008F7, 0x0008FF,
+	0x001000, 0x001008, 0x001010, 0x001018, 0x001021, 0x001029, 0x001031, 0x001039,
+	0x001042, 0x00104A, 0x001052, 0x00105A, 0x001063, 0x00106B, 0x001073, 0x00107B,
+	0x001084, 0x00108C, 0x001094, 0x00109C, 0x0010A5, 0x0010AD, 0x0010B5, 0x0010BD,
+	0x0010C6, 0x0010CE, 0x0010D6, 0x0010DE, 0x0010E7, 0x0010EF, 0x0010F7, 0x0010FF,
+	0x001800, 0x001808, 0x001810, 0x001818, 0x001821, 0x001829, 0x001831, 0x001839,
+	0x001842, 0x00184A, 0x001852, 0x00185A, 0x001863, 0x00186B, 0x001873, 0x00187B,
+	0x001884, 0x00188C, 0x001894, 0x00189C, 0x0018A5, 0x0018AD, 0x0018B5, 0x0018BD,
+	0x0018C6, 0x0018CE, 0x0018D6, 0x0018DE, 0x0018E7, 0x0018EF, 0x0018F7, 0x0018FF,
+	0x002100, 0x002108, 0x002110, 0x002118, 0x002121, 0x002129, 0x002131, 0x002139,
+	0x002142, 0x00214A, 0x002152, 0x00215A, 0x002163, 0x00216B, 0x002173, 0x00217B,
+	0x002184, 0x00218C, 0x002194, 0x00219C, 0x0021A5, 0x0021AD, 0x0021B5, 0x0021BD,
+	0x0021C6, 0x0021CE, 0x0021D6, 0x0021DE, 0x0021E7, 0x0021EF, 0x0021F7, 0x0021FF,
+	0x002900, 0x002908, 0x002910, 0x002918, 0x002921, 0x002929, 0x002931, 0x002939,
+	0x002942, 0x00294A, 0x002952, 0x00295A, 0x002963, 0x00296B, 0x002973, 0x00297B,
+	0x002984, 0x00298C, 0x002994, 0x00299C, 0x0029A5, 0x0029AD, 0x0029B5, 0x0029BD,
+	0x0029C6, 0x0029CE, 0x0029D6, 0x0029DE, 0x0029E7, 0x0029EF, 0x0029F7, 0x0029FF,
+	0x003100, 0x003108, 0x003110, 0x003118, 0x003121, 0x003129, 0x003131, 0x003139,
+	0x003142, 0x00314A, 0x003152, 0x00315A, 0x003163, 0x00316B, 0x003173, 0x00317B,
+	0x003184, 0x00318C, 0x003194, 0x00319C, 0x0031A5, 0x0031AD, 0x0031B5, 0x0031BD,
+	0x0031C6, 0x0031CE, 0x0031D6, 0x0031DE, 0x0031E7, 0x0031EF, 0x0031F7, 0x0031FF,
+	0x003900, 0x003908, 0x003910, 0x003918, 0x003921, 0x003929, 0x003931, 0x003939,
+	0x003942, 0x00394A, 0x003952, 0x00395A, 0x003963, 0x00396B, 0x003973, 0x00397B,
+	0x003984, 0x00398C, 0x003994, 0x00399C, 0x0039A5, 0x0039AD, 0x0039B5, 0x0039BD,
+	0x0039C6, 0x0039CE, 0x0039D6, 0x0039DE, 0x0039E7, 0x0039EF, 0x0039F7, 0x0039FF
+};
+
+static const uint32 g_RGB15HighTo32[256] =
+{
+	0x000000, 0x004200, 0x008400, 0x00C600, 0x080000, 0x084200, 0x088400, 0x08C600,
+	0x100000, 0x104200, 0x108400, 0x10C600, 0x180000, 0x184200, 0x188400, 0x18C600,
+	0x210000, 0x214200, 0x218400, 0x21C600, 0x290000, 0x294200, 0x298400, 0x29C600,
+	0x310000, 0x314200, 0x318400, 0x31C600, 0x390000, 0x394200, 0x398400, 0x39C600,
+	0x420000, 0x424200, 0x428400, 0x42C600, 0x4A0000, 0x4A4200, 0x4A8400, 0x4AC600,
+	0x520000, 0x524200, 0x528400, 0x52C600, 0x5A0000, 0x5A4200, 0x5A8400, 0x5AC600,
+	0x630000, 0x634200, 0x638400, 0x63C600, 0x6B0000, 0x6B4200, 0x6B8400, 0x6BC600,
+	0x730000, 0x734200, 0x738400, 0x73C600, 0x7B0000, 0x7B4200, 0x7B8400, 0x7BC600,
+	0x840000, 0x844200, 0x848400, 0x84C600, 0x8C0000, 0x8C4200, 0x8C8400, 0x8CC600,
+	0x940000, 0x944200, 0x948400, 0x94C600, 0x9C0000, 0x9C4200, 0x9C8400, 0x9CC600,
+	0xA50000, 0xA54200, 0xA58400, 0xA5C600, 0xAD0000, 0xAD4200, 0xAD8400, 0xADC600,
+	0xB50000, 0xB54200, 0xB58400, 0xB5C600, 0xBD0000, 0xBD4200, 0xBD8400, 0xBDC600,
+	0xC60000, 0xC64200, 0xC68400, 0xC6C600, 0xCE0000, 0xCE4200, 0xCE8400, 0xCEC600,
+	0xD60000, 0xD64200, 0xD68400, 0xD6C600, 0xDE0000, 0xDE4200, 0xDE8400, 0xDEC600,
+	0xE70000, 0xE74200, 0xE78400, 0xE7C600, 0xEF0000, 0xEF4200, 0xEF8400, 0xEFC600,
+	0xF70000, 0xF74200, 0xF78400, 0xF7C600, 0xFF0000, 0xFF4200, 0xFF8400, 0xFFC600,
+	0x000000, 0x004200, 0x008400, 0x00C600, 0x080000, 0x084200, 0x088400, 0x08C600,
+	0x100000, 0x104200, 0x108400, 0x10C600, 0x180000, 0x184200, 0x188400, 0x18C600,
+	0x210000, 0x214200, 0x218400, 0x21C600, 0x290000, 0x294200, 0x298400, 0x29C600,
+	0x310000, 0x314200, 0x318400, 0x31C600, 0x390000, 0x394200, 0x398400, 0x39C600,
+	0x420000, 0x424200, 0x428400, 0x42C600, 0x4A0000, 0x4A4200, 0x4A8400, 0x4AC600,
+	0x520000, 0x524200, 0x528400, 0x52C600, 0x5A0000, 0x5A4200, 0x5A8400, 0x5AC600,
+	0x630000, 0x634200, 0x638400, 0x63C600, 0x6B0000, 0x6B4200, 0x6B8400, 0x6BC600,
+	0x730000, 0x734200, 0x738400, 0x73C600, 0x7B0000, 0x7B4200, 0x7B8400, 0x7BC600,
+	0x840000, 0x844200, 0x848400, 0x84C600, 0x8C0000, 0x8C4200, 0x8C8400, 0x8CC600,
+	0x940000, 0x944200, 0x948400, 0x94C600, 0x9C0000, 0x9C4200, 0x9C8400, 0x9CC600,
+	0xA50000, 0xA54200, 0xA58400, 0xA5C600, 0xAD0000, 0xAD4200, 0xAD8400, 0xADC600,
+	0xB50000, 0xB54200, 0xB58400, 0xB5C600, 0xBD0000, 0xBD4200, 0xBD8400, 0xBDC600,
+	0xC60000, 0xC64200, 0xC68400, 0xC6C600, 0xCE0000, 0xCE4200, 0xCE8400, 0xCEC600,
+	0xD60000, 0xD64200, 0xD68400, 0xD6C600, 0xDE0000, 0xDE4200, 0xDE8400, 0xDEC600,
+	0xE70000, 0xE74200, 0xE78400, 0xE7C600, 0xEF0000, 0xEF4200, 0xEF8400, 0xEFC600,
+	0xF70000, 0xF74200, 0xF78400, 0xF7C600, 0xFF0000, 0xFF4200, 0xFF8400, 0xFFC600
+};
+
+#define RGB15_TO_32(_p) (g_RGB15LowTo32[(_p) & 0xFF] | g_RGB15HighTo32[((_p) >> 8) & 0xFF])
+#define RGB32_TO_15(_p) (((((_p) >> 19) & 0x1F) << 10) | ((((_p) >> 11) & 0x1F) << 5) | \
+  (((_p) >> 3) & 0x1F))
+
+#undef DESTWRITEPIXEL
+#undef DESTREADPIXEL
+#undef SRCREADPIXEL
+#undef DESTNEXTPIXEL
+#undef SRCNEXTPIXEL
+#undef WRITEFGBGIMAGE
+#undef WRITEFIRSTLINEFGBGIMAGE
+#undef RLEDECOMPRESS
+#undef RLEEXTRA
+#define DESTWRITEPIXEL(_buf, _pix) ((uint32*)(_buf))[0] = RGB15_TO_32(_pix)
+#define DESTREADPIXEL(_pix, _buf) _pix = RGB32_TO_15(((uint32*)(_buf))[0])
+#define SRCREADPIXEL(_pix, _buf) _pix = ((_buf)[0] | ((_buf)[1] << 8))
+#define DESTNEXTPIXEL(_buf) _buf += 4
+#define SRCNEXTPIXEL(_buf) _buf += 2
+#define WRITEFGBGIMAGE WriteFgBgImage15to32
+#define WRITEFIRSTLINEFGBGIMAGE WriteFirstLineFgBgImage15to32
+#define RLEDECOMPRESS RleDecompress15to32
+#define RLEEXTRA
+#include "include/bitmap.c"
+
+#undef DESTWRITEPIXEL
+#undef DESTREADPIXEL
+#undef SRCREADPIXEL
+#undef DESTNEXTPIXEL
+#undef SRCNEXTPIXEL
+#undef WRITEFGBGIMAGE
+#undef WRITEFIRSTLINEFGBGIMAGE
+#undef RLEDECOMPRESS
+#undef RLEEXTRA
+#define DESTWRITEPIXEL(_buf, _pix) ((uint32*)(_buf))[0] = RGB16_TO_32(_pix)
+#define DESTREADPIXEL(_pix, _buf) _pix = RGB32_TO_16(((uint32*)(_buf))[0])
+#define SRCREADPIXEL(_pix, _buf) _pix = ((_buf)[0] | ((_buf)[1] << 8))
+#define DESTNEXTPIXEL(_buf) _buf += 4
+#define SRCNEXTPIXEL(_buf) _buf += 2
+#define WRITEFGBGIMAGE WriteFgBgImage16to32
+#define WRITEFIRSTLINEFGBGIMAGE WriteFirstLineFgBgImage16to32
+#define RLEDECOMPRESS RleDecompress16to32
+#define RLEEXTRA
+#include "include/bitmap.c"
+
+#undef DESTWRITEPIXEL
+#undef DESTREADPIXEL
+#undef SRCREADPIXEL
+#undef DESTNEXTPIXEL
+#undef SRCNEXTPIXEL
+#undef WRITEFGBGIMAGE
+#undef WRITEFIRSTLINEFGBGIMAGE
+#undef RLEDECOMPRESS
+#undef RLEEXTRA
+#define DESTWRITEPIXEL(_buf, _pix) ((uint32*)(_buf))[0] = ((_pix) & 0xFFFFFF) | 0xFF000000
+#define DESTREADPIXEL(_pix, _buf) _pix = ((uint32*)(_buf))[0] & 0xFFFFFF
+#define SRCREADPIXEL(_pix, _buf) _pix = (_buf)[0] | ((_buf)[1] << 8) | \
+  ((_buf)[2] << 16)
+#define DESTNEXTPIXEL(_buf) _buf += 4
+#define SRCNEXTPIXEL(_buf) _buf += 3
+#define WRITEFGBGIMAGE WriteFgBgImage24to32
+#define WRITEFIRSTLINEFGBGIMAGE WriteFirstLineFgBgImage24to32
+#define RLEDECOMPRESS RleDecompress24to32
+#define RLEEXTRA
+#include "include/bitmap.c"
+
 #define IN_UINT8_MV(_p) (*((_p)++))
 
 /**
@@ -603,6 +827,8 @@ int save_bitmap(uint8* data, int width, int height, int bpp)
 
 /**
  * bitmap decompression routine
+ * Interleaved bitmaps of 15, 16 and 24 bpp can also be decompressed to a
+ * dstBpp of 32, see RleDecompress16to32().
  */
 tbool bitmap_decompress_ex(uint8* srcData, uint8* dstData, int width, int height, int size, int srcBpp, int dstBpp, bitmapExtra* be)
 {
@@ -633,6 +859,21 @@ tbool bitmap_decompress_ex(uint8* srcData, uint8* dstData, int width, int height
 		RleDecompress24to24(srcData, size, dstData, width * 3, width, height);
 		freerdp_bitmap_flip(dstData, dstData, width * 3, height);
 	}
+	else if (srcBpp == 15 && dstBpp == 32)
+	{
+		RleDecompress15to32(srcData, size, dstData, width * 4, width, height);
+		freerdp_bitmap_flip(dstData, dstData, width * 4, height);
+	}
+	else if (srcBpp == 16 && dstBpp == 32)
+	{
+		RleDecompress16to32(srcData, size, dstData, width * 4, width, height);
+		freerdp_bitmap_flip(dstData, dstData, width * 4, height);
+	}
+	else if (srcBpp == 24 && dstBpp == 32)
+	{
+		RleDecompress24to32(srcData, size, dstData, width * 4, width, height);
+		freerdp_bitmap_flip(dstData, dstData, width * 4, height);
+	}
 	else
 	{
 		return false;
@@ -656,3 +897,382 @@ tbool bitmap_decompress(uint8* srcData, uint8* dstData, int width, int height, i
 	xfree(be.temp);
 	return rv;
 }
+
+/**
+ * Size of the header of a regular order of the given run length.
+ */
+static uint32 RegularOrderSize(uint32 runLength)
+{
+	if (runLength < 32)
+		return 1;
+	else if (runLength < 32 + 256)
+		return 2;
+	else
+		return 3;
+}
+
+/**
+ * Size of the header of a lite order of the given run length.
+ */
+static uint32 LiteOrderSize(uint32 runLength)
+{
+	if (runLength < 16)
+		return 1;
+	else if (runLength < 16 + 256)
+		return 2;
+	else
+		return 3;
+}
+
+/**
+ * Size of the header of a foreground/background image order. Short forms
+ * count whole bytes of bitmask, the extended ones count pixels.
+ */
+static uint32 FgBgOrderSize(uint32 runLength, tbool lite)
+{
+	if ((runLength & 7) == 0 && (runLength >> 3) <= (lite ? g_MaskLiteRunLength : g_MaskRegularRunLength))
+		return 1;
+	else if (runLength <= 256)
+		return 2;
+	else
+		return 3;
+}
+
+static void WriteRegularOrder(STREAM* s, uint8 code, uint8 megaCode, uint32 runLength)
+{
+	if (runLength < 32)
+	{
+		stream_write_uint8(s, (code << 5) | runLength);
+	}
+	else if (runLength < 32 + 256)
+	{
+		stream_write_uint8(s, code << 5);
+		stream_write_uint8(s, runLength - 32);
+	}
+	else
+	{
+		stream_write_uint8(s, megaCode);
+		stream_write_uint16(s, runLength);
+	}
+}
+
+static void WriteLiteOrder(STREAM* s, uint8 code, uint8 megaCode, uint32 runLength)
+{
+	if (runLength < 16)
+	{
+		stream_write_uint8(s, (code << 4) | runLength);
+	}
+	else if (runLength < 16 + 256)
+	{
+		stream_write_uint8(s, code << 4);
+		stream_write_uint8(s, runLength - 16);
+	}
+	else
+	{
+		stream_write_uint8(s, megaCode);
+		stream_write_uint16(s, runLength);
+	}
+}
+
+static void WriteFgBgOrder(STREAM* s, uint8 code, uint8 megaCode, uint32 runLength, tbool lite)
+{
+	if (FgBgOrderSize(runLength, lite) == 1)
+	{
+		stream_write_uint8(s, (code << (lite ? 4 : 5)) | (runLength >> 3));
+	}
+	else if (runLength <= 256)
+	{
+		stream_write_uint8(s, code << (lite ? 4 : 5));
+		stream_write_uint8(s, runLength - 1);
+	}
+	else
+	{
+		stream_write_uint8(s, megaCode);
+		stream_write_uint16(s, runLength);
+	}
+}
+
+#undef SRCREADPIXEL
+#undef SRCNEXTPIXEL
+#undef STREAMWRITEPIXEL
+#undef PIXEL_BYTES
+#undef PIXEL_MASK
+#undef PIXEL
+#undef BLACK_PIXEL
+#undef WHITE_PIXEL
+#undef WRITECOLORIMAGE
+#undef RLECOMPRESS
+#define SRCREADPIXEL(_pix, _buf) _pix = (_buf)[0]
+#define SRCNEXTPIXEL(_buf) _buf += 1
+#define STREAMWRITEPIXEL(_s, _pix) stream_write_uint8(_s, _pix)
+#define PIXEL_BYTES 1
+#define PIXEL_MASK 0xFF
+#define PIXEL uint32
+#define BLACK_PIXEL 0x000000
+#define WHITE_PIXEL 0xFF
+#define WRITECOLORIMAGE WriteColorImage8
+#define RLECOMPRESS RleCompress8
+#include "include/bitmap_encode.c"
+
+#undef SRCREADPIXEL
+#undef SRCNEXTPIXEL
+#undef STREAMWRITEPIXEL
+#undef PIXEL_BYTES
+#undef PIXEL_MASK
+#undef PIXEL
+#undef BLACK_PIXEL
+#undef WHITE_PIXEL
+#undef WRITECOLORIMAGE
+#undef RLECOMPRESS
+#define SRCREADPIXEL(_pix, _buf) _pix = ((_buf)[0] | ((_buf)[1] << 8))
+#define SRCNEXTPIXEL(_buf) _buf += 2
+#define STREAMWRITEPIXEL(_s, _pix) stream_write_uint16(_s, _pix)
+#define PIXEL_BYTES 2
+#define PIXEL_MASK 0xFFFF
+#define PIXEL uint32
+#define BLACK_PIXEL 0x000000
+#define WHITE_PIXEL 0xFFFF
+#define WRITECOLORIMAGE WriteColorImage16
+#define RLECOMPRESS RleCompress16
+#include "include/bitmap_encode.c"
+
+#undef SRCREADPIXEL
+#undef SRCNEXTPIXEL
+#undef STREAMWRITEPIXEL
+#undef PIXEL_BYTES
+#undef PIXEL_MASK
+#undef PIXEL
+#undef BLACK_PIXEL
+#undef WHITE_PIXEL
+#undef WRITECOLORIMAGE
+#undef RLECOMPRESS
+#define SRCREADPIXEL(_pix, _buf) _pix = (_buf)[0] | ((_buf)[1] << 8) | \
+  ((_buf)[2] << 16)
+#define SRCNEXTPIXEL(_buf) _buf += 3
+#define STREAMWRITEPIXEL(_s, _pix) do { stream_write_uint8(_s, (_pix) & 0xFF); \
+  stream_write_uint8(_s, ((_pix) >> 8) & 0xFF); stream_write_uint8(_s, ((_pix) >> 16) & 0xFF); } while (0)
+#define PIXEL_BYTES 3
+#define PIXEL_MASK 0xFFFFFF
+#define PIXEL uint32
+#define BLACK_PIXEL 0x000000
+#define WHITE_PIXEL 0xFFFFFF
+#define WRITECOLORIMAGE WriteColorImage24
+#define RLECOMPRESS RleCompress24
+#include "include/bitmap_encode.c"
+
+#undef SRCREADPIXEL
+#undef SRCNEXTPIXEL
+#undef STREAMWRITEPIXEL
+#undef PIXEL_BYTES
+#undef PIXEL_MASK
+#undef PIXEL
+#undef BLACK_PIXEL
+#undef WHITE_PIXEL
+#undef WRITECOLORIMAGE
+#undef RLECOMPRESS
+
+/**
+ * Split a top-down 32 bpp bitmap into its alpha, red, green and blue
+ * planes, with scan lines stored bottom-up as unsplit4() expects them.
+ */
+static void split4(uint8* srcData, uint8* planes[], int width, int height)
+{
+	int x, y;
+	int offset;
+	uint8* src;
+
+	offset = 0;
+
+	for (y = 0; y < height; y++)
+	{
+		src = srcData + (height - 1 - y) * width * 4;
+
+		for (x = 0; x < width; x++)
+		{
+			planes[0][offset] = src[3];
+			planes[1][offset] = src[2];
+			planes[2][offset] = src[1];
+			planes[3][offset] = src[0];
+			src += 4;
+			offset++;
+		}
+	}
+}
+
+/**
+ * Write a plane the way process_rle_plane() reads it, see [MS-RDPEGDI]
+ * 3.1.9.2. The first scan line is stored as is and the others as deltas to
+ * the line above, in sign-magnitude form. A control byte carries up to 15
+ * raw bytes in its high nibble followed by a run of 3 to 15 copies of the
+ * last of them in its low nibble, and runs of 16 to 47 take a control byte
+ * of their own. Gives up, returning false, past limit bytes.
+ */
+static tbool compress_rle_plane(uint8* plane, int width, int height, uint8* line, STREAM* s, int limit)
+{
+	int x, y;
+	int raw, run;
+	sint8 delta;
+	uint8 last;
+	uint8* end;
+	uint8* above;
+
+	end = stream_get_tail(s) + limit;
+
+	for (y = 0; y < height; y++)
+	{
+		if (y == 0)
+		{
+			memcpy(line, plane, width);
+		}
+		else
+		{
+			above = plane - width;
+
+			for (x = 0; x < width; x++)
+			{
+				delta = (sint8) (plane[x] - above[x]);
+				line[x] = (delta >= 0) ? (delta << 1) : (((-delta - 1) << 1) | 1);
+			}
+		}
+
+		last = 0;
+		x = 0;
+
+		while (x < width)
+		{
+			/* a run of the last value needs no raw byte */
+			for (run = 0; x + run < width && run < 47 && line[x + run] == last; run++);
+
+			if (run >= 3)
+			{
+				if (stream_get_tail(s) + 1 > end)
+					return false;
+
+				if (run < 16)
+					stream_write_uint8(s, run);
+				else
+					stream_write_uint8(s, ((run & 0x0F) << 4) | (run >> 4));
+
+				x += run;
+				continue;
+			}
+
+			/* raw bytes, up to one followed by a run of at least three */
+			for (raw = 0, run = 0; raw < 15 && x + raw < width; )
+			{
+				last = line[x + raw];
+				raw++;
+
+				for (run = 0; x + raw + run < width && line[x + raw + run] == last; run++);
+
+				if (run >= 3)
+					break;
+			}
+
+			/* short runs stay raw, long ones get a control byte of their own */
+			if (run < 3 || run > 15)
+				run = 0;
+
+			if (stream_get_tail(s) + 1 + raw > end)
+				return false;
+
+			stream_write_uint8(s, (raw << 4) | run);
+			stream_write(s, &line[x], raw);
+			x += raw + run;
+		}
+
+		plane += width;
+	}
+
+	return true;
+}
+
+/**
+ * 4 byte bitmap compress
+ * RDP6_BITMAP_STREAM, run length encoded unless raw planes are as small.
+ * The alpha plane is left out of opaque bitmaps.
+ */
+static int bitmap_compress4(uint8* srcData, int width, int height, STREAM* s)
+{
+	int i;
+	int n;
+	int size;
+	int first;
+	uint8* mark;
+	uint8* temp;
+	uint8* planes[4];
+
+	n = width * height;
+
+	if (n == 0)
+		return 0;
+
+	temp = (uint8*) xmalloc(n * 4 + width);
+
+	for (i = 0; i < 4; i++)
+		planes[i] = temp + i * n;
+
+	split4(srcData, planes, width, height);
+
+	for (i = 0; i < n && planes[0][i] == 0xFF; i++);
+	first = (i == n) ? 1 : 0;
+
+	/* header, planes and the trailing pad byte of raw planes */
+	size = 1 + (4 - first) * n + 1;
+
+	stream_check_size(s, size);
+	stream_get_mark(s, mark);
+
+	stream_write_uint8(s, PLANAR_FORMAT_HEADER_RLE | (first ? PLANAR_FORMAT_HEADER_NA : 0));
+
+	for (i = first; i < 4; i++)
+	{
+		if (!compress_rle_plane(planes[i], width, height, temp + 4 * n, s,
+				size - 1 - (int) (stream_get_tail(s) - mark)))
+			break;
+	}
+
+	if (i < 4)
+	{
+		stream_set_mark(s, mark);
+		stream_write_uint8(s, first ? PLANAR_FORMAT_HEADER_NA : 0);
+
+		for (i = first; i < 4; i++)
+			stream_write(s, planes[i], n);
+
+		stream_write_uint8(s, 0);
+	}
+
+	xfree(temp);
+
+	return (int) (stream_get_tail(s) - mark);
+}
+
+/**
+ * bitmap compression routine
+ * Writes a top-down bitmap at the tail of s in the format read by
+ * bitmap_decompress(): an RLE compressed bitmap stream for 8, 15, 16 and
+ * 24 bpp, an RDP6 planar one for 32 bpp.
+ * Returns the number of bytes written, 0 for unsupported depths.
+ */
+int bitmap_compress(uint8* srcData, STREAM* s, int width, int height, int bpp)
+{
+	switch (bpp)
+	{
+		case 8:
+			return RleCompress8(srcData, width, height, s);
+
+		case 15:
+		case 16:
+			return RleCompress16(srcData, width, height, s);
+
+		case 24:
+			return RleCompress24(srcData, width, height, s);
+
+		case 32:
+			return bitmap_compress4(srcData, width, height, s);
+
+		default:
+			return 0;
+	}
+}
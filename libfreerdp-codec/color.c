@@ -17,13 +17,37 @@
  * limitations under the License.
  */
 
+#include "config.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
 #include <freerdp/api.h>
 #include <freerdp/freerdp.h>
 #include <freerdp/codec/color.h>
 #include <freerdp/utils/memory.h>
+#include <freerdp/utils/cpu.h>
+#include <freerdp/constants.h>
+
+#include "color_types.h"
+
+#ifdef WITH_SSE2
+#include "color_sse2.h"
+#endif
+
+#ifdef WITH_AVX2
+#include "color_avx2.h"
+#endif
+
+#ifndef COLOR_INIT_SIMD
+#define COLOR_INIT_SIMD(_kernels) do { } while (0)
+#endif
 
 int freerdp_get_pixel(uint8 * data, int x, int y, int width, int height, int bpp)
 {
@@ -350,422 +374,389 @@ uint32 freerdp_color_convert_var_bgr(uint32 srcColor, int srcBpp, int dstBpp, HC
 		return freerdp_color_convert_rgb_bgr(srcColor, srcBpp, 32, clrconv);
 }
 
-uint8* freerdp_image_convert_8bpp(uint8* srcData, uint8* dstData, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv)
-{
-	int i;
-	uint8 red;
-	uint8 green;
-	uint8 blue;
-	uint32 pixel;
-	uint8 *src8;
-	uint16 *dst16;
-	uint32 *dst32;
-
-	if (dstBpp == 8)
-	{
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height);
-
-		memcpy(dstData, srcData, width * height);
-		return dstData;
-	}
-	else if (dstBpp == 15 || (dstBpp == 16 && clrconv->rgb555))
-	{
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 2);
-		
-		dst16 = (uint16 *) dstData;
-		for (i = width * height; i > 0; i--)
-		{
-			pixel = *srcData;
-			srcData++;
-			red = clrconv->palette->entries[pixel].red;
-			green = clrconv->palette->entries[pixel].green;
-			blue = clrconv->palette->entries[pixel].blue;
-			pixel = (clrconv->invert) ? BGR15(red, green, blue) : RGB15(red, green, blue);
-			*dst16 = pixel;
-			dst16++;
-		}
-		return dstData;
-	}
-	else if (dstBpp == 16)
-	{
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 2);
-		
-		dst16 = (uint16 *) dstData;
-		for (i = width * height; i > 0; i--)
-		{
-			pixel = *srcData;
-			srcData++;
-			red = clrconv->palette->entries[pixel].red;
-			green = clrconv->palette->entries[pixel].green;
-			blue = clrconv->palette->entries[pixel].blue;
-			pixel = (clrconv->invert) ? BGR16(red, green, blue) : RGB16(red, green, blue);
-			*dst16 = pixel;
-			dst16++;
-		}
-		return dstData;
-	}
-	else if (dstBpp == 32)
-	{
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 4);
-		
-		src8 = (uint8*) srcData;
-		dst32 = (uint32*) dstData;
-		for (i = width * height; i > 0; i--)
-		{
-			pixel = *src8;
-			src8++;
-			red = clrconv->palette->entries[pixel].red;
-			green = clrconv->palette->entries[pixel].green;
-			blue = clrconv->palette->entries[pixel].blue;
-			pixel = (clrconv->invert) ? RGB32(red, green, blue) : BGR32(red, green, blue);
-			*dst32 = pixel;
-			dst32++;
-		}
-		return dstData;
-	}
+/**
+ * Conversion kernels. Rows are srcStride and dstStride bytes apart, either
+ * of which may be negative to walk a bitmap bottom-up.
+ */
+#define COLOR_KERNEL(_name, _src_type, _src_step, _dst_type, _dst_step, _convert) \
+void _name(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv) \
+{ \
+	int x, y; \
+	uint8 red, green, blue; \
+	const _src_type* src; \
+	_dst_type* dst; \
+\
+	for (y = 0; y < height; y++) \
+	{ \
+		src = (const _src_type*) (srcData + y * srcStride); \
+		dst = (_dst_type*) (dstData + y * dstStride); \
+\
+		for (x = 0; x < width; x++) \
+		{ \
+			_convert; \
+			src += _src_step; \
+			dst += _dst_step; \
+		} \
+	} \
+}
 
-	return srcData;
+#define COLOR_COPY_KERNEL(_name, _bytes) \
+static void _name(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv) \
+{ \
+	int y; \
+\
+	for (y = 0; y < height; y++) \
+		memcpy(dstData + y * dstStride, srcData + y * srcStride, width * _bytes); \
 }
 
-uint8* freerdp_image_convert_15bpp(uint8* srcData, uint8* dstData, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv)
+COLOR_COPY_KERNEL(color_copy_8, 1)
+COLOR_COPY_KERNEL(color_copy_16, 2)
+COLOR_COPY_KERNEL(color_copy_32, 4)
+
+static COLOR_KERNEL(color_convert_15_to_16, uint16, 1, uint16, 1,
+	GetRGB_555(red, green, blue, *src); RGB_555_565(red, green, blue); *dst = RGB565(red, green, blue))
+static COLOR_KERNEL(color_convert_15_to_16_invert, uint16, 1, uint16, 1,
+	GetRGB_555(red, green, blue, *src); RGB_555_565(red, green, blue); *dst = BGR565(red, green, blue))
+COLOR_KERNEL(color_convert_15_to_32, uint16, 1, uint32, 1,
+	GetBGR15(red, green, blue, *src); *dst = BGR32(red, green, blue))
+COLOR_KERNEL(color_convert_15_to_32_invert, uint16, 1, uint32, 1,
+	GetBGR15(red, green, blue, *src); *dst = RGB32(red, green, blue))
+
+static COLOR_KERNEL(color_convert_16_to_15, uint16, 1, uint16, 1,
+	GetRGB_565(red, green, blue, *src); RGB_565_555(red, green, blue); *dst = RGB555(red, green, blue))
+static COLOR_KERNEL(color_convert_16_to_15_invert, uint16, 1, uint16, 1,
+	GetRGB_565(red, green, blue, *src); RGB_565_555(red, green, blue); *dst = BGR555(red, green, blue))
+static COLOR_KERNEL(color_convert_16_to_24, uint16, 1, uint8, 3,
+	GetBGR16(red, green, blue, *src); dst[0] = red; dst[1] = green; dst[2] = blue)
+static COLOR_KERNEL(color_convert_16_to_24_invert, uint16, 1, uint8, 3,
+	GetBGR16(red, green, blue, *src); dst[0] = blue; dst[1] = green; dst[2] = red)
+COLOR_KERNEL(color_convert_16_to_32, uint16, 1, uint32, 1,
+	GetBGR16(red, green, blue, *src); *dst = BGR32(red, green, blue))
+COLOR_KERNEL(color_convert_16_to_32_invert, uint16, 1, uint32, 1,
+	GetBGR16(red, green, blue, *src); *dst = RGB32(red, green, blue))
+
+COLOR_KERNEL(color_convert_24_to_32, uint8, 3, uint8, 4,
+	red = src[0]; green = src[1]; blue = src[2]; dst[0] = red; dst[1] = green; dst[2] = blue; dst[3] = 0xFF)
+
+COLOR_KERNEL(color_convert_32_to_16, uint32, 1, uint16, 1,
+	GetBGR32(blue, green, red, *src); *dst = RGB16(red, green, blue))
+COLOR_KERNEL(color_convert_32_to_16_invert, uint32, 1, uint16, 1,
+	GetBGR32(blue, green, red, *src); *dst = BGR16(red, green, blue))
+COLOR_KERNEL(color_convert_32_to_24, uint8, 4, uint8, 3,
+	red = src[0]; green = src[1]; blue = src[2]; dst[0] = red; dst[1] = green; dst[2] = blue)
+COLOR_KERNEL(color_convert_32_to_24_invert, uint8, 4, uint8, 3,
+	red = src[0]; green = src[1]; blue = src[2]; dst[0] = blue; dst[1] = green; dst[2] = red)
+COLOR_KERNEL(color_convert_32_to_32_alpha, uint8, 4, uint8, 4,
+	red = src[0]; green = src[1]; blue = src[2]; dst[0] = red; dst[1] = green; dst[2] = blue; dst[3] = 0xFF)
+COLOR_KERNEL(color_convert_32_to_32_swap, uint8, 4, uint8, 4,
+	red = src[0]; green = src[1]; blue = src[2]; dst[3] = src[3]; dst[0] = blue; dst[1] = green; dst[2] = red)
+
+/**
+ * Palette lookups go through a table of the destination pixels, built once
+ * per call from the current palette.
+ */
+static void color_palette_table(HCLRCONV clrconv, int dstBpp, uint32 table[256])
 {
 	int i;
-	uint8 red;
-	uint8 green;
-	uint8 blue;
-	uint32 pixel;
-	uint16 *src16;
-	uint16 *dst16;
-	uint32 *dst32;
+	int count;
+	uint8 red, green, blue;
 
-	if (dstBpp == 15 || (dstBpp == 16 && clrconv->rgb555))
-	{
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 2);
-
-		memcpy(dstData, srcData, width * height * 2);
+	count = MIN(clrconv->palette->count, 256);
+	memset(table, 0, 256 * sizeof(uint32));
 
-		return dstData;
-	}
-	else if (dstBpp == 32)
-	{
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 4);
-		
-		src16 = (uint16 *) srcData;
-		dst32 = (uint32 *) dstData;
-		for (i = width * height; i > 0; i--)
-		{
-			pixel = *src16;
-			src16++;
-			GetBGR15(red, green, blue, pixel);
-			pixel = (clrconv->invert) ? RGB32(red, green, blue) : BGR32(red, green, blue);
-			*dst32 = pixel;
-			dst32++;
-		}
-		return dstData;
-	}
-	else if (dstBpp == 16)
+	for (i = 0; i < count; i++)
 	{
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 2);
-	
-		src16 = (uint16 *) srcData;
-		dst16 = (uint16 *) dstData;
-		for (i = width * height; i > 0; i--)
-		{
-			pixel = *src16;
-			src16++;
-			GetRGB_555(red, green, blue, pixel);
-			RGB_555_565(red, green, blue);
-			pixel = (clrconv->invert) ? BGR565(red, green, blue) : RGB565(red, green, blue);
-			*dst16 = pixel;
-			dst16++;
-		}
-		return dstData;
+		red = clrconv->palette->entries[i].red;
+		green = clrconv->palette->entries[i].green;
+		blue = clrconv->palette->entries[i].blue;
+
+		if (dstBpp == 15)
+			table[i] = (clrconv->invert) ? BGR15(red, green, blue) : RGB15(red, green, blue);
+		else if (dstBpp == 16)
+			table[i] = (clrconv->invert) ? BGR16(red, green, blue) : RGB16(red, green, blue);
+		else
+			table[i] = (clrconv->invert) ? RGB32(red, green, blue) : BGR32(red, green, blue);
 	}
+}
 
-	return srcData;
+#define COLOR_PALETTE_KERNEL(_name, _dst_bpp, _dst_type) \
+static void _name(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv) \
+{ \
+	int x, y; \
+	uint32 table[256]; \
+	const uint8* src; \
+	_dst_type* dst; \
+\
+	color_palette_table(clrconv, _dst_bpp, table); \
+\
+	for (y = 0; y < height; y++) \
+	{ \
+		src = srcData + y * srcStride; \
+		dst = (_dst_type*) (dstData + y * dstStride); \
+\
+		for (x = 0; x < width; x++) \
+			dst[x] = table[src[x]]; \
+	} \
 }
 
-uint8* freerdp_image_convert_16bpp(uint8* srcData, uint8* dstData, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv)
-{
-	if (srcBpp == 15)
-		return freerdp_image_convert_15bpp(srcData, dstData, width, height, srcBpp, dstBpp, clrconv);
+COLOR_PALETTE_KERNEL(color_convert_8_to_15, 15, uint16)
+COLOR_PALETTE_KERNEL(color_convert_8_to_16, 16, uint16)
+COLOR_PALETTE_KERNEL(color_convert_8_to_32, 32, uint32)
 
-	if (dstBpp == 16)
+static int color_format_index(int bpp)
+{
+	switch (bpp)
 	{
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 2);
-
-		if (clrconv->rgb555)
-		{
-			int i;
-			uint8 red, green, blue;
-			uint16* src16 = (uint16 *) srcData;
-			uint16* dst16 = (uint16 *) dstData;
-
-			for (i = width * height; i > 0; i--)
-			{
-				GetRGB_565(red, green, blue, (*src16));
-				RGB_565_555(red, green, blue);
-				(*dst16) = (clrconv->invert) ? BGR555(red, green, blue) : RGB555(red, green, blue);
-				src16++;
-				dst16++;
-			}
-		}
-		else
-		{
-			memcpy(dstData, srcData, width * height * 2);
-		}
-
-		return dstData;
+		case 8:
+			return 0;
+		case 15:
+			return 1;
+		case 16:
+			return 2;
+		case 24:
+			return 3;
+		case 32:
+			return 4;
+		default:
+			return -1;
 	}
-	else if (dstBpp == 24)
-	{
-		int i;
-		uint8 *dst8;
-		uint16 *src16;
-		uint8 red, green, blue;
-
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 3);
+}
 
-		dst8 = (uint8*) dstData;
-		src16 = (uint16*) srcData;
+static uint32 color_flags(HCLRCONV clrconv)
+{
+	return (clrconv->alpha ? CLRCONV_ALPHA : 0) |
+		(clrconv->invert ? CLRCONV_INVERT : 0) |
+		(clrconv->rgb555 ? CLRCONV_RGB555 : 0);
+}
 
-		for (i = width * height; i > 0; i--)
-		{
-			GetBGR16(red, green, blue, *src16);
-			src16++;
+/**
+ * Install kernel for every flag combination whose bits in mask equal flags.
+ */
+void color_set_kernel(COLOR_KERNELS* kernels, int srcBpp, int dstBpp,
+	uint32 mask, uint32 flags, p_freerdp_image_convert_ex kernel)
+{
+	uint32 i;
+	int src = color_format_index(srcBpp);
+	int dst = color_format_index(dstBpp);
 
-			if (clrconv->invert)
-			{
-				*dst8++ = blue;
-				*dst8++ = green;
-				*dst8++ = red;
-			}
-			else
-			{
-				*dst8++ = red;
-				*dst8++ = green;
-				*dst8++ = blue;
-			}
-		}
-		return dstData;
-	}
-	else if (dstBpp == 32)
+	for (i = 0; i < COLOR_FLAGS; i++)
 	{
-		int i;
-		uint32 pixel;
-		uint16* src16;
-		uint32* dst32;
-		uint8 red, green, blue;
+		if ((i & mask) == flags)
+			kernels->convert[src][dst][i] = kernel;
+	}
+}
 
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 4);
+/**
+ * The conversions freerdp_image_convert() has always done. A 16 bpp
+ * destination with CLRCONV_RGB555 is really a 15 bpp one, and 24 and
+ * 32 bpp sources are copied as they are, regardless of CLRCONV_INVERT.
+ */
+static void color_init_c(COLOR_KERNELS* kernels)
+{
+	memset(kernels, 0, sizeof(COLOR_KERNELS));
+
+	color_set_kernel(kernels, 8, 8, 0, 0, color_copy_8);
+	color_set_kernel(kernels, 8, 15, 0, 0, color_convert_8_to_15);
+	color_set_kernel(kernels, 8, 16, CLRCONV_RGB555, 0, color_convert_8_to_16);
+	color_set_kernel(kernels, 8, 16, CLRCONV_RGB555, CLRCONV_RGB555, color_convert_8_to_15);
+	color_set_kernel(kernels, 8, 32, 0, 0, color_convert_8_to_32);
+
+	color_set_kernel(kernels, 15, 15, 0, 0, color_copy_16);
+	color_set_kernel(kernels, 15, 16, CLRCONV_RGB555, CLRCONV_RGB555, color_copy_16);
+	color_set_kernel(kernels, 15, 16, CLRCONV_RGB555 | CLRCONV_INVERT, 0, color_convert_15_to_16);
+	color_set_kernel(kernels, 15, 16, CLRCONV_RGB555 | CLRCONV_INVERT, CLRCONV_INVERT, color_convert_15_to_16_invert);
+	color_set_kernel(kernels, 15, 32, CLRCONV_INVERT, 0, color_convert_15_to_32);
+	color_set_kernel(kernels, 15, 32, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_15_to_32_invert);
+
+	color_set_kernel(kernels, 16, 16, CLRCONV_RGB555, 0, color_copy_16);
+	color_set_kernel(kernels, 16, 16, CLRCONV_RGB555 | CLRCONV_INVERT, CLRCONV_RGB555, color_convert_16_to_15);
+	color_set_kernel(kernels, 16, 16, CLRCONV_RGB555 | CLRCONV_INVERT, CLRCONV_RGB555 | CLRCONV_INVERT, color_convert_16_to_15_invert);
+	color_set_kernel(kernels, 16, 24, CLRCONV_INVERT, 0, color_convert_16_to_24);
+	color_set_kernel(kernels, 16, 24, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_16_to_24_invert);
+	color_set_kernel(kernels, 16, 32, CLRCONV_INVERT, 0, color_convert_16_to_32);
+	color_set_kernel(kernels, 16, 32, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_16_to_32_invert);
+
+	color_set_kernel(kernels, 24, 32, 0, 0, color_convert_24_to_32);
+
+	color_set_kernel(kernels, 32, 16, CLRCONV_INVERT, 0, color_convert_32_to_16);
+	color_set_kernel(kernels, 32, 16, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_32_to_16_invert);
+	color_set_kernel(kernels, 32, 24, CLRCONV_INVERT, 0, color_convert_32_to_24);
+	color_set_kernel(kernels, 32, 24, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_32_to_24_invert);
+	color_set_kernel(kernels, 32, 32, CLRCONV_ALPHA, 0, color_copy_32);
+	color_set_kernel(kernels, 32, 32, CLRCONV_ALPHA, CLRCONV_ALPHA, color_convert_32_to_32_alpha);
+
+	kernels->swap32 = color_convert_32_to_32_swap;
+}
 
-		src16 = (uint16*) srcData;
-		dst32 = (uint32*) dstData;
+/* one immutable table per CPU_SSE2/CPU_AVX2 combination, built once */
+static COLOR_KERNELS color_kernel_tables[4];
+static COLOR_KERNELS* volatile color_kernels = NULL;
 
-		for (i = width * height; i > 0; i--)
-		{
-			pixel = *src16;
-			src16++;
-			GetBGR16(red, green, blue, pixel);
-			pixel = (clrconv->invert) ? RGB32(red, green, blue) : BGR32(red, green, blue);
-			*dst32 = pixel;
-			dst32++;
-		}
-		return dstData;
-	}
+#ifdef _WIN32
+static volatile LONG color_kernels_once = 0;
+#else
+static pthread_once_t color_kernels_once = PTHREAD_ONCE_INIT;
+#endif
 
-	return srcData;
+static int color_kernels_index(uint32 cpu_opt)
+{
+	return ((cpu_opt & CPU_SSE2) ? 1 : 0) | ((cpu_opt & CPU_AVX2) ? 2 : 0);
 }
 
-uint8* freerdp_image_convert_24bpp(uint8* srcData, uint8* dstData, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv)
+static void color_kernels_init(void)
 {
 	int i;
 
-	if (dstBpp == 32)
+	for (i = 0; i < 4; i++)
 	{
-		uint8 *dstp;
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 4);
-		
-		dstp = dstData;
-		for (i = width * height; i > 0; i--)
-		{
-			*(dstp++) = *(srcData++);
-			*(dstp++) = *(srcData++);
-			*(dstp++) = *(srcData++);
-			*(dstp++) = 0xFF;
-		}
-		return dstData;
+		color_init_c(&color_kernel_tables[i]);
+
+		if (i & 1)
+			COLOR_INIT_SIMD(&color_kernel_tables[i]);
+
+#ifdef WITH_AVX2
+		if (i & 2)
+			color_init_avx2(&color_kernel_tables[i]);
+#endif
 	}
 
-	return srcData;
+	color_kernels = &color_kernel_tables[color_kernels_index(freerdp_detect_cpu())];
 }
 
-uint8* freerdp_image_convert_32bpp(uint8* srcData, uint8* dstData, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv)
+static void color_kernels_init_once(void)
 {
-	if (dstBpp == 16)
+#ifdef _WIN32
+	/* 0: not started, 1: building, 2: ready */
+	if (InterlockedCompareExchange(&color_kernels_once, 1, 0) == 0)
 	{
-		int index;
-		uint16 *dst16;
-		uint32 *src32;
-		uint8 red, green, blue;
-
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 2);
-
-		dst16 = (uint16*) dstData;
-		src32 = (uint32*) srcData;
-
-		for (index = 0; index < width * height; index++)
-		{
-			GetBGR32(blue, green, red, *src32);
-			*dst16 = (clrconv->invert) ? BGR16(red, green, blue) : RGB16(red, green, blue);
-			src32++;
-			dst16++;
-		}
-		return dstData;
+		color_kernels_init();
+		InterlockedExchange(&color_kernels_once, 2);
 	}
-	else if (dstBpp == 24)
+	else
 	{
-		uint8 *dstp;
-		int index;
-		uint8 red, green, blue;
+		while (color_kernels_once != 2)
+			Sleep(0);
+	}
+#else
+	pthread_once(&color_kernels_once, color_kernels_init);
+#endif
+}
 
-		if (dstData == NULL)
-			dstData = (uint8*) malloc(width * height * 3);
+/**
+ * Override the conversion kernels for the whole process with the ones for
+ * the CPU_* flags in cpu_opt, as returned by freerdp_detect_cpu(); a cpu_opt
+ * of 0 selects the plain C kernels. Without a call the kernels for the
+ * detected CPU are used. The tables themselves are never modified, so this
+ * is safe while other threads convert, though they may finish an image with
+ * the previous kernels.
+ */
+void freerdp_image_convert_set_cpu_opt(uint32 cpu_opt)
+{
+	color_kernels_init_once();
+	color_kernels = &color_kernel_tables[color_kernels_index(cpu_opt)];
+}
 
-		dstp = dstData;
-		for (index = 0; index < width * height; index++)
-		{
-			red = *(srcData++);
-			green = *(srcData++);
-			blue = *(srcData++);
+static COLOR_KERNELS* color_get_kernels(void)
+{
+	color_kernels_init_once();
+	return color_kernels;
+}
 
-			if (clrconv->invert)
-			{
-				*dstp++ = blue;
-				*dstp++ = green;
-				*dstp++ = red;
-			}
-			else
-			{
-				*dstp++ = red;
-				*dstp++ = green;
-				*dstp++ = blue;
-			}
+/**
+ * Look up the kernel converting srcBpp to dstBpp under the flags of clrconv,
+ * or NULL if there is none. Callers converting many images of one format
+ * can keep the kernel for as long as clrconv does not change.
+ */
+p_freerdp_image_convert_ex freerdp_image_convert_select(int srcBpp, int dstBpp, HCLRCONV clrconv)
+{
+	int src = color_format_index(srcBpp);
+	int dst = color_format_index(dstBpp);
 
-			srcData++;
-		}
-		return dstData;
-	}
-	else if (dstBpp == 32)
-	{
-		if (clrconv->alpha)
-		{
-			int x, y;
-			uint8 *dstp;
+	if (src < 0 || dst < 0)
+		return NULL;
 
-			if (dstData == NULL)
-				dstData = (uint8*) malloc(width * height * 4);
+	return color_get_kernels()->convert[src][dst][color_flags(clrconv)];
+}
 
-			memcpy(dstData, srcData, width * height * 4);
+/**
+ * Convert a width x height image between strided buffers. srcData and
+ * dstData point to the first row to read and write, and either stride may
+ * be negative to flip the image on the way. Returns false if there is no
+ * such conversion.
+ */
+boolean freerdp_image_convert_ex(const uint8* srcData, int srcStride, uint8* dstData, int dstStride,
+	int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv)
+{
+	p_freerdp_image_convert_ex kernel;
 
-			dstp = dstData;
-			for (y = 0; y < height; y++)
-			{
-				for (x = 0; x < width * 4; x += 4)
-				{
-					dstp += 3;
-					*dstp = 0xFF;
-					dstp++;
-				}
-			}
-		}
-		else
-		{
-			if (dstData == NULL)
-				dstData = (uint8*) malloc(width * height * 4);
+	kernel = freerdp_image_convert_select(srcBpp, dstBpp, clrconv);
 
-			memcpy(dstData, srcData, width * height * 4);
-		}
-		
-		return dstData;
-	}
+	if (kernel == NULL)
+		return false;
 
-	return srcData;
-}
+	kernel(srcData, srcStride, dstData, dstStride, width, height, clrconv);
 
-p_freerdp_image_convert freerdp_image_convert_[5] =
-{
-	NULL,
-	freerdp_image_convert_8bpp,
-	freerdp_image_convert_16bpp,
-	freerdp_image_convert_24bpp,
-	freerdp_image_convert_32bpp
-};
+	return true;
+}
 
 uint8* freerdp_image_convert(uint8* srcData, uint8* dstData, int width, int height, int srcBpp, int dstBpp, HCLRCONV clrconv)
 {
-	p_freerdp_image_convert _p_freerdp_image_convert = freerdp_image_convert_[IBPP(srcBpp)];
+	int srcBytes, dstBytes;
+	p_freerdp_image_convert_ex kernel;
 
-	if (_p_freerdp_image_convert != NULL)
-		return _p_freerdp_image_convert(srcData, dstData, width, height, srcBpp, dstBpp, clrconv);
-	else
+	if (IBPP(srcBpp) == 0)
 		return 0;
+
+	kernel = freerdp_image_convert_select(srcBpp, dstBpp, clrconv);
+
+	if (kernel == NULL)
+		return srcData;
+
+	srcBytes = (srcBpp + 7) / 8;
+	dstBytes = (dstBpp + 7) / 8;
+
+	if (dstData == NULL)
+		dstData = (uint8*) malloc(width * height * dstBytes);
+
+	kernel(srcData, width * srcBytes, dstData, width * dstBytes, width, height, clrconv);
+
+	return dstData;
 }
 
+/**
+ * Copy height rows of scanLineSz bytes from src to dst in reverse order.
+ * src may equal dst, rows are then swapped in place through a small stack
+ * buffer. Callers that go on to convert or blit the bitmap should rather
+ * walk it with a negative stride, see freerdp_image_convert_ex().
+ */
 void   freerdp_bitmap_flip(uint8 * src, uint8 * dst, int scanLineSz, int height)
 {
 	int i;
-
+	int offset;
+	int length;
+	uint8 tmpBfr[1024];
 	uint8 * bottomLine = dst + (scanLineSz * (height - 1));
 	uint8 * topLine = src;
 
-	/* Special processing if called for flip-in-place. */
 	if (src == dst)
 	{
-		/* Allocate a scanline buffer.
-		 * (FIXME: xmalloc / xfree below should be replaced by "get/put
-		 * scanline buffer from a pool/Q of fixed buffers" to reuse
-		 * fixed size buffers (of max scanline size (or adaptative?) )
-		 * -- would be much faster).
-		 */
-		uint8 * tmpBfr = xmalloc(scanLineSz);
-		int half = height / 2;
-		/* Flip buffer in place by line permutations through the temp
-		 * scan line buffer.
-		 * Not that if height has an odd number of line, we don't need
-		 * to move the center scanline anyway.
-		 * Also note that in place flipping takes three memcpy() calls
-		 * to process two scanlines while src to distinct dest would
-		 * only requires two memcpy() calls for two scanlines.
-		 */
-		height--;
-		for (i = 0; i < half ; i++)
+		/* the center scanline of an odd height stays where it is */
+		for (i = 0; i < height / 2; i++)
 		{
-			memcpy(tmpBfr, topLine, scanLineSz);
-			memcpy(topLine, bottomLine, scanLineSz);
-			memcpy(bottomLine, tmpBfr, scanLineSz);
+			for (offset = 0; offset < scanLineSz; offset += length)
+			{
+				length = MIN(scanLineSz - offset, (int) sizeof(tmpBfr));
+				memcpy(tmpBfr, topLine + offset, length);
+				memcpy(topLine + offset, bottomLine + offset, length);
+				memcpy(bottomLine + offset, tmpBfr, length);
+			}
+
 			topLine += scanLineSz;
 			bottomLine -= scanLineSz;
-			height--;
 		}
-		xfree(tmpBfr);
 	}
-	/* Flip from source buffer to destination buffer. */
 	else
 	{
-
 		for (i = 0; i < height; i++)
 		{
 			memcpy(bottomLine, topLine, scanLineSz);
@@ -773,7 +764,6 @@ void   freerdp_bitmap_flip(uint8 * src, uint8 * dst, int scanLineSz, int height)
 			bottomLine -= scanLineSz;
 		}
 	}
-
 }
 
 uint8* freerdp_image_flip(uint8* srcData, uint8* dstData, int width, int height, int bpp)
@@ -1020,21 +1010,7 @@ void freerdp_alpha_cursor_convert(uint8* alphaData, uint8* xorMask, uint8* andMa
 
 void freerdp_image_swap_color_order(uint8* data, int width, int height)
 {
-	int x, y;
-	uint32* pixel;
-	uint8 a, r, g, b;
-
-	pixel = (uint32*) data;
-
-	for (y = 0; y < height; y++)
-	{
-		for (x = 0; x < width; x++)
-		{
-			GetARGB32(a, r, g, b, *pixel);
-			*pixel = ABGR32(a, r, g, b);
-			pixel++;
-		}
-	}
+	color_get_kernels()->swap32(data, width * 4, data, width * 4, width, height, NULL);
 }
 
 HCLRCONV freerdp_clrconv_new(uint32 flags)
@@ -0,0 +1,233 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * Color Conversion Kernels - AVX2 Optimizations
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <immintrin.h>
+
+#include "color_types.h"
+#include "color_avx2.h"
+
+#ifdef _MSC_VER
+#define	__attribute__(...)
+#endif
+
+#define COLOR_AVX2_INLINE static __inline __attribute__((__gnu_inline__, __always_inline__, __artificial__))
+
+/**
+ * Run _body over the first _count columns of every row, _step pixels at a
+ * time, and leave the remaining columns to the C kernel _tail. The output
+ * matches the C kernels bit for bit.
+ */
+#define COLOR_AVX2_KERNEL(_name, _tail, _src_bytes, _dst_bytes, _step, _count, _body) \
+static void _name(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv) \
+{ \
+	int x, y; \
+	int n = MAX(_count, 0); \
+	const uint8* src; \
+	uint8* dst; \
+\
+	for (y = 0; y < height; y++) \
+	{ \
+		src = srcData + y * srcStride; \
+		dst = dstData + y * dstStride; \
+\
+		for (x = 0; x < n; x += _step) \
+		{ \
+			_body; \
+			src += _step * _src_bytes; \
+			dst += _step * _dst_bytes; \
+		} \
+	} \
+\
+	_tail(srcData + n * _src_bytes, srcStride, dstData + n * _dst_bytes, dstStride, width - n, height, clrconv); \
+}
+
+/* byte shuffles, the same within both 128 bit lanes */
+#define COLOR_AVX2_SHUFFLE(_b0, _b1, _b2, _b3, _b4, _b5, _b6, _b7, _b8, _b9, _b10, _b11, _b12, _b13, _b14, _b15) \
+	_mm256_setr_epi8(_b0, _b1, _b2, _b3, _b4, _b5, _b6, _b7, _b8, _b9, _b10, _b11, _b12, _b13, _b14, _b15, \
+		_b0, _b1, _b2, _b3, _b4, _b5, _b6, _b7, _b8, _b9, _b10, _b11, _b12, _b13, _b14, _b15)
+
+/* widen 5 and 6 bit channels in 16 bit lanes to 8 bits, as RGB_565_888 does */
+COLOR_AVX2_INLINE __m256i color_expand5_avx2(__m256i c)
+{
+	return _mm256_or_si256(_mm256_slli_epi16(c, 3), _mm256_srli_epi16(c, 2));
+}
+
+COLOR_AVX2_INLINE __m256i color_expand6_avx2(__m256i c)
+{
+	return _mm256_or_si256(_mm256_slli_epi16(c, 2), _mm256_srli_epi16(c, 4));
+}
+
+/**
+ * 16 pixels from channels in 16 bit lanes, the alpha byte is left 0 as
+ * BGR32() leaves it. The unpacks work within lanes, so the halves are
+ * put back in order afterwards.
+ */
+COLOR_AVX2_INLINE void color_store_32_avx2(uint8* dst, __m256i byte0, __m256i byte1, __m256i byte2)
+{
+	__m256i lo, a, b;
+
+	lo = _mm256_or_si256(byte0, _mm256_slli_epi16(byte1, 8));
+	a = _mm256_unpacklo_epi16(lo, byte2);
+	b = _mm256_unpackhi_epi16(lo, byte2);
+
+	_mm256_storeu_si256((__m256i*) dst, _mm256_permute2x128_si256(a, b, 0x20));
+	_mm256_storeu_si256((__m256i*) (dst + 32), _mm256_permute2x128_si256(a, b, 0x31));
+}
+
+COLOR_AVX2_INLINE void color_555_to_32_avx2(const uint8* src, uint8* dst, int invert)
+{
+	__m256i p, lo, mid, hi;
+	__m256i mask = _mm256_set1_epi16(0x1F);
+
+	p = _mm256_loadu_si256((const __m256i*) src);
+	lo = color_expand5_avx2(_mm256_and_si256(p, mask));
+	mid = color_expand5_avx2(_mm256_and_si256(_mm256_srli_epi16(p, 5), mask));
+	hi = color_expand5_avx2(_mm256_and_si256(_mm256_srli_epi16(p, 10), mask));
+
+	if (invert)
+		color_store_32_avx2(dst, hi, mid, lo);
+	else
+		color_store_32_avx2(dst, lo, mid, hi);
+}
+
+COLOR_AVX2_INLINE void color_565_to_32_avx2(const uint8* src, uint8* dst, int invert)
+{
+	__m256i p, lo, mid, hi;
+
+	p = _mm256_loadu_si256((const __m256i*) src);
+	lo = color_expand5_avx2(_mm256_and_si256(p, _mm256_set1_epi16(0x1F)));
+	mid = color_expand6_avx2(_mm256_and_si256(_mm256_srli_epi16(p, 5), _mm256_set1_epi16(0x3F)));
+	hi = color_expand5_avx2(_mm256_srli_epi16(p, 11));
+
+	if (invert)
+		color_store_32_avx2(dst, hi, mid, lo);
+	else
+		color_store_32_avx2(dst, lo, mid, hi);
+}
+
+/**
+ * 8 pixels of 24 bpp to 32 bpp, 4 in each lane. The second load reads 4
+ * bytes past the pixels, which is why the kernel stops 2 pixels short of
+ * the end of a row.
+ */
+COLOR_AVX2_INLINE void color_24_to_32_avx2(const uint8* src, uint8* dst)
+{
+	__m256i p;
+
+	p = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) src)),
+		_mm_loadu_si128((const __m128i*) (src + 12)), 1);
+	p = _mm256_shuffle_epi8(p, COLOR_AVX2_SHUFFLE(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+	p = _mm256_or_si256(p, _mm256_set1_epi32((int) 0xFF000000));
+
+	_mm256_storeu_si256((__m256i*) dst, p);
+}
+
+/* 8 pixels of 32 bpp to 565, sign extended so that _mm256_packs_epi32 keeps all 16 bits */
+COLOR_AVX2_INLINE __m256i color_32_to_565_avx2(__m256i p, int invert)
+{
+	__m256i v;
+
+	v = _mm256_and_si256(_mm256_srli_epi32(p, 5), _mm256_set1_epi32(0x07E0));
+
+	if (invert)
+	{
+		v = _mm256_or_si256(v, _mm256_and_si256(_mm256_slli_epi32(p, 8), _mm256_set1_epi32(0xF800)));
+		v = _mm256_or_si256(v, _mm256_and_si256(_mm256_srli_epi32(p, 19), _mm256_set1_epi32(0x1F)));
+	}
+	else
+	{
+		v = _mm256_or_si256(v, _mm256_and_si256(_mm256_srli_epi32(p, 8), _mm256_set1_epi32(0xF800)));
+		v = _mm256_or_si256(v, _mm256_and_si256(_mm256_srli_epi32(p, 3), _mm256_set1_epi32(0x1F)));
+	}
+
+	return _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+}
+
+COLOR_AVX2_INLINE void color_32_to_16_avx2(const uint8* src, uint8* dst, int invert)
+{
+	__m256i lo, hi;
+
+	lo = color_32_to_565_avx2(_mm256_loadu_si256((const __m256i*) src), invert);
+	hi = color_32_to_565_avx2(_mm256_loadu_si256((const __m256i*) (src + 32)), invert);
+
+	/* the pack interleaves the lanes of lo and hi */
+	_mm256_storeu_si256((__m256i*) dst, _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8));
+}
+
+/**
+ * 8 pixels of 32 bpp to 24 bpp, packed to 12 bytes in each lane. Both
+ * lanes are stored whole, the 4 bytes past the second one belong to the
+ * next pixels and are written again later, which is why the kernel stops
+ * 2 pixels short of the end of a row.
+ */
+COLOR_AVX2_INLINE void color_32_to_24_avx2(const uint8* src, uint8* dst, int invert)
+{
+	__m256i p;
+
+	p = _mm256_loadu_si256((const __m256i*) src);
+
+	if (invert)
+		p = _mm256_shuffle_epi8(p, COLOR_AVX2_SHUFFLE(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+	else
+		p = _mm256_shuffle_epi8(p, COLOR_AVX2_SHUFFLE(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+
+	_mm_storeu_si128((__m128i*) dst, _mm256_castsi256_si128(p));
+	_mm_storeu_si128((__m128i*) (dst + 12), _mm256_extracti128_si256(p, 1));
+}
+
+COLOR_AVX2_KERNEL(color_convert_15_to_32_avx2, color_convert_15_to_32, 2, 4, 16, width & ~15,
+	color_555_to_32_avx2(src, dst, 0))
+COLOR_AVX2_KERNEL(color_convert_15_to_32_invert_avx2, color_convert_15_to_32_invert, 2, 4, 16, width & ~15,
+	color_555_to_32_avx2(src, dst, 1))
+COLOR_AVX2_KERNEL(color_convert_16_to_32_avx2, color_convert_16_to_32, 2, 4, 16, width & ~15,
+	color_565_to_32_avx2(src, dst, 0))
+COLOR_AVX2_KERNEL(color_convert_16_to_32_invert_avx2, color_convert_16_to_32_invert, 2, 4, 16, width & ~15,
+	color_565_to_32_avx2(src, dst, 1))
+COLOR_AVX2_KERNEL(color_convert_24_to_32_avx2, color_convert_24_to_32, 3, 4, 8, (width - 2) & ~7,
+	color_24_to_32_avx2(src, dst))
+COLOR_AVX2_KERNEL(color_convert_32_to_16_avx2, color_convert_32_to_16, 4, 2, 16, width & ~15,
+	color_32_to_16_avx2(src, dst, 0))
+COLOR_AVX2_KERNEL(color_convert_32_to_16_invert_avx2, color_convert_32_to_16_invert, 4, 2, 16, width & ~15,
+	color_32_to_16_avx2(src, dst, 1))
+COLOR_AVX2_KERNEL(color_convert_32_to_24_avx2, color_convert_32_to_24, 4, 3, 8, (width - 2) & ~7,
+	color_32_to_24_avx2(src, dst, 0))
+COLOR_AVX2_KERNEL(color_convert_32_to_24_invert_avx2, color_convert_32_to_24_invert, 4, 3, 8, (width - 2) & ~7,
+	color_32_to_24_avx2(src, dst, 1))
+COLOR_AVX2_KERNEL(color_convert_32_to_32_alpha_avx2, color_convert_32_to_32_alpha, 4, 4, 8, width & ~7,
+	_mm256_storeu_si256((__m256i*) dst, _mm256_or_si256(_mm256_loadu_si256((const __m256i*) src), _mm256_set1_epi32((int) 0xFF000000))))
+COLOR_AVX2_KERNEL(color_convert_32_to_32_swap_avx2, color_convert_32_to_32_swap, 4, 4, 8, width & ~7,
+	_mm256_storeu_si256((__m256i*) dst, _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*) src),
+		COLOR_AVX2_SHUFFLE(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15))))
+
+void color_init_avx2(COLOR_KERNELS* kernels)
+{
+	color_set_kernel(kernels, 15, 32, CLRCONV_INVERT, 0, color_convert_15_to_32_avx2);
+	color_set_kernel(kernels, 15, 32, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_15_to_32_invert_avx2);
+	color_set_kernel(kernels, 16, 32, CLRCONV_INVERT, 0, color_convert_16_to_32_avx2);
+	color_set_kernel(kernels, 16, 32, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_16_to_32_invert_avx2);
+	color_set_kernel(kernels, 24, 32, 0, 0, color_convert_24_to_32_avx2);
+	color_set_kernel(kernels, 32, 16, CLRCONV_INVERT, 0, color_convert_32_to_16_avx2);
+	color_set_kernel(kernels, 32, 16, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_32_to_16_invert_avx2);
+	color_set_kernel(kernels, 32, 24, CLRCONV_INVERT, 0, color_convert_32_to_24_avx2);
+	color_set_kernel(kernels, 32, 24, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_32_to_24_invert_avx2);
+	color_set_kernel(kernels, 32, 32, CLRCONV_ALPHA, CLRCONV_ALPHA, color_convert_32_to_32_alpha_avx2);
+
+	kernels->swap32 = color_convert_32_to_32_swap_avx2;
+}
@@ -0,0 +1,230 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * Color Conversion Kernels - SSE2 Optimizations
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xmmintrin.h>
+#include <emmintrin.h>
+
+#include "color_types.h"
+#include "color_sse2.h"
+
+#ifdef _MSC_VER
+#define	__attribute__(...)
+#endif
+
+#define COLOR_SSE2_INLINE static __inline __attribute__((__gnu_inline__, __always_inline__, __artificial__))
+
+/**
+ * Run _body over the first _count columns of every row, _step pixels at a
+ * time, and leave the remaining columns to the C kernel _tail. The output
+ * matches the C kernels bit for bit.
+ */
+#define COLOR_SSE2_KERNEL(_name, _tail, _src_bytes, _dst_bytes, _step, _count, _body) \
+static void _name(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv) \
+{ \
+	int x, y; \
+	int n = MAX(_count, 0); \
+	const uint8* src; \
+	uint8* dst; \
+\
+	for (y = 0; y < height; y++) \
+	{ \
+		src = srcData + y * srcStride; \
+		dst = dstData + y * dstStride; \
+\
+		for (x = 0; x < n; x += _step) \
+		{ \
+			_body; \
+			src += _step * _src_bytes; \
+			dst += _step * _dst_bytes; \
+		} \
+	} \
+\
+	_tail(srcData + n * _src_bytes, srcStride, dstData + n * _dst_bytes, dstStride, width - n, height, clrconv); \
+}
+
+/* widen 5 and 6 bit channels in 16 bit lanes to 8 bits, as RGB_565_888 does */
+COLOR_SSE2_INLINE __m128i color_expand5_sse2(__m128i c)
+{
+	return _mm_or_si128(_mm_slli_epi16(c, 3), _mm_srli_epi16(c, 2));
+}
+
+COLOR_SSE2_INLINE __m128i color_expand6_sse2(__m128i c)
+{
+	return _mm_or_si128(_mm_slli_epi16(c, 2), _mm_srli_epi16(c, 4));
+}
+
+/* 8 pixels from channels in 16 bit lanes, the alpha byte is left 0 as BGR32() leaves it */
+COLOR_SSE2_INLINE void color_store_32_sse2(uint8* dst, __m128i byte0, __m128i byte1, __m128i byte2)
+{
+	__m128i lo = _mm_or_si128(byte0, _mm_slli_epi16(byte1, 8));
+
+	_mm_storeu_si128((__m128i*) dst, _mm_unpacklo_epi16(lo, byte2));
+	_mm_storeu_si128((__m128i*) (dst + 16), _mm_unpackhi_epi16(lo, byte2));
+}
+
+COLOR_SSE2_INLINE void color_555_to_32_sse2(const uint8* src, uint8* dst, int invert)
+{
+	__m128i p, lo, mid, hi;
+	__m128i mask = _mm_set1_epi16(0x1F);
+
+	p = _mm_loadu_si128((const __m128i*) src);
+	lo = color_expand5_sse2(_mm_and_si128(p, mask));
+	mid = color_expand5_sse2(_mm_and_si128(_mm_srli_epi16(p, 5), mask));
+	hi = color_expand5_sse2(_mm_and_si128(_mm_srli_epi16(p, 10), mask));
+
+	if (invert)
+		color_store_32_sse2(dst, hi, mid, lo);
+	else
+		color_store_32_sse2(dst, lo, mid, hi);
+}
+
+COLOR_SSE2_INLINE void color_565_to_32_sse2(const uint8* src, uint8* dst, int invert)
+{
+	__m128i p, lo, mid, hi;
+
+	p = _mm_loadu_si128((const __m128i*) src);
+	lo = color_expand5_sse2(_mm_and_si128(p, _mm_set1_epi16(0x1F)));
+	mid = color_expand6_sse2(_mm_and_si128(_mm_srli_epi16(p, 5), _mm_set1_epi16(0x3F)));
+	hi = color_expand5_sse2(_mm_srli_epi16(p, 11));
+
+	if (invert)
+		color_store_32_sse2(dst, hi, mid, lo);
+	else
+		color_store_32_sse2(dst, lo, mid, hi);
+}
+
+/**
+ * 4 pixels of 24 bpp to 32 bpp. Reads 16 bytes for the 12 it converts,
+ * which is why the kernel stops 2 pixels short of the end of a row.
+ */
+COLOR_SSE2_INLINE void color_24_to_32_sse2(const uint8* src, uint8* dst)
+{
+	__m128i p, lo, hi;
+
+	p = _mm_loadu_si128((const __m128i*) src);
+	lo = _mm_unpacklo_epi32(p, _mm_srli_si128(p, 3));
+	hi = _mm_unpacklo_epi32(_mm_srli_si128(p, 6), _mm_srli_si128(p, 9));
+	p = _mm_or_si128(_mm_unpacklo_epi64(lo, hi), _mm_set1_epi32((int) 0xFF000000));
+
+	_mm_storeu_si128((__m128i*) dst, p);
+}
+
+/* swap bytes 0 and 2 of each 32 bit pixel */
+COLOR_SSE2_INLINE __m128i color_swap_rb_sse2(__m128i p)
+{
+	__m128i rb = _mm_and_si128(p, _mm_set1_epi32(0x00FF00FF));
+
+	rb = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+
+	return _mm_or_si128(_mm_and_si128(p, _mm_set1_epi32((int) 0xFF00FF00)), rb);
+}
+
+/* 4 pixels of 32 bpp to 565, sign extended so that _mm_packs_epi32 keeps all 16 bits */
+COLOR_SSE2_INLINE __m128i color_32_to_565_sse2(__m128i p, int invert)
+{
+	__m128i v;
+
+	v = _mm_and_si128(_mm_srli_epi32(p, 5), _mm_set1_epi32(0x07E0));
+
+	if (invert)
+	{
+		v = _mm_or_si128(v, _mm_and_si128(_mm_slli_epi32(p, 8), _mm_set1_epi32(0xF800)));
+		v = _mm_or_si128(v, _mm_and_si128(_mm_srli_epi32(p, 19), _mm_set1_epi32(0x1F)));
+	}
+	else
+	{
+		v = _mm_or_si128(v, _mm_and_si128(_mm_srli_epi32(p, 8), _mm_set1_epi32(0xF800)));
+		v = _mm_or_si128(v, _mm_and_si128(_mm_srli_epi32(p, 3), _mm_set1_epi32(0x1F)));
+	}
+
+	return _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+}
+
+COLOR_SSE2_INLINE void color_32_to_16_sse2(const uint8* src, uint8* dst, int invert)
+{
+	__m128i lo, hi;
+
+	lo = color_32_to_565_sse2(_mm_loadu_si128((const __m128i*) src), invert);
+	hi = color_32_to_565_sse2(_mm_loadu_si128((const __m128i*) (src + 16)), invert);
+
+	_mm_storeu_si128((__m128i*) dst, _mm_packs_epi32(lo, hi));
+}
+
+/**
+ * 4 pixels of 32 bpp to 24 bpp: each 64 bit lane is first packed into its
+ * low 6 bytes, then the two lanes are joined and written as 8 + 4 bytes.
+ */
+COLOR_SSE2_INLINE void color_32_to_24_sse2(const uint8* src, uint8* dst, int invert)
+{
+	int tail;
+	__m128i p;
+
+	p = _mm_loadu_si128((const __m128i*) src);
+
+	if (invert)
+		p = color_swap_rb_sse2(p);
+
+	p = _mm_or_si128(_mm_and_si128(p, _mm_set_epi32(0, 0x00FFFFFF, 0, 0x00FFFFFF)),
+		_mm_and_si128(_mm_srli_epi64(p, 8), _mm_set_epi32(0x0000FFFF, (int) 0xFF000000, 0x0000FFFF, (int) 0xFF000000)));
+	p = _mm_or_si128(_mm_move_epi64(p), _mm_slli_si128(_mm_srli_si128(p, 8), 6));
+
+	_mm_storel_epi64((__m128i*) dst, p);
+	tail = _mm_cvtsi128_si32(_mm_srli_si128(p, 8));
+	memcpy(dst + 8, &tail, 4);
+}
+
+COLOR_SSE2_KERNEL(color_convert_15_to_32_sse2, color_convert_15_to_32, 2, 4, 8, width & ~7,
+	color_555_to_32_sse2(src, dst, 0))
+COLOR_SSE2_KERNEL(color_convert_15_to_32_invert_sse2, color_convert_15_to_32_invert, 2, 4, 8, width & ~7,
+	color_555_to_32_sse2(src, dst, 1))
+COLOR_SSE2_KERNEL(color_convert_16_to_32_sse2, color_convert_16_to_32, 2, 4, 8, width & ~7,
+	color_565_to_32_sse2(src, dst, 0))
+COLOR_SSE2_KERNEL(color_convert_16_to_32_invert_sse2, color_convert_16_to_32_invert, 2, 4, 8, width & ~7,
+	color_565_to_32_sse2(src, dst, 1))
+COLOR_SSE2_KERNEL(color_convert_24_to_32_sse2, color_convert_24_to_32, 3, 4, 4, (width - 2) & ~3,
+	color_24_to_32_sse2(src, dst))
+COLOR_SSE2_KERNEL(color_convert_32_to_16_sse2, color_convert_32_to_16, 4, 2, 8, width & ~7,
+	color_32_to_16_sse2(src, dst, 0))
+COLOR_SSE2_KERNEL(color_convert_32_to_16_invert_sse2, color_convert_32_to_16_invert, 4, 2, 8, width & ~7,
+	color_32_to_16_sse2(src, dst, 1))
+COLOR_SSE2_KERNEL(color_convert_32_to_24_sse2, color_convert_32_to_24, 4, 3, 4, width & ~3,
+	color_32_to_24_sse2(src, dst, 0))
+COLOR_SSE2_KERNEL(color_convert_32_to_24_invert_sse2, color_convert_32_to_24_invert, 4, 3, 4, width & ~3,
+	color_32_to_24_sse2(src, dst, 1))
+COLOR_SSE2_KERNEL(color_convert_32_to_32_alpha_sse2, color_convert_32_to_32_alpha, 4, 4, 4, width & ~3,
+	_mm_storeu_si128((__m128i*) dst, _mm_or_si128(_mm_loadu_si128((const __m128i*) src), _mm_set1_epi32((int) 0xFF000000))))
+COLOR_SSE2_KERNEL(color_convert_32_to_32_swap_sse2, color_convert_32_to_32_swap, 4, 4, 4, width & ~3,
+	_mm_storeu_si128((__m128i*) dst, color_swap_rb_sse2(_mm_loadu_si128((const __m128i*) src))))
+
+void color_init_sse2(COLOR_KERNELS* kernels)
+{
+	color_set_kernel(kernels, 15, 32, CLRCONV_INVERT, 0, color_convert_15_to_32_sse2);
+	color_set_kernel(kernels, 15, 32, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_15_to_32_invert_sse2);
+	color_set_kernel(kernels, 16, 32, CLRCONV_INVERT, 0, color_convert_16_to_32_sse2);
+	color_set_kernel(kernels, 16, 32, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_16_to_32_invert_sse2);
+	color_set_kernel(kernels, 24, 32, 0, 0, color_convert_24_to_32_sse2);
+	color_set_kernel(kernels, 32, 16, CLRCONV_INVERT, 0, color_convert_32_to_16_sse2);
+	color_set_kernel(kernels, 32, 16, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_32_to_16_invert_sse2);
+	color_set_kernel(kernels, 32, 24, CLRCONV_INVERT, 0, color_convert_32_to_24_sse2);
+	color_set_kernel(kernels, 32, 24, CLRCONV_INVERT, CLRCONV_INVERT, color_convert_32_to_24_invert_sse2);
+	color_set_kernel(kernels, 32, 32, CLRCONV_ALPHA, CLRCONV_ALPHA, color_convert_32_to_32_alpha_sse2);
+
+	kernels->swap32 = color_convert_32_to_32_swap_sse2;
+}
@@ -0,0 +1,57 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * Color Conversion Kernels
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __COLOR_TYPES_H
+#define __COLOR_TYPES_H
+
+#include <freerdp/codec/color.h>
+
+/**
+ * Conversion kernels, indexed by source and destination format (8, 15, 16,
+ * 24 and 32 bpp) and by the CLRCONV_ALPHA, CLRCONV_INVERT and CLRCONV_RGB555
+ * flags they were built for, so that no kernel looks at the flags per pixel.
+ * A NULL kernel is a conversion freerdp_image_convert() never supported.
+ */
+#define COLOR_FORMATS	5
+#define COLOR_FLAGS	8
+
+struct _COLOR_KERNELS
+{
+	p_freerdp_image_convert_ex convert[COLOR_FORMATS][COLOR_FORMATS][COLOR_FLAGS];
+
+	/* swaps red and blue of 32 bpp pixels, keeping alpha */
+	p_freerdp_image_convert_ex swap32;
+};
+typedef struct _COLOR_KERNELS COLOR_KERNELS;
+
+void color_set_kernel(COLOR_KERNELS* kernels, int srcBpp, int dstBpp,
+	uint32 mask, uint32 flags, p_freerdp_image_convert_ex kernel);
+
+/* plain C kernels, the SIMD ones finish the columns they leave with these */
+void color_convert_15_to_32(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_15_to_32_invert(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_16_to_32(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_16_to_32_invert(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_24_to_32(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_32_to_16(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_32_to_16_invert(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_32_to_24(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_32_to_24_invert(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_32_to_32_alpha(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+void color_convert_32_to_32_swap(const uint8* srcData, int srcStride, uint8* dstData, int dstStride, int width, int height, HCLRCONV clrconv);
+
+#endif /* __COLOR_TYPES_H */
@@ -0,0 +1,396 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * H.264 Surface Bits Decoder
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <freerdp/codec/h264.h>
+#include <freerdp/utils/memory.h>
+#include <freerdp/utils/cpu.h>
+
+#include "h264_types.h"
+
+#ifdef WITH_SSE2
+#include "h264_sse2.h"
+#endif
+
+#ifndef H264_INIT_SIMD
+#define H264_INIT_SIMD(_h264_context) do { } while (0)
+#endif
+
+#define H264_CLAMP(_v, _lo, _hi) (((_v) < (_lo)) ? (_lo) : (((_v) > (_hi)) ? (_hi) : (_v)))
+
+/**
+ * Convert the width x height pixels at x, y of a YUV 4:2:0 picture to BGRX
+ * at the same position in dst. See h264_types.h for the arithmetic.
+ */
+void h264_yuv420_to_bgrx(const uint8* const planes[3], const int strides[3],
+	int x, int y, int width, int height, uint8* dst, int dst_stride)
+{
+	int i, j;
+	int y_val, u_val, v_val;
+	int r_val, g_val, b_val;
+	const uint8* yrow;
+	const uint8* urow;
+	const uint8* vrow;
+	uint8* drow;
+
+	for (j = y; j < y + height; j++)
+	{
+		yrow = planes[0] + j * strides[0];
+		urow = planes[1] + (j >> 1) * strides[1];
+		vrow = planes[2] + (j >> 1) * strides[2];
+		drow = dst + j * dst_stride + x * 4;
+
+		for (i = x; i < x + width; i++)
+		{
+			y_val = (H264_CLAMP(yrow[i], 16, 235) - 16) * H264_Y_SCALE + 32;
+			u_val = H264_CLAMP(urow[i >> 1], 16, 240) - 128;
+			v_val = H264_CLAMP(vrow[i >> 1], 16, 240) - 128;
+
+			r_val = (y_val + H264_V_TO_R * v_val) >> 6;
+			g_val = (y_val - H264_U_TO_G * u_val - H264_V_TO_G * v_val) >> 6;
+			b_val = (y_val + H264_U_TO_B * u_val) >> 6;
+
+			*drow++ = H264_CLAMP(b_val, 0, 0xFF);
+			*drow++ = H264_CLAMP(g_val, 0, 0xFF);
+			*drow++ = H264_CLAMP(r_val, 0, 0xFF);
+			*drow++ = 0xFF;
+		}
+	}
+}
+
+#if defined(WITH_H264)
+
+#include <libavcodec/avcodec.h>
+
+/* Compatibility with older FFmpeg */
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(54, 25, 0)
+#define AV_CODEC_ID_H264 CODEC_ID_H264
+#endif
+
+#if LIBAVUTIL_VERSION_INT < AV_VERSION_INT(51, 42, 0)
+#define AV_PIX_FMT_YUV420P PIX_FMT_YUV420P
+#define AV_PIX_FMT_YUVJ420P PIX_FMT_YUVJ420P
+#endif
+
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(55, 28, 1)
+#define av_frame_alloc avcodec_alloc_frame
+#define av_frame_free avcodec_free_frame
+#endif
+
+#ifndef AV_CODEC_FLAG_LOW_DELAY
+#define AV_CODEC_FLAG_LOW_DELAY CODEC_FLAG_LOW_DELAY
+#endif
+
+/**
+ * The decoder runs with slice threads and low delay, so a picture normally
+ * comes out of the packet that carries it. A stream with reordered frames
+ * can still hand back an earlier picture; the rects and the destination of
+ * each submitted packet wait here until its picture comes out.
+ */
+#define H264_MAX_PENDING 64
+#define H264_MAX_THREADS 16
+
+struct _H264_PENDING
+{
+	RECTANGLE_16* rects;
+	int num_rects;
+	int max_rects;
+	int left;
+	int top;
+};
+typedef struct _H264_PENDING H264_PENDING;
+
+struct _H264_CONTEXT_PRIV
+{
+	AVCodecContext* codec_context;
+	AVFrame* frame;
+	int thread_count;
+	boolean opened;
+
+	H264_PENDING pending[H264_MAX_PENDING];
+	int64_t sequence;
+};
+typedef struct _H264_CONTEXT_PRIV H264_CONTEXT_PRIV;
+
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(58, 10, 100)
+static boolean h264_registered = false;
+#endif
+
+static void h264_priv_new(H264_CONTEXT* context)
+{
+	H264_CONTEXT_PRIV* priv;
+
+#if LIBAVCODEC_VERSION_INT < AV_VERSION_INT(58, 10, 100)
+	if (!h264_registered)
+	{
+		avcodec_register_all();
+		h264_registered = true;
+	}
+#endif
+
+	priv = xnew(H264_CONTEXT_PRIV);
+	priv->codec_context = avcodec_alloc_context3(NULL);
+	priv->frame = av_frame_alloc();
+
+	if (priv->codec_context == NULL || priv->frame == NULL)
+	{
+		printf("h264_priv_new: allocation failed\n");
+		av_free(priv->codec_context);
+		av_frame_free(&priv->frame);
+		xfree(priv);
+		return;
+	}
+
+	priv->thread_count = 1;
+	context->priv = priv;
+}
+
+static void h264_priv_free(H264_CONTEXT* context)
+{
+	int i;
+	H264_CONTEXT_PRIV* priv = (H264_CONTEXT_PRIV*) context->priv;
+
+	if (priv == NULL)
+		return;
+
+	if (priv->opened)
+		avcodec_close(priv->codec_context);
+
+	av_free(priv->codec_context);
+	av_frame_free(&priv->frame);
+
+	for (i = 0; i < H264_MAX_PENDING; i++)
+		xfree(priv->pending[i].rects);
+
+	xfree(priv);
+	context->priv = NULL;
+}
+
+/**
+ * The decoder is opened on the first frame, once the thread count is known.
+ */
+static boolean h264_priv_open(H264_CONTEXT_PRIV* priv)
+{
+	AVCodec* codec;
+
+	codec = avcodec_find_decoder(AV_CODEC_ID_H264);
+
+	if (codec == NULL)
+	{
+		printf("h264_priv_open: avcodec_find_decoder failed\n");
+		return false;
+	}
+
+	/* frame threads would hold back up to thread_count - 1 pictures */
+#ifdef FF_THREAD_SLICE
+	priv->codec_context->thread_count = priv->thread_count;
+	priv->codec_context->thread_type = FF_THREAD_SLICE;
+#endif
+	priv->codec_context->flags |= AV_CODEC_FLAG_LOW_DELAY;
+
+	if (avcodec_open2(priv->codec_context, codec, NULL) < 0)
+	{
+		printf("h264_priv_open: avcodec_open2 failed\n");
+		return false;
+	}
+
+	priv->opened = true;
+
+	return true;
+}
+
+/**
+ * Clip the rects of a decoded frame to the frame and the destination,
+ * and convert what is left of them. Returns the number of rects converted.
+ */
+static int h264_convert_frame(H264_CONTEXT* context, H264_PENDING* pending,
+	uint8* dst, int dst_stride, int dst_width, int dst_height)
+{
+	int i;
+	int width, height;
+	RECTANGLE_16* rect;
+	H264_CONTEXT_PRIV* priv = (H264_CONTEXT_PRIV*) context->priv;
+	AVFrame* frame = priv->frame;
+
+	if (priv->codec_context->pix_fmt != AV_PIX_FMT_YUV420P &&
+		priv->codec_context->pix_fmt != AV_PIX_FMT_YUVJ420P)
+	{
+		printf("h264_convert_frame: unsupported pixel format %d\n", priv->codec_context->pix_fmt);
+		return -1;
+	}
+
+	context->width = priv->codec_context->width;
+	context->height = priv->codec_context->height;
+	context->left = pending->left;
+	context->top = pending->top;
+	context->rects = pending->rects;
+	context->num_rects = 0;
+
+	width = MIN(context->width, dst_width);
+	height = MIN(context->height, dst_height);
+
+	for (i = 0; i < pending->num_rects; i++)
+	{
+		rect = &pending->rects[i];
+
+		if (rect->right > width)
+			rect->right = width;
+
+		if (rect->bottom > height)
+			rect->bottom = height;
+
+		if (rect->left >= rect->right || rect->top >= rect->bottom)
+			continue;
+
+		context->yuv420_to_bgrx((const uint8* const*) frame->data, frame->linesize,
+			rect->left, rect->top, rect->right - rect->left, rect->bottom - rect->top,
+			dst, dst_stride);
+
+		context->rects[context->num_rects++] = *rect;
+	}
+
+	return context->num_rects;
+}
+
+/**
+ * Feed one H.264 access unit to the decoder. rects are the parts of the
+ * frame the server updated, and left, top where the frame goes. When a
+ * frame comes out of the decoder, its own rects are converted to BGRX in
+ * dst, a frame-sized buffer, and left in context->rects, with its own
+ * destination in context->left and context->top. Returns the number of
+ * rects converted, 0 while the decoder still holds the picture, or -1 on
+ * error.
+ */
+int h264_decompress(H264_CONTEXT* context, uint8* data, int size, RECTANGLE_16* rects, int num_rects,
+	int left, int top, uint8* dst, int dst_stride, int dst_width, int dst_height)
+{
+	int len;
+	int got_frame;
+	AVPacket pkt;
+	H264_PENDING* pending;
+	H264_CONTEXT_PRIV* priv = (H264_CONTEXT_PRIV*) context->priv;
+
+	if (priv == NULL)
+		return -1;
+
+	if (!priv->opened && !h264_priv_open(priv))
+		return -1;
+
+	pending = &priv->pending[priv->sequence % H264_MAX_PENDING];
+
+	if (pending->max_rects < num_rects)
+	{
+		pending->rects = (RECTANGLE_16*) xrealloc(pending->rects, num_rects * sizeof(RECTANGLE_16));
+		pending->max_rects = num_rects;
+	}
+
+	memcpy(pending->rects, rects, num_rects * sizeof(RECTANGLE_16));
+	pending->num_rects = num_rects;
+	pending->left = left;
+	pending->top = top;
+
+	/* tags the packet, so that a reordered picture finds the rects it came with */
+	priv->codec_context->reordered_opaque = priv->sequence++;
+
+	av_init_packet(&pkt);
+	pkt.data = data;
+	pkt.size = size;
+
+	got_frame = 0;
+	len = avcodec_decode_video2(priv->codec_context, priv->frame, &got_frame, &pkt);
+
+	if (len < 0)
+	{
+		printf("h264_decompress: avcodec_decode_video2 failed (%d)\n", len);
+		return -1;
+	}
+
+	if (!got_frame)
+		return 0;
+
+	pending = &priv->pending[priv->frame->reordered_opaque % H264_MAX_PENDING];
+
+	return h264_convert_frame(context, pending, dst, dst_stride, dst_width, dst_height);
+}
+
+void h264_context_set_thread_count(H264_CONTEXT* context, int thread_count)
+{
+	H264_CONTEXT_PRIV* priv = (H264_CONTEXT_PRIV*) context->priv;
+
+	if (priv == NULL || priv->opened)
+		return;
+
+	priv->thread_count = H264_CLAMP(thread_count, 1, H264_MAX_THREADS);
+}
+
+#else
+
+static void h264_priv_new(H264_CONTEXT* context)
+{
+}
+
+static void h264_priv_free(H264_CONTEXT* context)
+{
+}
+
+int h264_decompress(H264_CONTEXT* context, uint8* data, int size, RECTANGLE_16* rects, int num_rects,
+	int left, int top, uint8* dst, int dst_stride, int dst_width, int dst_height)
+{
+	return -1;
+}
+
+void h264_context_set_thread_count(H264_CONTEXT* context, int thread_count)
+{
+}
+
+#endif
+
+H264_CONTEXT* h264_context_new(void)
+{
+	H264_CONTEXT* h264_context;
+
+	h264_context = xnew(H264_CONTEXT);
+	h264_priv_new(h264_context);
+
+	h264_context_set_cpu_opt(h264_context, freerdp_detect_cpu());
+
+	return h264_context;
+}
+
+void h264_context_free(H264_CONTEXT* context)
+{
+	if (context == NULL)
+		return;
+
+	h264_priv_free(context);
+	xfree(context);
+}
+
+/**
+ * Select the conversion routine for the CPU_* flags in cpu_opt, as returned
+ * by freerdp_detect_cpu(). A cpu_opt of 0 restores the plain C routine.
+ */
+void h264_context_set_cpu_opt(H264_CONTEXT* context, uint32 cpu_opt)
+{
+	context->yuv420_to_bgrx = h264_yuv420_to_bgrx;
+
+	if (cpu_opt & CPU_SSE2)
+		H264_INIT_SIMD(context);
+}
@@ -0,0 +1,134 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * H.264 Surface Bits Decoder - SSE2 Optimizations
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xmmintrin.h>
+#include <emmintrin.h>
+
+#include "h264_types.h"
+#include "h264_sse2.h"
+
+#ifdef _MSC_VER
+#define	__attribute__(...)
+#endif
+
+/**
+ * Convert 16 pixels of a row to BGRX, each of the 8 chroma samples read
+ * is used for two neighbouring pixels.
+ */
+static __inline void __attribute__((__gnu_inline__, __always_inline__, __artificial__))
+h264_yuv420_to_bgrx_pixels_sse2(const uint8* yrow, const uint8* urow, const uint8* vrow, uint8* dst)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i y_val, u_val, v_val;
+	__m128i y_lo, y_hi, u_lo, u_hi, v_lo, v_hi;
+	__m128i r_val, g_val, b_val, x_val;
+	__m128i bg, rx;
+
+	/* clamp to the nominal range, see h264_types.h */
+	y_val = _mm_loadu_si128((__m128i*) yrow);
+	y_val = _mm_min_epu8(_mm_max_epu8(y_val, _mm_set1_epi8(16)), _mm_set1_epi8((char) 235));
+	u_val = _mm_loadl_epi64((__m128i*) urow);
+	u_val = _mm_min_epu8(_mm_max_epu8(u_val, _mm_set1_epi8(16)), _mm_set1_epi8((char) 240));
+	v_val = _mm_loadl_epi64((__m128i*) vrow);
+	v_val = _mm_min_epu8(_mm_max_epu8(v_val, _mm_set1_epi8(16)), _mm_set1_epi8((char) 240));
+
+	y_lo = _mm_sub_epi16(_mm_unpacklo_epi8(y_val, zero), _mm_set1_epi16(16));
+	y_hi = _mm_sub_epi16(_mm_unpackhi_epi8(y_val, zero), _mm_set1_epi16(16));
+	y_lo = _mm_add_epi16(_mm_mullo_epi16(y_lo, _mm_set1_epi16(H264_Y_SCALE)), _mm_set1_epi16(32));
+	y_hi = _mm_add_epi16(_mm_mullo_epi16(y_hi, _mm_set1_epi16(H264_Y_SCALE)), _mm_set1_epi16(32));
+
+	u_val = _mm_sub_epi16(_mm_unpacklo_epi8(u_val, zero), _mm_set1_epi16(128));
+	u_lo = _mm_unpacklo_epi16(u_val, u_val);
+	u_hi = _mm_unpackhi_epi16(u_val, u_val);
+	v_val = _mm_sub_epi16(_mm_unpacklo_epi8(v_val, zero), _mm_set1_epi16(128));
+	v_lo = _mm_unpacklo_epi16(v_val, v_val);
+	v_hi = _mm_unpackhi_epi16(v_val, v_val);
+
+	r_val = _mm_packus_epi16(
+		_mm_srai_epi16(_mm_add_epi16(y_lo, _mm_mullo_epi16(v_lo, _mm_set1_epi16(H264_V_TO_R))), 6),
+		_mm_srai_epi16(_mm_add_epi16(y_hi, _mm_mullo_epi16(v_hi, _mm_set1_epi16(H264_V_TO_R))), 6));
+
+	g_val = _mm_packus_epi16(
+		_mm_srai_epi16(_mm_sub_epi16(_mm_sub_epi16(y_lo,
+			_mm_mullo_epi16(u_lo, _mm_set1_epi16(H264_U_TO_G))),
+			_mm_mullo_epi16(v_lo, _mm_set1_epi16(H264_V_TO_G))), 6),
+		_mm_srai_epi16(_mm_sub_epi16(_mm_sub_epi16(y_hi,
+			_mm_mullo_epi16(u_hi, _mm_set1_epi16(H264_U_TO_G))),
+			_mm_mullo_epi16(v_hi, _mm_set1_epi16(H264_V_TO_G))), 6));
+
+	b_val = _mm_packus_epi16(
+		_mm_srai_epi16(_mm_add_epi16(y_lo, _mm_mullo_epi16(u_lo, _mm_set1_epi16(H264_U_TO_B))), 6),
+		_mm_srai_epi16(_mm_add_epi16(y_hi, _mm_mullo_epi16(u_hi, _mm_set1_epi16(H264_U_TO_B))), 6));
+
+	x_val = _mm_set1_epi8((char) 0xFF);
+
+	bg = _mm_unpacklo_epi8(b_val, g_val);
+	rx = _mm_unpacklo_epi8(r_val, x_val);
+	_mm_storeu_si128((__m128i*) dst, _mm_unpacklo_epi16(bg, rx));
+	_mm_storeu_si128((__m128i*) (dst + 16), _mm_unpackhi_epi16(bg, rx));
+
+	bg = _mm_unpackhi_epi8(b_val, g_val);
+	rx = _mm_unpackhi_epi8(r_val, x_val);
+	_mm_storeu_si128((__m128i*) (dst + 32), _mm_unpacklo_epi16(bg, rx));
+	_mm_storeu_si128((__m128i*) (dst + 48), _mm_unpackhi_epi16(bg, rx));
+}
+
+static void h264_yuv420_to_bgrx_sse2(const uint8* const planes[3], const int strides[3],
+	int x, int y, int width, int height, uint8* dst, int dst_stride)
+{
+	int i, j;
+	int simd_width;
+	const uint8* yrow;
+	const uint8* urow;
+	const uint8* vrow;
+	uint8* drow;
+
+	if (width <= 0 || height <= 0)
+		return;
+
+	/* chroma pairs start on even columns */
+	if (x & 1)
+	{
+		h264_yuv420_to_bgrx(planes, strides, x, y, 1, height, dst, dst_stride);
+		x++;
+		width--;
+	}
+
+	simd_width = width & ~15;
+
+	for (j = y; j < y + height; j++)
+	{
+		yrow = planes[0] + j * strides[0] + x;
+		urow = planes[1] + (j >> 1) * strides[1] + (x >> 1);
+		vrow = planes[2] + (j >> 1) * strides[2] + (x >> 1);
+		drow = dst + j * dst_stride + x * 4;
+
+		for (i = 0; i < simd_width; i += 16)
+			h264_yuv420_to_bgrx_pixels_sse2(yrow + i, urow + (i >> 1), vrow + (i >> 1), drow + i * 4);
+	}
+
+	if (simd_width < width)
+		h264_yuv420_to_bgrx(planes, strides, x + simd_width, y, width - simd_width, height, dst, dst_stride);
+}
+
+void h264_init_sse2(H264_CONTEXT* context)
+{
+	context->yuv420_to_bgrx = h264_yuv420_to_bgrx_sse2;
+}
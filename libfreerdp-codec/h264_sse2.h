@@ -0,0 +1,29 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * H.264 Surface Bits Decoder - SSE2 Optimizations
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __H264_SSE2_H
+#define __H264_SSE2_H
+
+#include <freerdp/codec/h264.h>
+
+void h264_init_sse2(H264_CONTEXT* context);
+
+#ifndef H264_INIT_SIMD
+#define H264_INIT_SIMD(_h264_context) h264_init_sse2(_h264_context)
+#endif
+
+#endif /* __H264_SSE2_H */
@@ -0,0 +1,37 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * H.264 Surface Bits Decoder
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __H264_TYPES_H
+#define __H264_TYPES_H
+
+#include <freerdp/codec/h264.h>
+
+/**
+ * BT.601 limited range coefficients in 10.6 fixed point. Inputs are clamped
+ * to the nominal range first, which keeps every intermediate within 16 bits
+ * so the SIMD routines give the same results as the C one.
+ */
+#define H264_Y_SCALE	75	/* 1.164 */
+#define H264_V_TO_R	102	/* 1.596 */
+#define H264_U_TO_G	25	/* 0.391 */
+#define H264_V_TO_G	52	/* 0.813 */
+#define H264_U_TO_B	129	/* 2.018 */
+
+void h264_yuv420_to_bgrx(const uint8* const planes[3], const int strides[3],
+	int x, int y, int width, int height, uint8* dst, int dst_stride);
+
+#endif /* __H264_TYPES_H */
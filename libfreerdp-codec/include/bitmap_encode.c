@@ -0,0 +1,353 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * RLE Compressed Bitmap Stream Encoder
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* do not compile the file directly */
+
+/**
+ * Write pixels as color image orders.
+ */
+static void WRITECOLORIMAGE(STREAM* s, PIXEL* pixels, uint32 count)
+{
+	uint32 length;
+
+	while (count > 0)
+	{
+		length = (count > 0xFFFF) ? 0xFFFF : count;
+		WriteRegularOrder(s, REGULAR_COLOR_IMAGE, MEGA_MEGA_COLOR_IMAGE, length);
+		count -= length;
+
+		while (length > 0)
+		{
+			STREAMWRITEPIXEL(s, *pixels);
+			pixels++;
+			length--;
+		}
+	}
+}
+
+/**
+ * Compress a top-down bitmap into an RLE compressed bitmap stream.
+ * Orders are picked greedily: at each pixel the order saving the most
+ * bytes over a color image is written, and pixels no order saves on are
+ * gathered into color images.
+ */
+static int RLECOMPRESS(uint8* srcData, int width, int height, STREAM* s)
+{
+	int x, y;
+	uint32 i, j, k, n;
+	uint32 segEnd;
+	uint32 bgLength, fgLength, colorLength, ditherLength, fgbgLength;
+	uint32 literalStart, literalLength;
+	uint32 streak;
+	int order, savings, bestSavings;
+	uint8* src;
+	uint8* start;
+	uint8 bitmask;
+	PIXEL* pixels;
+	PIXEL fgPel;
+	PIXEL diff, fgDiff, fgbgDiff;
+	tbool lastBgRun;
+	tbool firstLine;
+
+	n = width * height;
+
+	if (n == 0)
+		return 0;
+
+	/* scan lines are stored bottom-up */
+	pixels = (PIXEL*) xmalloc(n * sizeof(PIXEL));
+
+	for (y = 0; y < height; y++)
+	{
+		src = srcData + (height - 1 - y) * width * PIXEL_BYTES;
+
+		for (x = 0; x < width; x++)
+		{
+			SRCREADPIXEL(pixels[y * width + x], src);
+			SRCNEXTPIXEL(src);
+		}
+	}
+
+	stream_check_size(s, n * (PIXEL_BYTES + 1) + 16);
+	start = stream_get_tail(s);
+
+	fgPel = WHITE_PIXEL & PIXEL_MASK;
+	lastBgRun = false;
+	firstLine = true;
+	literalStart = 0;
+	literalLength = 0;
+	i = 0;
+
+#define ABOVE(_k) (((_k) >= (uint32) width) ? pixels[(_k) - width] : BLACK_PIXEL)
+
+	while (i < n)
+	{
+		/* the decoder forgets about a preceding background run on its first order past the first line */
+		if (firstLine && i >= (uint32) width)
+		{
+			firstLine = false;
+			lastBgRun = false;
+		}
+
+		/* orders relative to the previous line must not cross the end of the first line */
+		segEnd = (i < (uint32) width) ? width : n;
+
+		/* background run, two of them in a row would insert a foreground pel */
+		bgLength = 0;
+
+		if (!lastBgRun)
+		{
+			for (k = i; k < segEnd && k - i < 0xFFFF && pixels[k] == ABOVE(k); k++);
+			bgLength = k - i;
+		}
+
+		/* foreground run */
+		fgLength = 0;
+		fgDiff = pixels[i] ^ ABOVE(i);
+
+		if (fgDiff != 0)
+		{
+			for (k = i; k < segEnd && k - i < 0xFFFF && (pixels[k] ^ ABOVE(k)) == fgDiff; k++);
+			fgLength = k - i;
+		}
+
+		/* color run */
+		for (k = i; k < n && k - i < 0xFFFF && pixels[k] == pixels[i]; k++);
+		colorLength = k - i;
+
+		/* dithered run, counted in pixel pairs */
+		ditherLength = 0;
+
+		if (i + 1 < n && pixels[i + 1] != pixels[i])
+		{
+			for (k = i; k + 1 < n && (k - i) / 2 < 0xFFFF &&
+				pixels[k] == pixels[i] && pixels[k + 1] == pixels[i + 1]; k += 2);
+			ditherLength = (k - i) / 2;
+		}
+
+		/* foreground/background image, stopping short of long plain runs */
+		fgbgDiff = 0;
+		streak = 0;
+
+		for (k = i; k < segEnd && k - i < 2048; k++)
+		{
+			diff = pixels[k] ^ ABOVE(k);
+
+			if (diff != 0 && fgbgDiff == 0)
+				fgbgDiff = diff;
+			else if (diff != 0 && diff != fgbgDiff)
+				break;
+
+			if (k > i && (diff != 0) == ((pixels[k - 1] ^ ABOVE(k - 1)) != 0))
+				streak++;
+			else
+				streak = 1;
+
+			if (streak >= 16)
+			{
+				k -= streak - 1;
+				break;
+			}
+		}
+
+		fgbgLength = (fgbgDiff != 0) ? k - i : 0;
+
+		/* pick the order saving the most bytes */
+		order = -1;
+		bestSavings = 0;
+
+		if (bgLength > 0)
+		{
+			savings = bgLength * PIXEL_BYTES - RegularOrderSize(bgLength);
+
+			if (savings > bestSavings)
+			{
+				order = REGULAR_BG_RUN;
+				bestSavings = savings;
+			}
+		}
+
+		if (fgLength > 0)
+		{
+			if (fgDiff == fgPel)
+				savings = fgLength * PIXEL_BYTES - RegularOrderSize(fgLength);
+			else
+				savings = fgLength * PIXEL_BYTES - LiteOrderSize(fgLength) - PIXEL_BYTES;
+
+			if (savings > bestSavings)
+			{
+				order = REGULAR_FG_RUN;
+				bestSavings = savings;
+			}
+		}
+
+		if (colorLength > 1)
+		{
+			savings = colorLength * PIXEL_BYTES - RegularOrderSize(colorLength) - PIXEL_BYTES;
+
+			if (savings > bestSavings)
+			{
+				order = REGULAR_COLOR_RUN;
+				bestSavings = savings;
+			}
+		}
+
+		if (ditherLength > 1)
+		{
+			savings = ditherLength * 2 * PIXEL_BYTES - LiteOrderSize(ditherLength) - 2 * PIXEL_BYTES;
+
+			if (savings > bestSavings)
+			{
+				order = LITE_DITHERED_RUN;
+				bestSavings = savings;
+			}
+		}
+
+		if (fgbgLength > 0)
+		{
+			savings = fgbgLength * PIXEL_BYTES - (fgbgLength + 7) / 8;
+
+			if (fgbgDiff == fgPel)
+				savings -= FgBgOrderSize(fgbgLength, false);
+			else
+				savings -= FgBgOrderSize(fgbgLength, true) + PIXEL_BYTES;
+
+			if (savings > bestSavings)
+			{
+				order = REGULAR_FGBG_IMAGE;
+				bestSavings = savings;
+			}
+		}
+
+		if (order < 0)
+		{
+			/* white and black have single byte orders of their own */
+			if (literalLength == 0 && (pixels[i] == (WHITE_PIXEL & PIXEL_MASK) || pixels[i] == BLACK_PIXEL))
+			{
+				stream_write_uint8(s, (pixels[i] == BLACK_PIXEL) ? SPECIAL_BLACK : SPECIAL_WHITE);
+			}
+			else
+			{
+				if (literalLength == 0)
+					literalStart = i;
+
+				literalLength++;
+			}
+
+			lastBgRun = false;
+			i++;
+			continue;
+		}
+
+		if (literalLength > 0)
+		{
+			WRITECOLORIMAGE(s, &pixels[literalStart], literalLength);
+			literalLength = 0;
+		}
+
+		lastBgRun = false;
+
+		switch (order)
+		{
+			case REGULAR_BG_RUN:
+				WriteRegularOrder(s, REGULAR_BG_RUN, MEGA_MEGA_BG_RUN, bgLength);
+				lastBgRun = true;
+				i += bgLength;
+				break;
+
+			case REGULAR_FG_RUN:
+				if (fgDiff == fgPel)
+				{
+					WriteRegularOrder(s, REGULAR_FG_RUN, MEGA_MEGA_FG_RUN, fgLength);
+				}
+				else
+				{
+					WriteLiteOrder(s, LITE_SET_FG_FG_RUN, MEGA_MEGA_SET_FG_RUN, fgLength);
+					STREAMWRITEPIXEL(s, fgDiff);
+					fgPel = fgDiff;
+				}
+				i += fgLength;
+				break;
+
+			case REGULAR_COLOR_RUN:
+				WriteRegularOrder(s, REGULAR_COLOR_RUN, MEGA_MEGA_COLOR_RUN, colorLength);
+				STREAMWRITEPIXEL(s, pixels[i]);
+				i += colorLength;
+				break;
+
+			case LITE_DITHERED_RUN:
+				WriteLiteOrder(s, LITE_DITHERED_RUN, MEGA_MEGA_DITHERED_RUN, ditherLength);
+				STREAMWRITEPIXEL(s, pixels[i]);
+				STREAMWRITEPIXEL(s, pixels[i + 1]);
+				i += ditherLength * 2;
+				break;
+
+			case REGULAR_FGBG_IMAGE:
+				bitmask = 0;
+
+				for (j = 0; j < 8 && j < fgbgLength; j++)
+				{
+					if (pixels[i + j] != ABOVE(i + j))
+						bitmask |= (1 << j);
+				}
+
+				if (fgbgLength == 8 && fgbgDiff == fgPel &&
+					(bitmask == g_MaskSpecialFgBg1 || bitmask == g_MaskSpecialFgBg2))
+				{
+					stream_write_uint8(s, (bitmask == g_MaskSpecialFgBg1) ? SPECIAL_FGBG_1 : SPECIAL_FGBG_2);
+					i += 8;
+					break;
+				}
+
+				if (fgbgDiff == fgPel)
+				{
+					WriteFgBgOrder(s, REGULAR_FGBG_IMAGE, MEGA_MEGA_FGBG_IMAGE, fgbgLength, false);
+				}
+				else
+				{
+					WriteFgBgOrder(s, LITE_SET_FG_FGBG_IMAGE, MEGA_MEGA_SET_FGBG_IMAGE, fgbgLength, true);
+					STREAMWRITEPIXEL(s, fgbgDiff);
+					fgPel = fgbgDiff;
+				}
+
+				for (k = 0; k < fgbgLength; k += 8)
+				{
+					bitmask = 0;
+
+					for (j = 0; j < 8 && k + j < fgbgLength; j++)
+					{
+						if (pixels[i + k + j] != ABOVE(i + k + j))
+							bitmask |= (1 << j);
+					}
+
+					stream_write_uint8(s, bitmask);
+				}
+
+				i += fgbgLength;
+				break;
+		}
+	}
+
+#undef ABOVE
+
+	if (literalLength > 0)
+		WRITECOLORIMAGE(s, &pixels[literalStart], literalLength);
+
+	xfree(pixels);
+
+	return (int) (stream_get_tail(s) - start);
+}
@@ -18,86 +18,58 @@
  */
 
 #include "config.h"
-#include <freerdp/utils/stream.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <freerdp/codec/jpeg.h>
 #include <freerdp/utils/memory.h>
-#include <freerdp/codec/color.h>
+#include <freerdp/utils/thread_pool.h>
+
+typedef struct _JPEG_DECODER JPEG_DECODER;
+typedef struct _JPEG_ENCODER JPEG_ENCODER;
 
 #if defined(WITH_TJPEG)
 
 #include <turbojpeg.h>
 
-/**
- * Decompress specified image in buffer
- *
- * @return 0 on success, -1 on error
- *****************************************************************************/
-
-static int
-do_decompress(unsigned char* comp_data, int comp_data_bytes,
-              int* width, int* height, int bpp,
-              unsigned char* decomp_data, int format)
+struct _JPEG_DECODER
 {
 	tjhandle handle;
-	int       lwidth;
-	int       lheight;
-	int       jpeg_sub_samp;
-	int       rv;
-
-	/* init decompression engine */
-	handle = tjInitDecompress();
-
-	/* get info about jpeg image */
-	rv = tjDecompressHeader2(
-				handle,
-				comp_data,
-				comp_data_bytes,
-				&lwidth,
-				&lheight,
-				&jpeg_sub_samp
-				);
-
-	if (rv)
-	{
-		tjDestroy(handle);
-		return rv;
-	}
-
-	/* decompress image */
-	rv = tjDecompress2(
-			   handle,
-			   comp_data,          /* buffer containing JPEG image to decompress */
-			   comp_data_bytes,    /* size of JPEG image in bytes */
-			   decomp_data,        /* destination buffer for decompressed data */
-			   lwidth,             /* image width */
-			   lwidth * (bpp / 8), /* pitch */
-			   lheight,            /* height of image */
-			   format,             /* pixel format TJPF_RGB, TJPF_XBGR */
-			   0                   /* bitwise OR of one or more flags */
-			  );
-
-	*width = lwidth;
-	*height = lheight;
-
-	/* deinit decompression engine */
-	tjDestroy(handle);
+};
 
-	return rv;
+static JPEG_DECODER* jpeg_decoder_new(void)
+{
+	JPEG_DECODER* decoder;
+
+	decoder = xnew(JPEG_DECODER);
+	decoder->handle = tjInitDecompress();
+
+	if (decoder->handle == NULL)
+	{
+		xfree(decoder);
+		return NULL;
+	}
+
+	return decoder;
 }
 
-/**
- * Decompress image data in buffer
- *
- * @return 1 on success, 0 on failure
- *****************************************************************************/
+static void jpeg_decoder_free(JPEG_DECODER* decoder)
+{
+	tjDestroy(decoder->handle);
+	xfree(decoder);
+}
 
-tbool
-jpeg_decompress(uint8 * input, uint8 * output, int width, int height, int size, int bpp)
+static boolean jpeg_decoder_decompress(JPEG_CONTEXT* context, JPEG_DECODER* decoder, JPEG_JOB* job)
 {
-	int lwidth  = 0;
-	int lheight = 0;
+	int lwidth;
+	int lheight;
+	int jpeg_sub_samp;
 	int format;
+	int flags;
+	int pitch;
+	uint8* output;
 
-	switch (bpp)
+	switch (job->bpp)
 	{
 		case 24:
 			format = TJPF_RGB;
@@ -106,148 +78,780 @@ jpeg_decompress(uint8 * input, uint8 * output, int width, int height, int size,
 			format = TJPF_BGRX;
 			break;
 		default:
-			return 0;
+			return false;
+	}
+
+	if (tjDecompressHeader2(decoder->handle, job->input, job->size, &lwidth, &lheight, &jpeg_sub_samp) != 0)
+		return false;
+
+	if (lwidth != job->width || lheight != job->height)
+		return false;
+
+	flags = 0;
+
+	if (context->fast_idct)
+		flags |= TJFLAG_FASTDCT;
+
+	if (!context->fancy_upsampling)
+		flags |= TJFLAG_FASTUPSAMPLE;
+
+	output = job->output;
+	pitch = job->stride;
+
+	if (pitch < 0)
+	{
+		flags |= TJFLAG_BOTTOMUP;
+		output += (job->height - 1) * pitch;
+		pitch = -pitch;
 	}
-	if (do_decompress((unsigned char *)input, size,
-			&lwidth, &lheight, bpp,
-			(unsigned char *) output, format) < 0)
+
+	return tjDecompress2(decoder->handle, job->input, job->size, output,
+		job->width, pitch, job->height, format, flags) == 0;
+}
+
+struct _JPEG_ENCODER
+{
+	tjhandle handle;
+};
+
+static JPEG_ENCODER* jpeg_encoder_new(void)
+{
+	JPEG_ENCODER* encoder;
+
+	encoder = xnew(JPEG_ENCODER);
+	encoder->handle = tjInitCompress();
+
+	if (encoder->handle == NULL)
 	{
-		return 0;
+		xfree(encoder);
+		return NULL;
 	}
-	if (lwidth != width || lheight != height)
+
+	return encoder;
+}
+
+static void jpeg_encoder_free(JPEG_ENCODER* encoder)
+{
+	tjDestroy(encoder->handle);
+	xfree(encoder);
+}
+
+/**
+ * Compress into the stream directly, it is grown to the worst case size first.
+ */
+static boolean jpeg_encoder_compress(JPEG_CONTEXT* context, JPEG_ENCODER* encoder, STREAM* s,
+	uint8* data, int width, int height, int rowstride)
+{
+	int flags;
+	unsigned char* output;
+	unsigned long size;
+
+	size = tjBufSize(width, height, TJSAMP_420);
+	stream_check_size(s, (int) size);
+	output = stream_get_tail(s);
+
+	flags = TJFLAG_NOREALLOC;
+
+	if (context->fast_idct)
+		flags |= TJFLAG_FASTDCT;
+
+	if (rowstride < 0)
 	{
-		return 0;
+		flags |= TJFLAG_BOTTOMUP;
+		data += (height - 1) * rowstride;
+		rowstride = -rowstride;
 	}
-	return 1;
+
+	if (tjCompress2(encoder->handle, data, width, rowstride, height, TJPF_BGRX,
+		&output, &size, TJSAMP_420, context->quality, flags) != 0)
+		return false;
+
+	stream_seek(s, (int) size);
+
+	return true;
 }
 
 #elif defined(WITH_JPEG)
 
+#include <setjmp.h>
 //#define HAVE_BOOLEAN
 #include <jpeglib.h>
 
-struct mydata_decomp
+struct _JPEG_DECODER
 {
-	char* data;
-	int data_bytes;
+	struct jpeg_decompress_struct cinfo;
+	struct jpeg_error_mgr jerr;
+	struct jpeg_source_mgr src_mgr;
+	jmp_buf jmp;
+
+	/* output row pointers */
+	JSAMPROW* rows;
+	int max_rows;
+
+	/* RGB row for 32bpp output without the libjpeg-turbo colour spaces */
+	uint8* row_buf;
+	int row_buf_length;
 };
 
 /*****************************************************************************/
-static void my_init_source(j_decompress_ptr cinfo)
+static void decoder_error_exit(j_common_ptr cinfo)
 {
+	JPEG_DECODER* decoder = (JPEG_DECODER*) cinfo->client_data;
+
+	longjmp(decoder->jmp, 1);
 }
 
 /*****************************************************************************/
-static tbool my_fill_input_buffer(j_decompress_ptr cinfo)
+static void decoder_output_message(j_common_ptr cinfo)
 {
-	struct mydata_decomp* md;
+	char buffer[JMSG_LENGTH_MAX];
 
-	md = (struct mydata_decomp*)(cinfo->client_data);
-	cinfo->src->next_input_byte = (unsigned char*)(md->data);
-	cinfo->src->bytes_in_buffer = md->data_bytes;
-	return 1;
+	cinfo->err->format_message(cinfo, buffer);
+	printf("jpeg_decompress: %s\n", buffer);
 }
 
 /*****************************************************************************/
-static void my_skip_input_data(j_decompress_ptr cinfo, long num_bytes)
+static void decoder_init_source(j_decompress_ptr cinfo)
 {
 }
 
 /*****************************************************************************/
-static tbool my_resync_to_restart(j_decompress_ptr cinfo, int desired)
+static tbool decoder_fill_input_buffer(j_decompress_ptr cinfo)
 {
+	static const JOCTET eoi[2] = { 0xFF, JPEG_EOI };
+
+	/* the whole image is in memory, end truncated data with a fake EOI marker */
+	cinfo->src->next_input_byte = eoi;
+	cinfo->src->bytes_in_buffer = 2;
 	return 1;
 }
 
 /*****************************************************************************/
-static void my_term_source(j_decompress_ptr cinfo)
+static void decoder_skip_input_data(j_decompress_ptr cinfo, long num_bytes)
 {
+	if (num_bytes <= 0)
+		return;
+
+	if ((size_t) num_bytes > cinfo->src->bytes_in_buffer)
+	{
+		decoder_fill_input_buffer(cinfo);
+		return;
+	}
+
+	cinfo->src->next_input_byte += num_bytes;
+	cinfo->src->bytes_in_buffer -= num_bytes;
 }
 
 /*****************************************************************************/
-static int
-do_decompress(char* comp_data, int comp_data_bytes,
-              int* width, int* height, int* bpp,
-              char* decomp_data, int* decomp_data_bytes)
+static void decoder_term_source(j_decompress_ptr cinfo)
 {
-	struct jpeg_decompress_struct cinfo;
+}
+
+static JPEG_DECODER* jpeg_decoder_new(void)
+{
+	JPEG_DECODER* decoder;
+
+	decoder = xnew(JPEG_DECODER);
+
+	decoder->cinfo.err = jpeg_std_error(&decoder->jerr);
+	decoder->jerr.error_exit = decoder_error_exit;
+	decoder->jerr.output_message = decoder_output_message;
+	decoder->cinfo.client_data = decoder;
+
+	if (setjmp(decoder->jmp))
+	{
+		xfree(decoder);
+		return NULL;
+	}
+
+	jpeg_create_decompress(&decoder->cinfo);
+
+	decoder->src_mgr.init_source = decoder_init_source;
+	decoder->src_mgr.fill_input_buffer = decoder_fill_input_buffer;
+	decoder->src_mgr.skip_input_data = decoder_skip_input_data;
+	decoder->src_mgr.resync_to_restart = jpeg_resync_to_restart;
+	decoder->src_mgr.term_source = decoder_term_source;
+	decoder->cinfo.src = &decoder->src_mgr;
+
+	return decoder;
+}
+
+static void jpeg_decoder_free(JPEG_DECODER* decoder)
+{
+	jpeg_destroy_decompress(&decoder->cinfo);
+	xfree(decoder->rows);
+	xfree(decoder->row_buf);
+	xfree(decoder);
+}
+
+/**
+ * Decode straight into the output rows. The decompress object is only
+ * reset between images, which keeps its allocations and tables around.
+ */
+static boolean jpeg_decoder_decompress(JPEG_CONTEXT* context, JPEG_DECODER* decoder, JPEG_JOB* job)
+{
+	int i, n;
+	uint8* src;
+	uint8* dst;
+	boolean expand;
+	struct jpeg_decompress_struct* cinfo = &decoder->cinfo;
+
+	if (job->bpp != 24 && job->bpp != 32)
+		return false;
+
+	if (setjmp(decoder->jmp))
+	{
+		jpeg_abort_decompress(cinfo);
+		return false;
+	}
+
+	decoder->src_mgr.next_input_byte = job->input;
+	decoder->src_mgr.bytes_in_buffer = job->size;
+
+	if (jpeg_read_header(cinfo, TRUE) != JPEG_HEADER_OK)
+	{
+		jpeg_abort_decompress(cinfo);
+		return false;
+	}
+
+	if ((int) cinfo->image_width != job->width || (int) cinfo->image_height != job->height)
+	{
+		jpeg_abort_decompress(cinfo);
+		return false;
+	}
+
+	expand = false;
+	cinfo->out_color_space = JCS_RGB;
+#ifdef JCS_EXTENSIONS
+	if (job->bpp == 32)
+		cinfo->out_color_space = JCS_EXT_BGRX;
+#else
+	expand = (job->bpp == 32);
+#endif
+	cinfo->dct_method = context->fast_idct ? JDCT_IFAST : JDCT_ISLOW;
+	cinfo->do_fancy_upsampling = context->fancy_upsampling ? TRUE : FALSE;
+
+	jpeg_start_decompress(cinfo);
+
+	if (expand)
+	{
+		if (decoder->row_buf_length < job->width * 3)
+		{
+			xfree(decoder->row_buf);
+			decoder->row_buf_length = job->width * 3;
+			decoder->row_buf = (uint8*) xmalloc(decoder->row_buf_length);
+		}
+
+		while (cinfo->output_scanline < cinfo->output_height)
+		{
+			dst = job->output + cinfo->output_scanline * job->stride;
+			src = decoder->row_buf;
+			jpeg_read_scanlines(cinfo, (JSAMPROW*) &src, 1);
+
+			for (i = 0; i < job->width; i++)
+			{
+				*dst++ = src[2];
+				*dst++ = src[1];
+				*dst++ = src[0];
+				*dst++ = 0xFF;
+				src += 3;
+			}
+		}
+	}
+	else
+	{
+		if (decoder->max_rows < job->height)
+		{
+			xfree(decoder->rows);
+			decoder->max_rows = job->height;
+			decoder->rows = (JSAMPROW*) xmalloc(decoder->max_rows * sizeof(JSAMPROW));
+		}
+
+		for (i = 0; i < job->height; i++)
+			decoder->rows[i] = (JSAMPROW) (job->output + i * job->stride);
+
+		while (cinfo->output_scanline < cinfo->output_height)
+		{
+			n = cinfo->output_scanline;
+			jpeg_read_scanlines(cinfo, &decoder->rows[n], cinfo->output_height - n);
+		}
+	}
+
+	jpeg_finish_decompress(cinfo);
+
+	return true;
+}
+
+struct _JPEG_ENCODER
+{
+	struct jpeg_compress_struct cinfo;
 	struct jpeg_error_mgr jerr;
-	struct jpeg_source_mgr src_mgr;
-	struct mydata_decomp md;
-	JSAMPROW row_pointer[1];
+	struct jpeg_destination_mgr dest_mgr;
+	jmp_buf jmp;
+	STREAM* s;
+
+	/* input row pointers */
+	JSAMPROW* rows;
+	int max_rows;
+
+	/* RGB row for 32bpp input without the libjpeg-turbo colour spaces */
+	uint8* row_buf;
+	int row_buf_length;
+};
+
+/*****************************************************************************/
+static void encoder_error_exit(j_common_ptr cinfo)
+{
+	JPEG_ENCODER* encoder = (JPEG_ENCODER*) cinfo->client_data;
+
+	longjmp(encoder->jmp, 1);
+}
+
+/*****************************************************************************/
+static void encoder_init_destination(j_compress_ptr cinfo)
+{
+	JPEG_ENCODER* encoder = (JPEG_ENCODER*) cinfo->client_data;
 
-	memset(&cinfo, 0, sizeof(cinfo));
-	cinfo.err = jpeg_std_error(&jerr);
-	jpeg_create_decompress(&cinfo);
+	stream_check_size(encoder->s, 4096);
+	cinfo->dest->next_output_byte = stream_get_tail(encoder->s);
+	cinfo->dest->free_in_buffer = stream_get_left(encoder->s);
+}
 
-	memset(&src_mgr, 0, sizeof(src_mgr));
-	cinfo.src = &src_mgr;
-	src_mgr.init_source = my_init_source;
-	src_mgr.fill_input_buffer = my_fill_input_buffer;
-	src_mgr.skip_input_data = my_skip_input_data;
-	src_mgr.resync_to_restart = my_resync_to_restart;
-	src_mgr.term_source = my_term_source;
+/*****************************************************************************/
+static tbool encoder_empty_output_buffer(j_compress_ptr cinfo)
+{
+	JPEG_ENCODER* encoder = (JPEG_ENCODER*) cinfo->client_data;
 
-	memset(&md, 0, sizeof(md));
-	md.data = comp_data;
-	md.data_bytes = comp_data_bytes;
-	cinfo.client_data = &md;
+	/* the whole buffer is full, grow the stream past it */
+	stream_set_pos(encoder->s, stream_get_size(encoder->s));
+	stream_check_size(encoder->s, stream_get_size(encoder->s));
+	cinfo->dest->next_output_byte = stream_get_tail(encoder->s);
+	cinfo->dest->free_in_buffer = stream_get_left(encoder->s);
+	return 1;
+}
 
-	jpeg_read_header(&cinfo, 1);
+/*****************************************************************************/
+static void encoder_term_destination(j_compress_ptr cinfo)
+{
+	JPEG_ENCODER* encoder = (JPEG_ENCODER*) cinfo->client_data;
+
+	stream_set_mark(encoder->s, (uint8*) cinfo->dest->next_output_byte);
+}
 
-	cinfo.out_color_space = JCS_RGB;
+static JPEG_ENCODER* jpeg_encoder_new(void)
+{
+	JPEG_ENCODER* encoder;
 
-	*width = cinfo.image_width;
-	*height = cinfo.image_height;
-	*bpp = cinfo.num_components * 8;
+	encoder = xnew(JPEG_ENCODER);
 
-	jpeg_start_decompress(&cinfo);
+	encoder->cinfo.err = jpeg_std_error(&encoder->jerr);
+	encoder->jerr.error_exit = encoder_error_exit;
+	encoder->jerr.output_message = decoder_output_message;
+	encoder->cinfo.client_data = encoder;
 
-	while(cinfo.output_scanline < cinfo.image_height)
+	if (setjmp(encoder->jmp))
 	{
-		row_pointer[0] = (JSAMPROW) decomp_data;
-		jpeg_read_scanlines(&cinfo, row_pointer, 1);
-		decomp_data += cinfo.image_width * cinfo.num_components;
+		xfree(encoder);
+		return NULL;
 	}
-	*decomp_data_bytes = cinfo.output_width *
-			cinfo.output_height * cinfo.num_components;
-	jpeg_finish_decompress(&cinfo);
-	jpeg_destroy_decompress(&cinfo);
-	return 0;
+
+	jpeg_create_compress(&encoder->cinfo);
+
+	encoder->dest_mgr.init_destination = encoder_init_destination;
+	encoder->dest_mgr.empty_output_buffer = encoder_empty_output_buffer;
+	encoder->dest_mgr.term_destination = encoder_term_destination;
+	encoder->cinfo.dest = &encoder->dest_mgr;
+
+	return encoder;
 }
 
-/* jpeg decompress */
-tbool
-jpeg_decompress(uint8 * input, uint8 * output, int width, int height, int size, int bpp)
+static void jpeg_encoder_free(JPEG_ENCODER* encoder)
 {
-	int lwidth;
-	int lheight;
-	int lbpp;
-	int ldecomp_data_bytes;
+	jpeg_destroy_compress(&encoder->cinfo);
+	xfree(encoder->rows);
+	xfree(encoder->row_buf);
+	xfree(encoder);
+}
+
+/**
+ * Compress BGRX rows in place, into the stream. Full tables are written
+ * with every image since the client decodes each on its own.
+ */
+static boolean jpeg_encoder_compress(JPEG_CONTEXT* context, JPEG_ENCODER* encoder, STREAM* s,
+	uint8* data, int width, int height, int rowstride)
+{
+	int i, n;
+	uint8* src;
+	uint8* dst;
+	boolean contract;
+	struct jpeg_compress_struct* cinfo = &encoder->cinfo;
 
-	if (bpp != 24)
+	if (setjmp(encoder->jmp))
 	{
-		return 0;
+		jpeg_abort_compress(cinfo);
+		return false;
 	}
-	if (do_decompress((char*)input, size,
-			&lwidth, &lheight, &lbpp,
-			(char*)output, &ldecomp_data_bytes) != 0)
+
+	encoder->s = s;
+	cinfo->image_width = width;
+	cinfo->image_height = height;
+#ifdef JCS_EXTENSIONS
+	contract = false;
+	cinfo->input_components = 4;
+	cinfo->in_color_space = JCS_EXT_BGRX;
+#else
+	contract = true;
+	cinfo->input_components = 3;
+	cinfo->in_color_space = JCS_RGB;
+#endif
+
+	jpeg_set_defaults(cinfo);
+	jpeg_set_quality(cinfo, context->quality, TRUE);
+	cinfo->dct_method = context->fast_idct ? JDCT_IFAST : JDCT_ISLOW;
+
+	jpeg_start_compress(cinfo, TRUE);
+
+	if (contract)
 	{
-		return 0;
+		if (encoder->row_buf_length < width * 3)
+		{
+			xfree(encoder->row_buf);
+			encoder->row_buf_length = width * 3;
+			encoder->row_buf = (uint8*) xmalloc(encoder->row_buf_length);
+		}
+
+		while (cinfo->next_scanline < cinfo->image_height)
+		{
+			src = data + cinfo->next_scanline * rowstride;
+			dst = encoder->row_buf;
+
+			for (i = 0; i < width; i++)
+			{
+				*dst++ = src[2];
+				*dst++ = src[1];
+				*dst++ = src[0];
+				src += 4;
+			}
+
+			dst = encoder->row_buf;
+			jpeg_write_scanlines(cinfo, (JSAMPROW*) &dst, 1);
+		}
 	}
-	if (lwidth != width || lheight != height || lbpp != bpp)
+	else
 	{
-		return 0;
+		if (encoder->max_rows < height)
+		{
+			xfree(encoder->rows);
+			encoder->max_rows = height;
+			encoder->rows = (JSAMPROW*) xmalloc(encoder->max_rows * sizeof(JSAMPROW));
+		}
+
+		for (i = 0; i < height; i++)
+			encoder->rows[i] = (JSAMPROW) (data + i * rowstride);
+
+		while (cinfo->next_scanline < cinfo->image_height)
+		{
+			n = cinfo->next_scanline;
+			jpeg_write_scanlines(cinfo, &encoder->rows[n], cinfo->image_height - n);
+		}
 	}
-	return 1;
+
+	jpeg_finish_compress(cinfo);
+
+	return true;
 }
 
 #else
 
-tbool
-jpeg_decompress(uint8 * input, uint8 * output, int width, int height, int size, int bpp)
+struct _JPEG_DECODER
+{
+	int unused;
+};
+
+struct _JPEG_ENCODER
+{
+	int unused;
+};
+
+static JPEG_DECODER* jpeg_decoder_new(void)
+{
+	return NULL;
+}
+
+static void jpeg_decoder_free(JPEG_DECODER* decoder)
+{
+}
+
+static boolean jpeg_decoder_decompress(JPEG_CONTEXT* context, JPEG_DECODER* decoder, JPEG_JOB* job)
+{
+	return false;
+}
+
+static JPEG_ENCODER* jpeg_encoder_new(void)
+{
+	return NULL;
+}
+
+static void jpeg_encoder_free(JPEG_ENCODER* encoder)
+{
+}
+
+static boolean jpeg_encoder_compress(JPEG_CONTEXT* context, JPEG_ENCODER* encoder, STREAM* s,
+	uint8* data, int width, int height, int rowstride)
 {
-	return 0;
+	return false;
 }
 
 #endif
+
+struct _JPEG_CONTEXT_PRIV
+{
+	freerdp_thread_pool* thread_pool;
+
+	/* one decoder per pool thread plus one for the calling thread, created on first use */
+	JPEG_DECODER** decoders;
+	int num_decoders;
+
+	JPEG_JOB* jobs;
+
+	/* created on first use */
+	JPEG_ENCODER* encoder;
+};
+typedef struct _JPEG_CONTEXT_PRIV JPEG_CONTEXT_PRIV;
+
+static boolean jpeg_context_run_job(JPEG_CONTEXT* context, int worker, JPEG_JOB* job)
+{
+	JPEG_CONTEXT_PRIV* priv = (JPEG_CONTEXT_PRIV*) context->priv;
+
+	if (priv->decoders[worker] == NULL)
+		priv->decoders[worker] = jpeg_decoder_new();
+
+	if (priv->decoders[worker] == NULL)
+		return false;
+
+	return jpeg_decoder_decompress(context, priv->decoders[worker], job);
+}
+
+static void jpeg_context_run_job_threaded(void* arg, int worker, int index)
+{
+	JPEG_CONTEXT* context = (JPEG_CONTEXT*) arg;
+	JPEG_CONTEXT_PRIV* priv = (JPEG_CONTEXT_PRIV*) context->priv;
+
+	priv->jobs[index].success = jpeg_context_run_job(context, worker, &priv->jobs[index]);
+}
+
+JPEG_CONTEXT* jpeg_context_new(void)
+{
+	JPEG_CONTEXT* context;
+
+	context = xnew(JPEG_CONTEXT);
+	context->priv = xnew(JPEG_CONTEXT_PRIV);
+
+	/* libjpeg defaults */
+	context->fast_idct = false;
+	context->fancy_upsampling = true;
+	context->quality = 75;
+
+	jpeg_context_set_thread_count(context, 0);
+
+	return context;
+}
+
+void jpeg_context_free(JPEG_CONTEXT* context)
+{
+	int i;
+	JPEG_CONTEXT_PRIV* priv;
+
+	if (context == NULL)
+		return;
+
+	priv = (JPEG_CONTEXT_PRIV*) context->priv;
+
+	if (priv->thread_pool != NULL)
+		freerdp_thread_pool_free(priv->thread_pool);
+
+	for (i = 0; i < priv->num_decoders; i++)
+	{
+		if (priv->decoders[i] != NULL)
+			jpeg_decoder_free(priv->decoders[i]);
+	}
+
+	xfree(priv->decoders);
+
+	if (priv->encoder != NULL)
+		jpeg_encoder_free(priv->encoder);
+
+	xfree(priv);
+	xfree(context);
+}
+
+/**
+ * Use the faster, slightly less accurate integer DCT, when decoding and encoding.
+ */
+void jpeg_context_set_fast_idct(JPEG_CONTEXT* context, boolean enabled)
+{
+	context->fast_idct = enabled;
+}
+
+/**
+ * Interpolate subsampled chroma rather than replicating it.
+ */
+void jpeg_context_set_fancy_upsampling(JPEG_CONTEXT* context, boolean enabled)
+{
+	context->fancy_upsampling = enabled;
+}
+
+/**
+ * Quality used by jpeg_compose_message(), from 1 to 100.
+ */
+void jpeg_context_set_quality(JPEG_CONTEXT* context, int quality)
+{
+	if (quality < 1)
+		quality = 1;
+	else if (quality > 100)
+		quality = 100;
+
+	context->quality = quality;
+}
+
+/**
+ * Decode the images of jpeg_context_decompress_jobs() on count threads. The
+ * calling thread is one of them, so count - 1 worker threads are started.
+ * A count of 0 or 1 decodes on the calling thread only.
+ */
+void jpeg_context_set_thread_count(JPEG_CONTEXT* context, int count)
+{
+	int i;
+	JPEG_CONTEXT_PRIV* priv = (JPEG_CONTEXT_PRIV*) context->priv;
+
+	if (priv->thread_pool != NULL)
+	{
+		freerdp_thread_pool_free(priv->thread_pool);
+		priv->thread_pool = NULL;
+	}
+
+	for (i = 0; i < priv->num_decoders; i++)
+	{
+		if (priv->decoders[i] != NULL)
+			jpeg_decoder_free(priv->decoders[i]);
+	}
+
+	xfree(priv->decoders);
+
+	if (count < 2)
+	{
+		priv->num_decoders = 1;
+	}
+	else
+	{
+		priv->thread_pool = freerdp_thread_pool_new(count - 1);
+		priv->num_decoders = freerdp_thread_pool_get_size(priv->thread_pool) + 1;
+	}
+
+	priv->decoders = xnew0(JPEG_DECODER*, priv->num_decoders);
+}
+
+/**
+ * Decode a width x height JPEG image to 24bpp RGB or 32bpp BGRX rows,
+ * stride bytes apart. Fails if the image has a different size.
+ */
+boolean jpeg_context_decompress(JPEG_CONTEXT* context, uint8* input, int size,
+	uint8* output, int stride, int width, int height, int bpp)
+{
+	JPEG_JOB job;
+	JPEG_CONTEXT_PRIV* priv = (JPEG_CONTEXT_PRIV*) context->priv;
+
+	job.input = input;
+	job.size = size;
+	job.output = output;
+	job.stride = stride;
+	job.width = width;
+	job.height = height;
+	job.bpp = bpp;
+
+	return jpeg_context_run_job(context, priv->num_decoders - 1, &job);
+}
+
+/**
+ * Decode several images at once, such as the JPEG surface commands of a
+ * frame, spread over the context threads. Each job gets its success flag
+ * set, and the number of images decoded is returned.
+ */
+int jpeg_context_decompress_jobs(JPEG_CONTEXT* context, JPEG_JOB* jobs, int count)
+{
+	int i;
+	int decoded;
+	JPEG_CONTEXT_PRIV* priv = (JPEG_CONTEXT_PRIV*) context->priv;
+
+	if (priv->thread_pool != NULL && count > 1)
+	{
+		priv->jobs = jobs;
+		freerdp_thread_pool_run(priv->thread_pool, jpeg_context_run_job_threaded, context, count);
+		priv->jobs = NULL;
+	}
+	else
+	{
+		for (i = 0; i < count; i++)
+			jobs[i].success = jpeg_context_run_job(context, priv->num_decoders - 1, &jobs[i]);
+	}
+
+	for (i = 0, decoded = 0; i < count; i++)
+	{
+		if (jobs[i].success)
+			decoded++;
+	}
+
+	return decoded;
+}
+
+/**
+ * Compress width x height BGRX pixels, rowstride bytes apart, into a JPEG
+ * surface bits payload: a uint16 header length, which is always 0, then
+ * the JPEG image. Nothing is written to the stream on failure.
+ */
+boolean jpeg_compose_message(JPEG_CONTEXT* context, STREAM* s,
+	uint8* data, int width, int height, int rowstride)
+{
+	int pos;
+	JPEG_CONTEXT_PRIV* priv = (JPEG_CONTEXT_PRIV*) context->priv;
+
+	if (width <= 0 || height <= 0)
+		return false;
+
+	if (priv->encoder == NULL)
+		priv->encoder = jpeg_encoder_new();
+
+	if (priv->encoder == NULL)
+		return false;
+
+	stream_check_size(s, 2);
+	pos = stream_get_pos(s);
+	stream_write_uint16(s, 0); /* header_bytes */
+
+	if (!jpeg_encoder_compress(context, priv->encoder, s, data, width, height, rowstride))
+	{
+		stream_set_pos(s, pos);
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Decompress image data in buffer, with a decoder of its own
+ *
+ * @return 1 on success, 0 on failure
+ *****************************************************************************/
+
+boolean
+jpeg_decompress(uint8* input, uint8* output, int width, int height, int size, int bpp)
+{
+	boolean rv;
+	JPEG_CONTEXT* context;
+
+	context = jpeg_context_new();
+	rv = jpeg_context_decompress(context, input, size, output, width * (bpp / 8), width, height, bpp);
+	jpeg_context_free(context);
+
+	return rv;
+}
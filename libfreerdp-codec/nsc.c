@@ -23,358 +23,339 @@
 #include <stdint.h>
 #include <freerdp/codec/nsc.h>
 #include <freerdp/utils/memory.h>
+#include <freerdp/utils/cpu.h>
+#include <freerdp/constants.h>
 
-/* we store the 9th bits at the end of stream as bitstream */
-void nsc_cl_expand(STREAM* stream, uint8 shiftcount, uint32 origsz)
-{
-	uint8* sbitstream;
-	uint8* temptr;
-	uint8 sign,bitoff;
-	uint32 bitno;
-	sbitstream = stream->data + origsz;
+#include "nsc_types.h"
+#include "nsc_encode.h"
 
-	do
-	{
-		sign = (*(stream->p) << (shiftcount - 1)) & 0x80;
-		bitno = stream->p - stream->data;
-		*(stream->p++) <<= shiftcount;
-		temptr = sbitstream + ((bitno) >> 3);
-		bitoff = bitno % 0x8; 
-		(*temptr) |= (sign >> bitoff);
-	}
-	while (((uint32)(stream->p - stream->data)) < origsz);
+#ifdef WITH_SSE2
+#include "nsc_sse2.h"
+#endif
 
-	stream->p = stream->data;
-}
+#ifndef NSC_INIT_SIMD
+#define NSC_INIT_SIMD(_nsc_context) do { } while (0)
+#endif
 
-void nsc_chroma_supersample(NSC_CONTEXT* context)
-{
-	int i;
-	uint8* cur;
-	uint8* tptr;
-	uint8* nbitstream;
-	uint8* sbitstream;
-	uint8 val, bitoff, sign;
-	uint16 w, h, pw, row;
-	uint32 alloclen, orglen, bytno;
-	STREAM* new_s;
-	STREAM* temp;
-
-	w = context->width;
-	h = context->height;
-	alloclen = orglen = w * h;
-	pw = ROUND_UP_TO(context->width, 8);
-	temp = stream_new(0);
-
-	for (i = 0; i < 3; i++)
-	{
-		if (i != 0)
-			alloclen = orglen + ((orglen & 0x7) ? (orglen >> 3) + 0x1 : (orglen >> 3));
+#define NSC_CLAMP(_v) (((_v) < 0) ? 0 : (((_v) > 0xFF) ? 0xFF : (_v)))
 
-		new_s = stream_new(alloclen);
-		stream_attach(temp, context->org_buf[i]->data, context->org_buf[i]->size);
+/**
+ * Convert all planes to BGRA in a single pass. Subsampled chroma is read
+ * at half resolution, which supersamples it to the luma grid, and the
+ * colour loss is undone by shifting each chroma sample back in place.
+ * See [MS-RDPNSC] 3.1.8.
+ */
+static void nsc_decode(NSC_CONTEXT* context)
+{
+	int x, y;
+	int css, shift;
+	int y_stride, c_stride;
+	const uint8* yplane;
+	const uint8* coplane;
+	const uint8* cgplane;
+	const uint8* aplane;
+	uint8* bmp;
+	sint16 y_val, co_val, cg_val;
+	sint16 r_val, g_val, b_val;
 
-		sbitstream = temp->data + context->OrgByteCount[i];
-		nbitstream = new_s->data + orglen;
-		cur  = new_s->p;
+	css = (context->nsc_stream->ChromaSubSamplingLevel != 0) ? 1 : 0;
+	shift = context->nsc_stream->colorLossLevel - 1;
+	y_stride = css ? ROUND_UP_TO(context->width, 8) : context->width;
+	c_stride = css ? y_stride / 2 : context->width;
+	bmp = context->bmpdata;
 
-		if (i == 1)
-			pw >>= 1;
+	for (y = 0; y < context->height; y++)
+	{
+		yplane = context->planes[0] + y * y_stride;
+		coplane = context->planes[1] + (y >> css) * c_stride;
+		cgplane = context->planes[2] + (y >> css) * c_stride;
+		aplane = (context->planes[3] != NULL) ? context->planes[3] + y * context->width : NULL;
 
-		while (((uint32)(temp->p - temp->data)) < context->OrgByteCount[i])
+		for (x = 0; x < context->width; x++)
 		{
-			bytno = temp->p - temp->data;
-			bitoff = bytno % 0x8; 
-			stream_read_uint8(temp, val);
-			*cur = val;
-			row = (temp->p - temp->data) % pw;
-
-			if (i == 0)
-			{
-				cur++;
-				if (row >= w)
-					stream_seek(temp, pw-row);
-			}
-			else
-			{
-				tptr = sbitstream + ((bytno) >> 3);
-				sign = ((*tptr) << bitoff) & 0x80;
-				bytno = cur - new_s->data;
-				bitoff = bytno % 8;
-				*(nbitstream + (bytno >> 3)) |= (sign >> bitoff);
-
-				if ((bytno+w) < orglen)
-				{
-					*(cur + w) = val;
-					bitoff = (bytno + w) % 8;
-					*(nbitstream + ((bytno + w) >> 3)) |= (sign >> bitoff);
-				}
-
-				if ((bytno+1) % w)
-				{
-					*(cur+1) = val;
-					bitoff = (bytno + 1) % 8;
-					*(nbitstream + ((bytno + 1) >> 3)) |= (sign >> bitoff);
-					if ((bytno+w) < orglen)
-					{
-						*(cur+w+1) = val;
-						bitoff = (bytno + w + 1) % 8;
-						*(nbitstream + ((bytno + w + 1) >> 3)) |= (sign >> bitoff);
-					}
-				}
-
-				cur += 2;
-				bytno = cur - new_s->data;
-
-				if (((bytno/w) < h) && ((bytno) % w) < 2 )
-				{
-					if (w % 2)
-						cur += w-1;
-					else
-						cur += w;
-				}
-
-				if ((row*2) >= w)
-					stream_seek(temp, pw-row);
-			}
+			y_val = yplane[x];
+			co_val = (sint8) (coplane[x >> css] << shift);
+			cg_val = (sint8) (cgplane[x >> css] << shift);
+
+			r_val = y_val + co_val - cg_val;
+			g_val = y_val + cg_val;
+			b_val = y_val - co_val - cg_val;
+
+			*bmp++ = NSC_CLAMP(b_val);
+			*bmp++ = NSC_CLAMP(g_val);
+			*bmp++ = NSC_CLAMP(r_val);
+			*bmp++ = (aplane != NULL) ? aplane[x] : 0xFF;
 		}
-
-		xfree(temp->data);
-		stream_detach(temp);
-		stream_attach(context->org_buf[i], new_s->data, new_s->size);
-		context->OrgByteCount[i] = orglen;
 	}
 }
 
-void nsc_ycocg_rgb(NSC_CONTEXT* context)
+/**
+ * Run length decoding, see [MS-RDPNSC] 3.1.8.1. The last four bytes of a
+ * plane are always stored raw.
+ */
+static boolean nsc_rle_decode(const uint8* in, uint32 in_length, uint8* out, uint32 origsz)
 {
-	uint8* sbitstream[2];
-	uint8 bitoff, sign[2], i, val, tmp;
-	sint16 rgb[3], ycocg[3];
-	uint32 bytno, size;
-	size = context->OrgByteCount[0];
+	uint32 i;
+	uint32 len;
+	uint8 value;
+	const uint8* in_end = in + in_length;
+
+	if (origsz < 4)
+		return false;
 
-	for (i = 1; i < 3; i++)
-		sbitstream[i-1] = context->org_buf[i]->data + context->OrgByteCount[i];
+	i = origsz;
 
-	do
+	while (i > 4)
 	{
-		for (i = 0; i < 3; i++)
-			ycocg[i] = *(context->org_buf[i]->p);
+		if (in >= in_end)
+			return false;
 
-		for (i = 1; i < 3; i++)
+		value = *in++;
+
+		if (i == 5 || in >= in_end || *in != value)
 		{
-			bytno = context->OrgByteCount[i] - size;
-			bitoff = bytno % 8;
-			sign[i-1] = (*(sbitstream[i-1] + (bytno >> 3)) >> (7 - bitoff)) & 0x1;
-			ycocg[i] = (((sint16)(0 - sign[i-1])) << 8) | ycocg[i];
+			*out++ = value;
+			i--;
+			continue;
 		}
 
-		rgb[0] = ycocg[0] + (ycocg[1] >> 1) - (ycocg[2] >> 1);
-		rgb[1] = ycocg[0] + (ycocg[2] >> 1);
-		rgb[2] = ycocg[0] - (ycocg[1] >> 1) - (ycocg[2] >> 1);
+		in++;
+
+		if (in >= in_end)
+			return false;
 
-		for (i = 0; i < 3; i++)
+		if (*in < 0xFF)
 		{
-			tmp = (rgb[i] >> 8) & 0xff;
-			if (tmp == 0xff)
-				val = 0x00;
-			else if (tmp == 0x1)
-				val = 0xff;
-			else
-				val = (uint8) rgb[i];
-
-			stream_write_uint8(context->org_buf[i], val);
+			len = *in++ + 2;
+		}
+		else
+		{
+			if (in_end - in < 5)
+				return false;
+
+			len = in[1] | (in[2] << 8) | (in[3] << 16) | ((uint32) in[4] << 24);
+			in += 5;
 		}
 
-		size--;
+		/* keep room for the four raw bytes */
+		if (len > i - 4)
+			return false;
+
+		memset(out, value, len);
+		out += len;
+		i -= len;
 	}
-	while (size);
 
-	for (i = 0; i < 3; i++)
-		context->org_buf[i]->p = context->org_buf[i]->data;
-}
+	if (in_end - in < 4)
+		return false;
 
-void nsc_colorloss_recover(NSC_CONTEXT* context)
-{
-	int i;
-	uint8 cllvl;
-	cllvl = context->nsc_stream->colorLossLevel;
+	memcpy(out, in, 4);
 
-	for (i = 1; i < 3; i++)
-		nsc_cl_expand(context->org_buf[i], cllvl, context->OrgByteCount[i]);
+	return true;
 }
 
-void nsc_rle_decode(STREAM* in, STREAM* out, uint32 origsz)
+uint8* nsc_plane_buffer(NSC_CONTEXT* context, int index, uint32 length)
 {
-	uint32 i;
-	uint8 value;
-	i = origsz;
-
-	while (i > 4)
+	if (context->plane_buf_length[index] < length)
 	{
-		stream_read_uint8(in, value);
-
-		if (i == 5)
-		{
-			stream_write_uint8(out,value);
-			i-=1;
-		}
-		else if (value == *(in->p))
-		{
-			stream_seek(in, 1);
-
-			if (*(in->p) < 0xFF)
-			{
-				uint8 len;
-				stream_read_uint8(in, len);
-				stream_set_byte(out, value, len+2);
-				i -= (len+2);
-			}
-			else
-			{
-				uint32 len;
-				stream_seek(in, 1);
-				stream_read_uint32(in, len);
-				stream_set_byte(out, value, len);
-				i -= len;
-			}
-		}
-		else
-		{
-			stream_write_uint8(out, value);
-			i -= 1;
-		}
+		xfree(context->plane_buf[index]);
+		context->plane_buf[index] = (uint8*) xmalloc(length);
+		context->plane_buf_length[index] = length;
 	}
 
-	stream_copy(out, in, 4);
+	return context->plane_buf[index];
 }
 
-void nsc_rle_decompress_data(NSC_CONTEXT* context)
+/**
+ * Byte length of each plane, see [MS-RDPNSC] 2.2. With chroma subsampling
+ * luma rows are padded to a multiple of 8 and the chroma planes have half
+ * the padded width and height.
+ */
+void nsc_context_init_byte_counts(NSC_CONTEXT* context, boolean subsampling)
 {
-	STREAM* rles;
-	uint16 i;
-	uint32 origsize;
-	rles = stream_new(0);
-	rles->p = rles->data = context->nsc_stream->pdata->p;
-	rles->size = context->nsc_stream->pdata->size;
+	int i;
+	uint32 width;
+	uint32 height;
 
 	for (i = 0; i < 4; i++)
-	{
-		origsize = context->OrgByteCount[i];
+		context->OrgByteCount[i] = context->width * context->height;
 
-		if (i == 3 && context->nsc_stream->PlaneByteCount[i] == 0)
-			stream_set_byte(context->org_buf[i], 0xff, origsize);
-		else if (context->nsc_stream->PlaneByteCount[i] < origsize)
-			nsc_rle_decode(rles, context->org_buf[i], origsize);
-		else
-			stream_copy(context->org_buf[i], rles, origsize);
-
-		context->org_buf[i]->p = context->org_buf[i]->data;
+	if (subsampling)
+	{
+		width = ROUND_UP_TO(context->width, 8);
+		height = ROUND_UP_TO(context->height, 2);
+		context->OrgByteCount[0] = width * context->height;
+		context->OrgByteCount[1] = (width >> 1) * (height >> 1);
+		context->OrgByteCount[2] = (width >> 1) * (height >> 1);
 	}
 }
 
-void nsc_combine_argb(NSC_CONTEXT* context)
+static boolean nsc_stream_initialize(NSC_CONTEXT* context, uint8* data, uint32 length)
 {
 	int i;
-	uint8* bmp;
-	bmp = context->bmpdata;
+	uint32 total;
+	NSC_STREAM* nsc_stream = context->nsc_stream;
+
+	if (length < 20)
+		return false;
 
-	for (i = 0; i < (context->width * context->height); i++)
+	for (i = 0, total = 0; i < 4; i++)
 	{
-		stream_read_uint8(context->org_buf[2], *bmp++);
-		stream_read_uint8(context->org_buf[1], *bmp++);
-		stream_read_uint8(context->org_buf[0], *bmp++);
-		stream_read_uint8(context->org_buf[3], *bmp++);
+		nsc_stream->PlaneByteCount[i] = data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32) data[3] << 24);
+		data += 4;
+
+		if (nsc_stream->PlaneByteCount[i] > length - 20 - total)
+			return false;
+
+		total += nsc_stream->PlaneByteCount[i];
 	}
+
+	nsc_stream->colorLossLevel = data[0];
+	nsc_stream->ChromaSubSamplingLevel = data[1];
+	nsc_stream->Reserved = data[2] | (data[3] << 8);
+	nsc_stream->pdata = data + 4;
+
+	/* ColorLossLevel MUST be between 1 and 7 */
+	if (nsc_stream->colorLossLevel < 1 || nsc_stream->colorLossLevel > 7)
+		return false;
+
+	return true;
 }
 
-void nsc_stream_initialize(NSC_CONTEXT* context, STREAM* s)
+/**
+ * Locate the four planes of the message. Raw planes are used in place,
+ * run length encoded ones are expanded into the context plane buffers.
+ */
+static boolean nsc_planes_initialize(NSC_CONTEXT* context)
 {
 	int i;
+	uint8* plane;
+	uint8* pdata;
+	NSC_STREAM* nsc_stream = context->nsc_stream;
+
+	nsc_context_init_byte_counts(context, nsc_stream->ChromaSubSamplingLevel > 0);
+
+	pdata = nsc_stream->pdata;
 
 	for (i = 0; i < 4; i++)
-		stream_read_uint32(s, context->nsc_stream->PlaneByteCount[i]);
+	{
+		if (i == 3 && nsc_stream->PlaneByteCount[i] == 0)
+		{
+			context->planes[i] = NULL;
+		}
+		else if (nsc_stream->PlaneByteCount[i] < context->OrgByteCount[i])
+		{
+			plane = nsc_plane_buffer(context, i, context->OrgByteCount[i]);
 
-	stream_read_uint8(s, context->nsc_stream->colorLossLevel);
-	stream_read_uint8(s, context->nsc_stream->ChromaSubSamplingLevel);
-	stream_seek(s, 2);
+			if (!nsc_rle_decode(pdata, nsc_stream->PlaneByteCount[i], plane, context->OrgByteCount[i]))
+				return false;
+
+			context->planes[i] = plane;
+		}
+		else
+		{
+			context->planes[i] = pdata;
+		}
+
+		pdata += nsc_stream->PlaneByteCount[i];
+	}
 
-	context->nsc_stream->pdata = stream_new(0);
-	stream_attach(context->nsc_stream->pdata, s->p, BYTESUM(context->nsc_stream->PlaneByteCount));
+	return true;
 }
 
-void nsc_context_initialize(NSC_CONTEXT* context, STREAM* s)
+NSC_CONTEXT* nsc_context_new(void)
 {
-	int i;
-	uint32 tempsz;
-	nsc_stream_initialize(context, s);
-	context->bmpdata = xzalloc(context->width * context->height * 4);
+	NSC_CONTEXT* nsc_context;
 
-	for (i = 0; i < 4; i++)
-		context->OrgByteCount[i]=context->width * context->height;
+	nsc_context = xnew(NSC_CONTEXT);
+	nsc_context->nsc_stream = xnew(NSC_STREAM);
 
-	if (context->nsc_stream->ChromaSubSamplingLevel > 0)	/* [MS-RDPNSC] 2.2 */
-	{
-		uint32 tempWidth,tempHeight;
-		tempWidth = ROUND_UP_TO(context->width, 8);
-		context->OrgByteCount[0] = tempWidth * context->height;
-		tempWidth = tempWidth >> 1 ;
-		tempHeight = ROUND_UP_TO(context->height, 2);
-		tempHeight = tempHeight >> 1;
-		context->OrgByteCount[1] = tempWidth * tempHeight;
-		context->OrgByteCount[2] = tempWidth * tempHeight;
-	}
-	for (i = 0; i < 4; i++)
-	{
-		tempsz = context->OrgByteCount[i];
+	/* encoder defaults, as advertised in our NSCodec capability set */
+	nsc_context->color_loss_level = 3;
+	nsc_context->chroma_subsampling = true;
 
-		if (i == 1 || i == 2)
-			tempsz += (tempsz & 0x7) ? (tempsz >> 3) + 0x1 : (tempsz >> 3); /* extra bytes/8 bytes for bitstream to store the 9th bit after colorloss recover */
+	nsc_context_set_cpu_opt(nsc_context, freerdp_detect_cpu());
 
-		context->org_buf[i] = stream_new(tempsz);
-	}
+	return nsc_context;
 }
 
-void nsc_context_destroy(NSC_CONTEXT* context)
+void nsc_context_free(NSC_CONTEXT* context)
 {
 	int i;
 
-	for (i = 0;i < 4; i++)
-		stream_free(context->org_buf[i]);
+	if (context == NULL)
+		return;
+
+	for (i = 0; i < 4; i++)
+		xfree(context->plane_buf[i]);
 
-	stream_detach(context->nsc_stream->pdata);
 	xfree(context->bmpdata);
+	xfree(context->nsc_stream);
+	xfree(context);
 }
 
-NSC_CONTEXT* nsc_context_new(void)
+/**
+ * Select the decoding routine for the CPU_* flags in cpu_opt, as returned
+ * by freerdp_detect_cpu(). A cpu_opt of 0 restores the plain C routine.
+ */
+void nsc_context_set_cpu_opt(NSC_CONTEXT* context, uint32 cpu_opt)
 {
-	NSC_CONTEXT* nsc_context;
-	nsc_context = xnew(NSC_CONTEXT);
-	nsc_context->nsc_stream = xnew(NSC_STREAM);
-	return nsc_context;
+	context->decode = nsc_decode;
+	context->encode = nsc_encode;
+
+	if (cpu_opt & CPU_SSE2)
+		NSC_INIT_SIMD(context);
 }
 
-void nsc_process_message(NSC_CONTEXT* context, uint8* data, uint32 length)
+/**
+ * ColorLossLevel used by nsc_compose_message(), from 1 (finest chroma) to 7.
+ */
+void nsc_context_set_color_loss_level(NSC_CONTEXT* context, int color_loss_level)
 {
-	STREAM* s;
-	s = stream_new(0);
-	stream_attach(s, data, length);
-	nsc_context_initialize(context, s);
-
-	/* RLE decode */
-	nsc_rle_decompress_data(context);
-
-	/* colorloss recover */
-	nsc_colorloss_recover(context);
-
-	/* Chroma supersample */
-	if (context->nsc_stream->ChromaSubSamplingLevel > 0)
-		nsc_chroma_supersample(context);
-	
-	/* YCoCg to RGB Convert */
-	nsc_ycocg_rgb(context);
-
-	/* Combine ARGB planes */
-	nsc_combine_argb(context);
+	if (color_loss_level < 1)
+		color_loss_level = 1;
+	else if (color_loss_level > 7)
+		color_loss_level = 7;
+
+	context->color_loss_level = color_loss_level;
+}
+
+/**
+ * Whether nsc_compose_message() subsamples chroma by 2 in both directions.
+ * Only enable this if the client set fAllowSubsampling.
+ */
+void nsc_context_set_chroma_subsampling(NSC_CONTEXT* context, boolean enabled)
+{
+	context->chroma_subsampling = enabled;
+}
+
+/**
+ * Decode an NSCODEC_BITMAP_STREAM of context->width x context->height
+ * pixels into context->bmpdata, as BGRA in the row order of the stream,
+ * which is bottom-up: the first row is the bottom row of the image. The
+ * buffers are reused by the next message; false is returned for malformed
+ * streams.
+ */
+boolean nsc_process_message(NSC_CONTEXT* context, uint8* data, uint32 length)
+{
+	uint32 bmpdata_length;
+
+	if (!nsc_stream_initialize(context, data, length))
+		return false;
+
+	if (!nsc_planes_initialize(context))
+		return false;
+
+	bmpdata_length = context->width * context->height * 4;
+
+	if (context->bmpdata_length < bmpdata_length)
+	{
+		xfree(context->bmpdata);
+		context->bmpdata = (uint8*) xmalloc(bmpdata_length);
+		context->bmpdata_length = bmpdata_length;
+	}
+
+	context->decode(context);
+
+	return true;
 }
@@ -0,0 +1,260 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * NSCodec Encoder
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <freerdp/codec/nsc.h>
+#include <freerdp/utils/memory.h>
+
+#include "nsc_encode.h"
+
+/**
+ * Convert BGRA pixels to YCoCg planes, applying the colour loss to the
+ * chroma. Every plane but alpha is written with the luma stride, and at
+ * full resolution; subsampling happens afterwards. See [MS-RDPNSC] 3.1.8.
+ */
+void nsc_encode(NSC_CONTEXT* context, const uint8* bmpdata, int rowstride)
+{
+	int x, y;
+	int shift;
+	int stride;
+	const uint8* src;
+	uint8* yplane;
+	uint8* coplane;
+	uint8* cgplane;
+	uint8* aplane;
+	sint16 r_val, g_val, b_val;
+
+	shift = context->color_loss_level;
+	stride = context->chroma_subsampling ? ROUND_UP_TO(context->width, 8) : context->width;
+
+	for (y = 0; y < context->height; y++)
+	{
+		src = bmpdata + y * rowstride;
+		yplane = context->plane_buf[0] + y * stride;
+		coplane = context->plane_buf[1] + y * stride;
+		cgplane = context->plane_buf[2] + y * stride;
+		aplane = context->plane_buf[3] + y * context->width;
+
+		for (x = 0; x < context->width; x++)
+		{
+			b_val = *src++;
+			g_val = *src++;
+			r_val = *src++;
+			*aplane++ = *src++;
+
+			*yplane++ = (uint8) ((r_val + (g_val << 1) + b_val) >> 2);
+			*coplane++ = (uint8) ((r_val - b_val) >> shift);
+			*cgplane++ = (uint8) (((g_val << 1) - r_val - b_val) >> (shift + 1));
+		}
+	}
+}
+
+/**
+ * Pad luma and chroma to the subsampled geometry by repeating the last
+ * column and row, then average each 2x2 chroma block in place.
+ */
+static void nsc_encode_subsample(NSC_CONTEXT* context)
+{
+	int i, x, y;
+	int stride;
+	int rows;
+	uint8* row;
+	uint8* out;
+	const sint8* src;
+
+	stride = ROUND_UP_TO(context->width, 8);
+	rows = ROUND_UP_TO(context->height, 2);
+
+	for (i = 0; i < 3; i++)
+	{
+		for (y = 0; y < context->height; y++)
+		{
+			row = context->plane_buf[i] + y * stride;
+			memset(row + context->width, row[context->width - 1], stride - context->width);
+		}
+	}
+
+	for (i = 1; i < 3; i++)
+	{
+		if (rows > context->height)
+		{
+			memcpy(context->plane_buf[i] + context->height * stride,
+				context->plane_buf[i] + (context->height - 1) * stride, stride);
+		}
+
+		out = context->plane_buf[i];
+
+		for (y = 0; y < rows; y += 2)
+		{
+			src = (sint8*) context->plane_buf[i] + y * stride;
+
+			for (x = 0; x < stride; x += 2)
+				*out++ = (uint8) ((src[x] + src[x + 1] + src[x + stride] + src[x + stride + 1] + 2) >> 2);
+		}
+	}
+}
+
+/**
+ * Run length encode a plane at the tail of s, see [MS-RDPNSC] 3.1.8.1.
+ * The plane is stored raw instead when encoding does not make it smaller.
+ * Returns the number of bytes written.
+ */
+static uint32 nsc_rle_encode(const uint8* in, uint32 origsz, STREAM* s)
+{
+	uint32 len;
+	uint8 value;
+	uint8* out;
+	uint8* out_end;
+	const uint8* in_next;
+	const uint8* in_end;
+
+	if (origsz <= 4)
+	{
+		stream_write(s, in, origsz);
+		return origsz;
+	}
+
+	out = stream_get_tail(s);
+	out_end = out + origsz;
+	in_next = in;
+	in_end = in + origsz - 4;
+
+	while (in_next < in_end)
+	{
+		/* a run token takes up to 7 bytes */
+		if (out + 7 > out_end)
+			break;
+
+		value = *in_next;
+
+		for (len = 1; in_next + len < in_end && in_next[len] == value; len++);
+
+		*out++ = value;
+
+		if (len > 1)
+		{
+			*out++ = value;
+
+			if (len - 2 < 0xFF)
+			{
+				*out++ = len - 2;
+			}
+			else
+			{
+				*out++ = 0xFF;
+				*out++ = len & 0xFF;
+				*out++ = (len >> 8) & 0xFF;
+				*out++ = (len >> 16) & 0xFF;
+				*out++ = (len >> 24) & 0xFF;
+			}
+		}
+
+		in_next += len;
+	}
+
+	if (in_next < in_end || out + 4 >= out_end)
+	{
+		stream_write(s, in, origsz);
+		return origsz;
+	}
+
+	memcpy(out, in_end, 4);
+	out += 4;
+
+	len = out - stream_get_tail(s);
+	stream_seek(s, len);
+
+	return len;
+}
+
+static boolean nsc_encode_alpha_opaque(const uint8* aplane, uint32 length)
+{
+	uint32 i;
+
+	for (i = 0; i < length; i++)
+	{
+		if (aplane[i] != 0xFF)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * Encode a width x height top-down BGRA image as an NSCODEC_BITMAP_STREAM
+ * at the tail of s, with the context colour loss level and chroma
+ * subsampling. The stream carries the rows bottom-up, as
+ * nsc_process_message() and the clients expect. The alpha plane is left
+ * out when every pixel is opaque.
+ */
+void nsc_compose_message(NSC_CONTEXT* context, STREAM* s,
+	uint8* bmpdata, int width, int height, int rowstride)
+{
+	int i;
+	int stride;
+	int rows;
+	uint32 header_pos;
+	uint32 end_pos;
+	uint32 PlaneByteCount[4];
+
+	context->width = width;
+	context->height = height;
+
+	stride = context->chroma_subsampling ? ROUND_UP_TO(width, 8) : width;
+	rows = context->chroma_subsampling ? ROUND_UP_TO(height, 2) : height;
+
+	nsc_plane_buffer(context, 0, stride * height);
+	nsc_plane_buffer(context, 1, stride * rows);
+	nsc_plane_buffer(context, 2, stride * rows);
+	nsc_plane_buffer(context, 3, width * height);
+
+	if (height > 0)
+		context->encode(context, bmpdata + (height - 1) * rowstride, -rowstride);
+
+	if (context->chroma_subsampling && width > 0 && height > 0)
+		nsc_encode_subsample(context);
+
+	nsc_context_init_byte_counts(context, context->chroma_subsampling);
+
+	stream_check_size(s, 20 + context->OrgByteCount[0] + context->OrgByteCount[1] +
+		context->OrgByteCount[2] + context->OrgByteCount[3]);
+
+	header_pos = stream_get_pos(s);
+	stream_seek(s, 20);
+
+	for (i = 0; i < 4; i++)
+	{
+		if (i == 3 && nsc_encode_alpha_opaque(context->plane_buf[3], context->OrgByteCount[3]))
+			PlaneByteCount[i] = 0;
+		else
+			PlaneByteCount[i] = nsc_rle_encode(context->plane_buf[i], context->OrgByteCount[i], s);
+	}
+
+	end_pos = stream_get_pos(s);
+	stream_set_pos(s, header_pos);
+
+	for (i = 0; i < 4; i++)
+		stream_write_uint32(s, PlaneByteCount[i]); /* PlaneByteCount */
+
+	stream_write_uint8(s, context->color_loss_level); /* ColorLossLevel */
+	stream_write_uint8(s, context->chroma_subsampling ? 1 : 0); /* ChromaSubsamplingLevel */
+	stream_write_uint16(s, 0); /* Reserved */
+
+	stream_set_pos(s, end_pos);
+}
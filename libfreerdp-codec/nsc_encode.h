@@ -0,0 +1,27 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * NSCodec Encoder
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NSC_ENCODE_H
+#define __NSC_ENCODE_H
+
+#include <freerdp/codec/nsc.h>
+
+#include "nsc_types.h"
+
+void nsc_encode(NSC_CONTEXT* context, const uint8* bmpdata, int rowstride);
+
+#endif /* __NSC_ENCODE_H */
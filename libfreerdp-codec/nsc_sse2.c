@@ -0,0 +1,240 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * NSCodec Library - SSE2 Optimizations
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xmmintrin.h>
+#include <emmintrin.h>
+
+#include "nsc_sse2.h"
+
+#ifdef _MSC_VER
+#define	__attribute__(...)
+#endif
+
+/**
+ * Convert 16 pixels to BGRA. With chroma subsampling only 8 chroma
+ * samples are read and each one is used for two neighbouring pixels.
+ */
+static __inline void __attribute__((__gnu_inline__, __always_inline__, __artificial__))
+nsc_decode_pixels_sse2(const uint8* yplane, const uint8* coplane, const uint8* cgplane,
+	const uint8* aplane, int css, __m128i shift, __m128i mask, uint8* dst)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i y_val, co_val, cg_val, a_val;
+	__m128i y_lo, y_hi, co_lo, co_hi, cg_lo, cg_hi;
+	__m128i r_val, g_val, b_val;
+	__m128i bg, ra;
+
+	y_val = _mm_loadu_si128((__m128i*) yplane);
+
+	if (css)
+	{
+		co_val = _mm_loadl_epi64((__m128i*) coplane);
+		co_val = _mm_unpacklo_epi8(co_val, co_val);
+		cg_val = _mm_loadl_epi64((__m128i*) cgplane);
+		cg_val = _mm_unpacklo_epi8(cg_val, cg_val);
+	}
+	else
+	{
+		co_val = _mm_loadu_si128((__m128i*) coplane);
+		cg_val = _mm_loadu_si128((__m128i*) cgplane);
+	}
+
+	/* undo the colour loss, there is no 8-bit shift so mask out the bits crossing lanes */
+	co_val = _mm_and_si128(_mm_sll_epi16(co_val, shift), mask);
+	cg_val = _mm_and_si128(_mm_sll_epi16(cg_val, shift), mask);
+
+	/* widen to 16 bits, chroma is signed */
+	y_lo = _mm_unpacklo_epi8(y_val, zero);
+	y_hi = _mm_unpackhi_epi8(y_val, zero);
+	co_lo = _mm_srai_epi16(_mm_unpacklo_epi8(zero, co_val), 8);
+	co_hi = _mm_srai_epi16(_mm_unpackhi_epi8(zero, co_val), 8);
+	cg_lo = _mm_srai_epi16(_mm_unpacklo_epi8(zero, cg_val), 8);
+	cg_hi = _mm_srai_epi16(_mm_unpackhi_epi8(zero, cg_val), 8);
+
+	/* r = y + co - cg, g = y + cg, b = y - co - cg, saturated by the packs */
+	r_val = _mm_packus_epi16(_mm_sub_epi16(_mm_add_epi16(y_lo, co_lo), cg_lo),
+		_mm_sub_epi16(_mm_add_epi16(y_hi, co_hi), cg_hi));
+	g_val = _mm_packus_epi16(_mm_add_epi16(y_lo, cg_lo), _mm_add_epi16(y_hi, cg_hi));
+	b_val = _mm_packus_epi16(_mm_sub_epi16(_mm_sub_epi16(y_lo, co_lo), cg_lo),
+		_mm_sub_epi16(_mm_sub_epi16(y_hi, co_hi), cg_hi));
+
+	if (aplane != NULL)
+		a_val = _mm_loadu_si128((__m128i*) aplane);
+	else
+		a_val = _mm_set1_epi8((char) 0xFF);
+
+	bg = _mm_unpacklo_epi8(b_val, g_val);
+	ra = _mm_unpacklo_epi8(r_val, a_val);
+	_mm_storeu_si128((__m128i*) dst, _mm_unpacklo_epi16(bg, ra));
+	_mm_storeu_si128((__m128i*) (dst + 16), _mm_unpackhi_epi16(bg, ra));
+
+	bg = _mm_unpackhi_epi8(b_val, g_val);
+	ra = _mm_unpackhi_epi8(r_val, a_val);
+	_mm_storeu_si128((__m128i*) (dst + 32), _mm_unpacklo_epi16(bg, ra));
+	_mm_storeu_si128((__m128i*) (dst + 48), _mm_unpackhi_epi16(bg, ra));
+}
+
+static void nsc_decode_sse2(NSC_CONTEXT* context)
+{
+	int x, y, n;
+	int css;
+	int y_stride, c_stride;
+	const uint8* yplane;
+	const uint8* coplane;
+	const uint8* cgplane;
+	const uint8* aplane;
+	uint8* bmp;
+	__m128i shift, mask;
+	uint8 y_tail[16], co_tail[16], cg_tail[16], a_tail[16];
+	uint8 bmp_tail[64];
+
+	css = (context->nsc_stream->ChromaSubSamplingLevel != 0) ? 1 : 0;
+	shift = _mm_cvtsi32_si128(context->nsc_stream->colorLossLevel - 1);
+	mask = _mm_set1_epi8((char) ((0xFF << (context->nsc_stream->colorLossLevel - 1)) & 0xFF));
+	y_stride = css ? ROUND_UP_TO(context->width, 8) : context->width;
+	c_stride = css ? y_stride / 2 : context->width;
+	bmp = context->bmpdata;
+
+	for (y = 0; y < context->height; y++)
+	{
+		yplane = context->planes[0] + y * y_stride;
+		coplane = context->planes[1] + (y >> css) * c_stride;
+		cgplane = context->planes[2] + (y >> css) * c_stride;
+		aplane = (context->planes[3] != NULL) ? context->planes[3] + y * context->width : NULL;
+
+		for (x = 0; x + 16 <= context->width; x += 16)
+		{
+			nsc_decode_pixels_sse2(yplane + x, coplane + (x >> css), cgplane + (x >> css),
+				(aplane != NULL) ? aplane + x : NULL, css, shift, mask, bmp);
+			bmp += 64;
+		}
+
+		if (x < context->width)
+		{
+			/* the planes may end right after the row, so convert the tail from a copy */
+			n = context->width - x;
+			memcpy(y_tail, yplane + x, n);
+			memcpy(co_tail, coplane + (x >> css), (n + css) >> css);
+			memcpy(cg_tail, cgplane + (x >> css), (n + css) >> css);
+
+			if (aplane != NULL)
+				memcpy(a_tail, aplane + x, n);
+
+			nsc_decode_pixels_sse2(y_tail, co_tail, cg_tail, (aplane != NULL) ? a_tail : NULL,
+				css, shift, mask, bmp_tail);
+			memcpy(bmp, bmp_tail, n * 4);
+			bmp += n * 4;
+		}
+	}
+}
+
+/**
+ * Convert 16 BGRA pixels to Y, Co, Cg and A samples, with the colour loss
+ * applied to the chroma.
+ */
+static __inline void __attribute__((__gnu_inline__, __always_inline__, __artificial__))
+nsc_encode_pixels_sse2(const uint8* src, uint8* yplane, uint8* coplane, uint8* cgplane,
+	uint8* aplane, __m128i co_shift, __m128i cg_shift)
+{
+	int i;
+	__m128i mask = _mm_set1_epi32(0xFF);
+	__m128i p[4];
+	__m128i r_val[2], g_val[2], b_val[2], a_val[2];
+	__m128i y_val[2], co_val[2], cg_val[2];
+
+	for (i = 0; i < 4; i++)
+		p[i] = _mm_loadu_si128((__m128i*) (src + i * 16));
+
+	/* split the channels into 16-bit lanes, 8 pixels per register */
+	for (i = 0; i < 2; i++)
+	{
+		b_val[i] = _mm_packs_epi32(_mm_and_si128(p[i * 2], mask),
+			_mm_and_si128(p[i * 2 + 1], mask));
+		g_val[i] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p[i * 2], 8), mask),
+			_mm_and_si128(_mm_srli_epi32(p[i * 2 + 1], 8), mask));
+		r_val[i] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p[i * 2], 16), mask),
+			_mm_and_si128(_mm_srli_epi32(p[i * 2 + 1], 16), mask));
+		a_val[i] = _mm_packs_epi32(_mm_srli_epi32(p[i * 2], 24), _mm_srli_epi32(p[i * 2 + 1], 24));
+
+		/* y = (r + 2g + b) / 4, co = r - b, cg = 2g - r - b */
+		g_val[i] = _mm_slli_epi16(g_val[i], 1);
+		y_val[i] = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(r_val[i], g_val[i]), b_val[i]), 2);
+		co_val[i] = _mm_sra_epi16(_mm_sub_epi16(r_val[i], b_val[i]), co_shift);
+		cg_val[i] = _mm_sra_epi16(_mm_sub_epi16(_mm_sub_epi16(g_val[i], r_val[i]), b_val[i]), cg_shift);
+	}
+
+	_mm_storeu_si128((__m128i*) yplane, _mm_packus_epi16(y_val[0], y_val[1]));
+	_mm_storeu_si128((__m128i*) coplane, _mm_packs_epi16(co_val[0], co_val[1]));
+	_mm_storeu_si128((__m128i*) cgplane, _mm_packs_epi16(cg_val[0], cg_val[1]));
+	_mm_storeu_si128((__m128i*) aplane, _mm_packus_epi16(a_val[0], a_val[1]));
+}
+
+static void nsc_encode_sse2(NSC_CONTEXT* context, const uint8* bmpdata, int rowstride)
+{
+	int x, y, n;
+	int stride;
+	const uint8* src;
+	uint8* yplane;
+	uint8* coplane;
+	uint8* cgplane;
+	uint8* aplane;
+	__m128i co_shift, cg_shift;
+	uint8 src_tail[64];
+	uint8 y_tail[16], co_tail[16], cg_tail[16], a_tail[16];
+
+	co_shift = _mm_cvtsi32_si128(context->color_loss_level);
+	cg_shift = _mm_cvtsi32_si128(context->color_loss_level + 1);
+	stride = context->chroma_subsampling ? ROUND_UP_TO(context->width, 8) : context->width;
+
+	for (y = 0; y < context->height; y++)
+	{
+		src = bmpdata + y * rowstride;
+		yplane = context->plane_buf[0] + y * stride;
+		coplane = context->plane_buf[1] + y * stride;
+		cgplane = context->plane_buf[2] + y * stride;
+		aplane = context->plane_buf[3] + y * context->width;
+
+		for (x = 0; x + 16 <= context->width; x += 16)
+		{
+			nsc_encode_pixels_sse2(src + x * 4, yplane + x, coplane + x, cgplane + x, aplane + x,
+				co_shift, cg_shift);
+		}
+
+		if (x < context->width)
+		{
+			/* the alpha plane has no padding, so convert the tail through a copy */
+			n = context->width - x;
+			memcpy(src_tail, src + x * 4, n * 4);
+
+			nsc_encode_pixels_sse2(src_tail, y_tail, co_tail, cg_tail, a_tail, co_shift, cg_shift);
+
+			memcpy(yplane + x, y_tail, n);
+			memcpy(coplane + x, co_tail, n);
+			memcpy(cgplane + x, cg_tail, n);
+			memcpy(aplane + x, a_tail, n);
+		}
+	}
+}
+
+void nsc_init_sse2(NSC_CONTEXT* context)
+{
+	context->decode = nsc_decode_sse2;
+	context->encode = nsc_encode_sse2;
+}
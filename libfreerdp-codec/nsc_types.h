@@ -0,0 +1,27 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * NSCodec Library
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NSC_TYPES_H
+#define __NSC_TYPES_H
+
+#include "config.h"
+#include <freerdp/codec/nsc.h>
+
+uint8* nsc_plane_buffer(NSC_CONTEXT* context, int index, uint32 length);
+void nsc_context_init_byte_counts(NSC_CONTEXT* context, boolean subsampling);
+
+#endif /* __NSC_TYPES_H */
@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <freerdp/codec/rfx.h>
 #include <freerdp/utils/memory.h>
+#include <freerdp/utils/cpu.h>
 #include <freerdp/constants.h>
 
 #include "rfx_constants.h"
@@ -31,12 +32,17 @@
 #include "rfx_decode.h"
 #include "rfx_encode.h"
 #include "rfx_quantization.h"
+#include "rfx_rate.h"
 #include "rfx_dwt.h"
 
 #ifdef WITH_SSE2
 #include "rfx_sse2.h"
 #endif
 
+#ifdef WITH_AVX2
+#include "rfx_avx2.h"
+#endif
+
 #ifdef WITH_NEON
 #include "rfx_neon.h"
 #endif
@@ -80,6 +86,7 @@ static void rfx_profiler_create(RFX_CONTEXT* context)
 	PROFILER_CREATE(context->priv->prof_rfx_quantization_encode, "rfx_quantization_encode");
 	PROFILER_CREATE(context->priv->prof_rfx_dwt_2d_encode, "rfx_dwt_2d_encode");
 	PROFILER_CREATE(context->priv->prof_rfx_encode_rgb_to_ycbcr, "rfx_encode_rgb_to_ycbcr");
+	PROFILER_CREATE(context->priv->prof_rfx_encode_format_rgb_to_ycbcr, "rfx_encode_format_rgb_to_ycbcr");
 	PROFILER_CREATE(context->priv->prof_rfx_encode_format_rgb, "rfx_encode_format_rgb");
 }
 
@@ -101,6 +108,7 @@ static void rfx_profiler_free(RFX_CONTEXT* context)
 	PROFILER_FREE(context->priv->prof_rfx_quantization_encode);
 	PROFILER_FREE(context->priv->prof_rfx_dwt_2d_encode);
 	PROFILER_FREE(context->priv->prof_rfx_encode_rgb_to_ycbcr);
+	PROFILER_FREE(context->priv->prof_rfx_encode_format_rgb_to_ycbcr);
 	PROFILER_FREE(context->priv->prof_rfx_encode_format_rgb);
 }
 
@@ -124,11 +132,22 @@ static void rfx_profiler_print(RFX_CONTEXT* context)
 	PROFILER_PRINT(context->priv->prof_rfx_quantization_encode);
 	PROFILER_PRINT(context->priv->prof_rfx_dwt_2d_encode);
 	PROFILER_PRINT(context->priv->prof_rfx_encode_rgb_to_ycbcr);
+	PROFILER_PRINT(context->priv->prof_rfx_encode_format_rgb_to_ycbcr);
 	PROFILER_PRINT(context->priv->prof_rfx_encode_format_rgb);
 
 	PROFILER_PRINT_FOOTER;
 }
 
+static void rfx_scratch_init(RFX_SCRATCH* scratch)
+{
+	/* align buffers to 16 byte boundary (needed for SSE/SSE2 instructions) */
+	scratch->y_r_buffer = (sint16*)(((uintptr_t)scratch->y_r_mem + 16) & ~ 0x0F);
+	scratch->cb_g_buffer = (sint16*)(((uintptr_t)scratch->cb_g_mem + 16) & ~ 0x0F);
+	scratch->cr_b_buffer = (sint16*)(((uintptr_t)scratch->cr_b_mem + 16) & ~ 0x0F);
+
+	scratch->dwt_buffer = (sint16*)(((uintptr_t)scratch->dwt_mem + 16) & ~ 0x0F);
+}
+
 RFX_CONTEXT* rfx_context_new(void)
 {
 	RFX_CONTEXT* context;
@@ -136,43 +155,115 @@ RFX_CONTEXT* rfx_context_new(void)
 	context = xnew(RFX_CONTEXT);
 	context->priv = xnew(RFX_CONTEXT_PRIV);
 	context->priv->pool = rfx_pool_new();
+	context->priv->stream = stream_new(0);
 
 	/* initialize the default pixel format */
 	rfx_context_set_pixel_format(context, RFX_PIXEL_FORMAT_BGRA);
 
-	/* align buffers to 16 byte boundary (needed for SSE/SSE2 instructions) */
-	context->priv->y_r_buffer = (sint16*)(((uintptr_t)context->priv->y_r_mem + 16) & ~ 0x0F);
-	context->priv->cb_g_buffer = (sint16*)(((uintptr_t)context->priv->cb_g_mem + 16) & ~ 0x0F);
-	context->priv->cr_b_buffer = (sint16*)(((uintptr_t)context->priv->cr_b_mem + 16) & ~ 0x0F);
+	rfx_scratch_init(&context->priv->scratch);
 
-	context->priv->dwt_buffer = (sint16*)(((uintptr_t)context->priv->dwt_mem + 16) & ~ 0x0F);
+	/* rate control is off */
+	context->priv->rate_stats.quality = -1;
 
 	/* create profilers for default decoding routines */
 	rfx_profiler_create(context);
-	
-	/* set up default routines */
+
+	/* set up the best routines this CPU supports */
+	rfx_context_set_cpu_opt(context, freerdp_detect_cpu());
+
+	return context;
+}
+
+static void rfx_init_c(RFX_CONTEXT* context)
+{
+	IF_PROFILER(context->priv->prof_rfx_decode_ycbcr_to_rgb->name = "rfx_decode_ycbcr_to_rgb");
+	IF_PROFILER(context->priv->prof_rfx_encode_rgb_to_ycbcr->name = "rfx_encode_rgb_to_ycbcr");
+	IF_PROFILER(context->priv->prof_rfx_encode_format_rgb_to_ycbcr->name = "rfx_encode_format_rgb_to_ycbcr");
+	IF_PROFILER(context->priv->prof_rfx_quantization_decode->name = "rfx_quantization_decode");
+	IF_PROFILER(context->priv->prof_rfx_quantization_encode->name = "rfx_quantization_encode");
+	IF_PROFILER(context->priv->prof_rfx_dwt_2d_decode->name = "rfx_dwt_2d_decode");
+	IF_PROFILER(context->priv->prof_rfx_dwt_2d_encode->name = "rfx_dwt_2d_encode");
+
 	context->decode_ycbcr_to_rgb = rfx_decode_ycbcr_to_rgb;
 	context->encode_rgb_to_ycbcr = rfx_encode_rgb_to_ycbcr;
-	context->quantization_decode = rfx_quantization_decode;	
-	context->quantization_encode = rfx_quantization_encode;	
+	context->encode_format_rgb_to_ycbcr = rfx_encode_format_rgb_to_ycbcr;
+	context->quantization_decode = rfx_quantization_decode;
+	context->quantization_encode = rfx_quantization_encode;
 	context->dwt_2d_decode = rfx_dwt_2d_decode;
 	context->dwt_2d_encode = rfx_dwt_2d_encode;
-
-	return context;
 }
 
+/**
+ * Select the codec routines for the CPU_* flags in cpu_opt, as returned by
+ * freerdp_detect_cpu(). The best level that is both allowed and compiled in
+ * wins; a cpu_opt of 0 restores the plain C routines.
+ */
 void rfx_context_set_cpu_opt(RFX_CONTEXT* context, uint32 cpu_opt)
 {
-	/* enable SIMD CPU acceleration if detected */
+	rfx_init_c(context);
+
 	if (cpu_opt & CPU_SSE2)
 		RFX_INIT_SIMD(context);
+
+#ifdef WITH_AVX2
+	if (cpu_opt & CPU_AVX2)
+		rfx_init_avx2(context);
+#endif
+}
+
+/**
+ * Decode and encode the tiles of a tileset on count threads. The calling
+ * thread is one of them, so count - 1 worker threads are started. A count of
+ * 0 or 1 turns multi-threaded processing off again. Profiler figures are shared by all
+ * threads and only give rough numbers while decoding is threaded.
+ */
+void rfx_context_set_thread_count(RFX_CONTEXT* context, int count)
+{
+	int i;
+
+	if (context->priv->thread_pool != NULL)
+	{
+		freerdp_thread_pool_free(context->priv->thread_pool);
+		context->priv->thread_pool = NULL;
+	}
+
+	xfree(context->priv->thread_scratch);
+	context->priv->thread_scratch = NULL;
+
+	if (count < 2)
+		return;
+
+	context->priv->thread_pool = freerdp_thread_pool_new(count - 1);
+
+	/* one more scratch than pool threads, the last one is used by the calling thread */
+	count = freerdp_thread_pool_get_size(context->priv->thread_pool) + 1;
+	context->priv->thread_scratch = xnew0(RFX_SCRATCH, count);
+
+	for (i = 0; i < count; i++)
+		rfx_scratch_init(&context->priv->thread_scratch[i]);
 }
 
 void rfx_context_free(RFX_CONTEXT* context)
 {
+	int i;
+
+	rfx_context_set_thread_count(context, 0);
+
 	xfree(context->quants);
+	xfree(context->priv->tile_jobs);
+
+	for (i = 0; i < context->priv->tile_streams_size; i++)
+		stream_free(context->priv->tile_streams[i]);
+	xfree(context->priv->tile_streams);
+
+	xfree(context->priv->tile_hashes);
+	xfree(context->priv->tile_levels);
+	xfree(context->priv->frame_hashes);
+	xfree(context->priv->dirty_tiles);
+	xfree(context->priv->dirty_rects);
 
 	rfx_pool_free(context->priv->pool);
+	stream_free(context->priv->stream);
 
 	rfx_profiler_print(context);
 	rfx_profiler_free(context);
@@ -210,10 +301,65 @@ void rfx_context_set_pixel_format(RFX_CONTEXT* context, RFX_PIXEL_FORMAT pixel_f
 	}
 }
 
+/**
+ * Only encode the tiles whose pixels changed since they were last sent. This
+ * is only correct if every frame passed to rfx_compose_message() covers the
+ * same coordinate space, e.g. a full framebuffer anchored at (0, 0), and if
+ * the client surface is not modified by anything else. rfx_context_reset()
+ * forgets all tiles again, so that the next frame is sent in full.
+ */
+void rfx_context_set_tile_cache(RFX_CONTEXT* context, boolean enabled)
+{
+	context->priv->tile_cache = enabled;
+
+	xfree(context->priv->tile_hashes);
+	xfree(context->priv->tile_levels);
+	context->priv->tile_hashes = NULL;
+	context->priv->tile_levels = NULL;
+	context->priv->tile_hashes_cols = 0;
+	context->priv->tile_hashes_rows = 0;
+}
+
+/**
+ * Hold the encoded frames around bits_per_frame by picking a coarser or finer
+ * quantization table for each frame, based on the size of the previous ones.
+ * This replaces the tables in context->quants. 0 turns rate control off.
+ */
+void rfx_context_set_target_frame_bits(RFX_CONTEXT* context, uint32 bits_per_frame)
+{
+	context->priv->rate_target_bits = bits_per_frame;
+	context->priv->rate_credit = 0;
+	context->priv->rate_stats.quality = -1;
+}
+
+/**
+ * Like rfx_context_set_target_frame_bits(), for a link of bits_per_second
+ * that carries frame_rate frames per second.
+ */
+void rfx_context_set_target_bitrate(RFX_CONTEXT* context, uint32 bits_per_second, uint32 frame_rate)
+{
+	if (frame_rate < 1)
+		frame_rate = 1;
+
+	context->priv->rate_frame_rate = frame_rate;
+	rfx_context_set_target_frame_bits(context, bits_per_second / frame_rate);
+}
+
+void rfx_context_get_rate_stats(RFX_CONTEXT* context, RFX_RATE_STATS* stats)
+{
+	memcpy(stats, &context->priv->rate_stats, sizeof(RFX_RATE_STATS));
+}
+
 void rfx_context_reset(RFX_CONTEXT* context)
 {
 	context->header_processed = false;
 	context->frame_idx = 0;
+
+	if (context->priv->tile_hashes != NULL)
+	{
+		memset(context->priv->tile_hashes, 0,
+			context->priv->tile_hashes_cols * context->priv->tile_hashes_rows * sizeof(uint64));
+	}
 }
 
 static void rfx_process_message_sync(RFX_CONTEXT* context, STREAM* s)
@@ -344,9 +490,12 @@ static void rfx_process_message_frame_end(RFX_CONTEXT* context, RFX_MESSAGE* mes
 static void rfx_process_message_region(RFX_CONTEXT* context, RFX_MESSAGE* message, STREAM* s)
 {
 	int i;
+	uint16 numRects;
 
 	stream_seek_uint8(s); /* regionFlags (1 byte) */
-	stream_read_uint16(s, message->num_rects); /* numRects (2 bytes) */
+	stream_read_uint16(s, numRects); /* numRects (2 bytes) */
+
+	rfx_pool_message_alloc_rects(context->priv->pool, message, numRects);
 
 	if (message->num_rects < 1)
 	{
@@ -354,11 +503,6 @@ static void rfx_process_message_region(RFX_CONTEXT* context, RFX_MESSAGE* messag
 		return;
 	}
 
-	if (message->rects != NULL)
-		message->rects = (RFX_RECT*) xrealloc(message->rects, message->num_rects * sizeof(RFX_RECT));
-	else
-		message->rects = (RFX_RECT*) xmalloc(message->num_rects * sizeof(RFX_RECT));
-
 	/* rects */
 	for (i = 0; i < message->num_rects; i++)
 	{
@@ -373,7 +517,21 @@ static void rfx_process_message_region(RFX_CONTEXT* context, RFX_MESSAGE* messag
 	}
 }
 
-static void rfx_process_message_tile(RFX_CONTEXT* context, RFX_TILE* tile, STREAM* s)
+struct _RFX_TILE_JOB
+{
+	RFX_TILE* tile; /* NULL when decoding straight into a surface */
+	uint16 x;
+	uint16 y;
+	const uint8* data;
+	uint16 YLen;
+	uint16 CbLen;
+	uint16 CrLen;
+	const uint32* quant_y;
+	const uint32* quant_cb;
+	const uint32* quant_cr;
+};
+
+static void rfx_process_message_tile(RFX_CONTEXT* context, RFX_TILE_JOB* job, STREAM* s)
 {
 	uint8 quantIdxY;
 	uint8 quantIdxCb;
@@ -394,14 +552,49 @@ static void rfx_process_message_tile(RFX_CONTEXT* context, RFX_TILE* tile, STREA
 	DEBUG_RFX("quantIdxY:%d quantIdxCb:%d quantIdxCr:%d xIdx:%d yIdx:%d YLen:%d CbLen:%d CrLen:%d",
 		quantIdxY, quantIdxCb, quantIdxCr, xIdx, yIdx, YLen, CbLen, CrLen);
 
-	tile->x = xIdx * 64;
-	tile->y = yIdx * 64;
+	job->x = xIdx * 64;
+	job->y = yIdx * 64;
+
+	if (job->tile != NULL)
+	{
+		job->tile->x = job->x;
+		job->tile->y = job->y;
+	}
 
-	rfx_decode_rgb(context, s,
-		YLen, context->quants + (quantIdxY * 10),
-		CbLen, context->quants + (quantIdxCb * 10),
-		CrLen, context->quants + (quantIdxCr * 10),
-		tile->data);
+	/* the tile data is only decoded once the whole tileset has been parsed */
+	job->data = stream_get_tail(s);
+	job->YLen = YLen;
+	job->CbLen = CbLen;
+	job->CrLen = CrLen;
+	job->quant_y = context->quants + (quantIdxY * 10);
+	job->quant_cb = context->quants + (quantIdxCb * 10);
+	job->quant_cr = context->quants + (quantIdxCr * 10);
+}
+
+static void rfx_decode_tile_job(RFX_CONTEXT* context, RFX_SCRATCH* scratch, RFX_TILE_JOB* job)
+{
+	if (context->priv->surface != NULL)
+	{
+		rfx_decode_tile_to_surface(context, scratch, job->data,
+			job->YLen, job->quant_y,
+			job->CbLen, job->quant_cb,
+			job->CrLen, job->quant_cr,
+			context->priv->surface, job->x, job->y);
+		return;
+	}
+
+	rfx_decode_tile(context, scratch, job->data,
+		job->YLen, job->quant_y,
+		job->CbLen, job->quant_cb,
+		job->CrLen, job->quant_cr,
+		job->tile->data);
+}
+
+static void rfx_decode_tile_job_threaded(void* arg, int worker, int index)
+{
+	RFX_CONTEXT* context = (RFX_CONTEXT*) arg;
+
+	rfx_decode_tile_job(context, &context->priv->thread_scratch[worker], &context->priv->tile_jobs[index]);
 }
 
 static void rfx_process_message_tileset(RFX_CONTEXT* context, RFX_MESSAGE* message, STREAM* s)
@@ -414,6 +607,8 @@ static void rfx_process_message_tileset(RFX_CONTEXT* context, RFX_MESSAGE* messa
 	uint32* quants;
 	uint8 quant;
 	int pos;
+	int numJobs;
+	uint16 numTiles;
 
 	stream_read_uint16(s, subtype); /* subtype (2 bytes) must be set to CBT_TILESET (0xCAC2) */
 
@@ -435,9 +630,9 @@ static void rfx_process_message_tileset(RFX_CONTEXT* context, RFX_MESSAGE* messa
 		return;
 	}
 
-	stream_read_uint16(s, message->num_tiles); /* numTiles (2 bytes) */
+	stream_read_uint16(s, numTiles); /* numTiles (2 bytes) */
 
-	if (message->num_tiles < 1)
+	if (numTiles < 1)
 	{
 		DEBUG_WARN("no tiles.");
 		return;
@@ -445,10 +640,12 @@ static void rfx_process_message_tileset(RFX_CONTEXT* context, RFX_MESSAGE* messa
 
 	stream_read_uint32(s, tilesDataSize); /* tilesDataSize (4 bytes) */
 
-	if (context->quants != NULL)
-		context->quants = (uint32*) xrealloc((void*) context->quants, context->num_quants * 10 * sizeof(uint32));
-	else
-		context->quants = (uint32*) xmalloc(context->num_quants * 10 * sizeof(uint32));
+	if (context->priv->quants_size < context->num_quants)
+	{
+		context->quants = (uint32*) rfx_pool_realloc(context->priv->pool,
+			context->quants, context->num_quants * 10 * sizeof(uint32));
+		context->priv->quants_size = context->num_quants;
+	}
 	quants = context->quants;
 
 	/* quantVals */
@@ -479,10 +676,29 @@ static void rfx_process_message_tileset(RFX_CONTEXT* context, RFX_MESSAGE* messa
 			context->quants[i * 10 + 8], context->quants[i * 10 + 9]);
 	}
 
-	message->tiles = rfx_pool_get_tiles(context->priv->pool, message->num_tiles);
+	if (context->priv->surface != NULL)
+	{
+		context->priv->surface->rects = message->rects;
+		context->priv->surface->num_rects = message->num_rects;
+	}
+	else
+	{
+		/* tiles of a previous tileset in the same message go back to the pool */
+		rfx_pool_put_tiles(context->priv->pool, message->tiles, message->num_tiles);
+		rfx_pool_message_alloc_tiles(context->priv->pool, message, numTiles);
+	}
+
+	if (context->priv->tile_jobs_size < numTiles)
+	{
+		xfree(context->priv->tile_jobs);
+		context->priv->tile_jobs = (RFX_TILE_JOB*) rfx_pool_realloc(context->priv->pool,
+			NULL, numTiles * sizeof(RFX_TILE_JOB));
+		memset(context->priv->tile_jobs, 0, numTiles * sizeof(RFX_TILE_JOB));
+		context->priv->tile_jobs_size = numTiles;
+	}
 
 	/* tiles */
-	for (i = 0; i < message->num_tiles; i++)
+	for (i = 0; i < numTiles; i++)
 	{
 		/* RFX_TILE */
 		stream_read_uint16(s, blockType); /* blockType (2 bytes), must be set to CBT_TILE (0xCAC3) */
@@ -496,22 +712,33 @@ static void rfx_process_message_tileset(RFX_CONTEXT* context, RFX_MESSAGE* messa
 			break;
 		}
 
-		rfx_process_message_tile(context, message->tiles[i], s);
+		context->priv->tile_jobs[i].tile = (context->priv->surface == NULL) ? message->tiles[i] : NULL;
+		rfx_process_message_tile(context, &context->priv->tile_jobs[i], s);
 
 		stream_set_pos(s, pos);
 	}
+
+	numJobs = i;
+
+	if (context->priv->thread_pool != NULL)
+	{
+		freerdp_thread_pool_run(context->priv->thread_pool,
+			rfx_decode_tile_job_threaded, context, numJobs);
+	}
+	else
+	{
+		for (i = 0; i < numJobs; i++)
+			rfx_decode_tile_job(context, &context->priv->scratch, &context->priv->tile_jobs[i]);
+	}
 }
 
-RFX_MESSAGE* rfx_process_message(RFX_CONTEXT* context, uint8* data, uint32 length)
+static void rfx_process_message_blocks(RFX_CONTEXT* context, RFX_MESSAGE* message, uint8* data, uint32 length)
 {
 	int pos;
-	STREAM* s;
 	uint32 blockLen;
 	uint32 blockType;
-	RFX_MESSAGE* message;
+	STREAM* s = context->priv->stream;
 
-	s = stream_new(0);
-	message = xnew(RFX_MESSAGE);
 	stream_attach(s, data, length);
 
 	while (stream_get_left(s) > 6)
@@ -581,7 +808,50 @@ RFX_MESSAGE* rfx_process_message(RFX_CONTEXT* context, uint8* data, uint32 lengt
 	}
 
 	stream_detach(s);
-	stream_free(s);
+}
+
+RFX_MESSAGE* rfx_process_message(RFX_CONTEXT* context, uint8* data, uint32 length)
+{
+	RFX_MESSAGE* message;
+
+	message = rfx_pool_get_message(context->priv->pool);
+	rfx_process_message_blocks(context, message, data, length);
+
+	return message;
+}
+
+/**
+ * Decode a message straight into a caller-supplied surface instead of into
+ * pooled tiles. Only the pixels covered by the message rects are written,
+ * translated by (dest_left, dest_top) and clipped to dst_width x dst_height.
+ * The returned message carries the rects, so that the caller can invalidate
+ * them, but no tiles. Returns NULL if dst_format is not supported.
+ */
+RFX_MESSAGE* rfx_process_message_to_surface(RFX_CONTEXT* context, uint8* data, uint32 length,
+	uint8* dst, int dst_stride, RFX_PIXEL_FORMAT dst_format, int dst_width, int dst_height,
+	int dest_left, int dest_top)
+{
+	RFX_SURFACE surface;
+	RFX_MESSAGE* message;
+
+	if (rfx_decode_format_bpp(dst_format) == 0)
+		return NULL;
+
+	surface.data = dst;
+	surface.stride = dst_stride;
+	surface.format = dst_format;
+	surface.width = dst_width;
+	surface.height = dst_height;
+	surface.left = dest_left;
+	surface.top = dest_top;
+	surface.rects = NULL;
+	surface.num_rects = 0;
+
+	message = rfx_pool_get_message(context->priv->pool);
+
+	context->priv->surface = &surface;
+	rfx_process_message_blocks(context, message, data, length);
+	context->priv->surface = NULL;
 
 	return message;
 }
@@ -609,17 +879,7 @@ RFX_RECT* rfx_message_get_rect(RFX_MESSAGE* message, int index)
 void rfx_message_free(RFX_CONTEXT* context, RFX_MESSAGE* message)
 {
 	if (message != NULL)
-	{
-		xfree(message->rects);
-
-		if (message->tiles != NULL)
-		{
-			rfx_pool_put_tiles(context->priv->pool, message->tiles, message->num_tiles);
-			xfree(message->tiles);
-		}
-
-		xfree(message);
-	}
+		rfx_pool_put_message(context->priv->pool, message);
 }
 
 static void rfx_compose_message_sync(RFX_CONTEXT* context, STREAM* s)
@@ -732,7 +992,7 @@ static void rfx_compose_message_region(RFX_CONTEXT* context, STREAM* s,
 	stream_write_uint16(s, 1); /* numTilesets */
 }
 
-static void rfx_compose_message_tile(RFX_CONTEXT* context, STREAM* s,
+static void rfx_compose_message_tile(RFX_CONTEXT* context, RFX_SCRATCH* scratch, STREAM* s,
 	uint8* tile_data, int tile_width, int tile_height, int rowstride,
 	const uint32* quantVals, int quantIdxY, int quantIdxCb, int quantIdxCr,
 	int xIdx, int yIdx)
@@ -755,7 +1015,7 @@ static void rfx_compose_message_tile(RFX_CONTEXT* context, STREAM* s,
 
 	stream_seek(s, 6); /* YLen, CbLen, CrLen */
 
-	rfx_encode_rgb(context, tile_data, tile_width, tile_height, rowstride,
+	rfx_encode_tile(context, scratch, tile_data, tile_width, tile_height, rowstride,
 		quantVals + quantIdxY * 10, quantVals + quantIdxCb * 10, quantVals + quantIdxCr * 10,
 		s, &YLen, &CbLen, &CrLen);
 
@@ -774,8 +1034,83 @@ static void rfx_compose_message_tile(RFX_CONTEXT* context, STREAM* s,
 	stream_set_pos(s, end_pos);
 }
 
+struct _RFX_TILESET_ENCODER
+{
+	RFX_CONTEXT* context;
+	uint8* image_data;
+	int width;
+	int height;
+	int rowstride;
+	int numTilesX;
+	int numTilesY;
+	const uint32* quantVals;
+	int quantIdxY;
+	int quantIdxCb;
+	int quantIdxCr;
+	const int* tiles; /* tile indices to encode, or NULL for all of them */
+};
+typedef struct _RFX_TILESET_ENCODER RFX_TILESET_ENCODER;
+
+static void rfx_compose_message_tile_index(RFX_TILESET_ENCODER* encoder,
+	RFX_SCRATCH* scratch, STREAM* s, int index)
+{
+	int xIdx;
+	int yIdx;
+
+	if (encoder->tiles != NULL)
+		index = encoder->tiles[index];
+
+	xIdx = index % encoder->numTilesX;
+	yIdx = index / encoder->numTilesX;
+
+	rfx_compose_message_tile(encoder->context, scratch, s,
+		encoder->image_data + yIdx * 64 * encoder->rowstride + xIdx * 8 * encoder->context->bits_per_pixel,
+		(xIdx < encoder->numTilesX - 1) ? 64 : encoder->width - xIdx * 64,
+		(yIdx < encoder->numTilesY - 1) ? 64 : encoder->height - yIdx * 64,
+		encoder->rowstride, encoder->quantVals,
+		encoder->quantIdxY, encoder->quantIdxCb, encoder->quantIdxCr, xIdx, yIdx);
+}
+
+static void rfx_compose_message_tile_threaded(void* arg, int worker, int index)
+{
+	RFX_TILESET_ENCODER* encoder = (RFX_TILESET_ENCODER*) arg;
+	RFX_CONTEXT_PRIV* priv = encoder->context->priv;
+	STREAM* s = priv->tile_streams[index];
+
+	stream_set_pos(s, 0);
+	rfx_compose_message_tile_index(encoder, &priv->thread_scratch[worker], s, index);
+}
+
+static void rfx_compose_message_tiles_threaded(RFX_CONTEXT* context, STREAM* s,
+	RFX_TILESET_ENCODER* encoder, int numTiles)
+{
+	int i;
+	int length;
+	RFX_CONTEXT_PRIV* priv = context->priv;
+
+	if (priv->tile_streams_size < numTiles)
+	{
+		priv->tile_streams = xrenew(STREAM*, priv->tile_streams, numTiles);
+
+		for (i = priv->tile_streams_size; i < numTiles; i++)
+			priv->tile_streams[i] = stream_new(4096 * 3);
+
+		priv->tile_streams_size = numTiles;
+	}
+
+	freerdp_thread_pool_run(priv->thread_pool, rfx_compose_message_tile_threaded, encoder, numTiles);
+
+	/* each tile block is self-contained, so appending them in order gives the serial bitstream */
+	for (i = 0; i < numTiles; i++)
+	{
+		length = stream_get_pos(priv->tile_streams[i]);
+		stream_check_size(s, length);
+		stream_write(s, stream_get_head(priv->tile_streams[i]), length);
+	}
+}
+
 static void rfx_compose_message_tileset(RFX_CONTEXT* context, STREAM* s,
-	uint8* image_data, int width, int height, int rowstride)
+	uint8* image_data, int width, int height, int rowstride, const int* tiles, int numTiles)
 {
 	int size;
 	int start_pos, end_pos;
@@ -786,14 +1121,26 @@ static void rfx_compose_message_tileset(RFX_CONTEXT* context, STREAM* s,
 	int quantIdxY;
 	int quantIdxCb;
 	int quantIdxCr;
-	int numTiles;
 	int numTilesX;
 	int numTilesY;
-	int xIdx;
-	int yIdx;
 	int tilesDataSize;
+	RFX_TILESET_ENCODER encoder;
+
+	numTilesX = (width + 63) / 64;
+	numTilesY = (height + 63) / 64;
 
-	if (context->num_quants == 0)
+	if (tiles == NULL)
+		numTiles = numTilesX * numTilesY;
+
+	if (context->priv->rate_target_bits > 0)
+	{
+		numQuants = 2;
+		quantVals = rfx_rate_select(context, numTiles);
+		quantIdxY = 0;
+		quantIdxCb = 1;
+		quantIdxCr = 1;
+	}
+	else if (context->num_quants == 0)
 	{
 		numQuants = 1;
 		quantVals = rfx_default_quantization_values;
@@ -810,10 +1157,6 @@ static void rfx_compose_message_tileset(RFX_CONTEXT* context, STREAM* s,
 		quantIdxCr = context->quant_idx_cr;
 	}
 
-	numTilesX = (width + 63) / 64;
-	numTilesY = (height + 63) / 64;
-	numTiles = numTilesX * numTilesY;
-
 	size = 22 + numQuants * 5;
 	stream_check_size(s, size);
 	start_pos = stream_get_pos(s);
@@ -839,18 +1182,31 @@ static void rfx_compose_message_tileset(RFX_CONTEXT* context, STREAM* s,
 
 	DEBUG_RFX("width:%d height:%d rowstride:%d", width, height, rowstride);
 
+	encoder.context = context;
+	encoder.image_data = image_data;
+	encoder.width = width;
+	encoder.height = height;
+	encoder.rowstride = rowstride;
+	encoder.numTilesX = numTilesX;
+	encoder.numTilesY = numTilesY;
+	encoder.quantVals = quantVals;
+	encoder.quantIdxY = quantIdxY;
+	encoder.quantIdxCb = quantIdxCb;
+	encoder.quantIdxCr = quantIdxCr;
+	encoder.tiles = tiles;
+
 	end_pos = stream_get_pos(s);
-	for (yIdx = 0; yIdx < numTilesY; yIdx++)
+
+	if (context->priv->thread_pool != NULL)
 	{
-		for (xIdx = 0; xIdx < numTilesX; xIdx++)
-		{
-			rfx_compose_message_tile(context, s,
-				image_data + yIdx * 64 * rowstride + xIdx * 8 * context->bits_per_pixel,
-				(xIdx < numTilesX - 1) ? 64 : width - xIdx * 64,
-				(yIdx < numTilesY - 1) ? 64 : height - yIdx * 64,
-				rowstride, quantVals, quantIdxY, quantIdxCb, quantIdxCr, xIdx, yIdx);
-		}
+		rfx_compose_message_tiles_threaded(context, s, &encoder, numTiles);
 	}
+	else
+	{
+		for (i = 0; i < numTiles; i++)
+			rfx_compose_message_tile_index(&encoder, &context->priv->scratch, s, i);
+	}
+
 	tilesDataSize = stream_get_pos(s) - end_pos;
 	size += tilesDataSize;
 	end_pos = stream_get_pos(s);
@@ -873,15 +1229,306 @@ static void rfx_compose_message_frame_end(RFX_CONTEXT* context, STREAM* s)
 	stream_write_uint8(s, 0); /* CodecChannelT.channelId */
 }
 
+#define RFX_TILE_HASH_PRIME 0x100000001B3ULL
+
+/**
+ * Fingerprint the source pixels of one tile. Four independent lanes keep the
+ * multiplies from serializing; within a lane every step is a bijection of
+ * the running value, so a change confined to one 8-byte word always changes
+ * the fingerprint.
+ */
+static uint64 rfx_tile_hash(const uint8* data, int row_bytes, int height, int rowstride)
+{
+	int x, y;
+	uint64 w[4];
+	uint64 h[4];
+	const uint8* row;
+
+	h[0] = 0xCBF29CE484222325ULL ^ ((uint64) row_bytes << 32) ^ height;
+	h[1] = h[0] + 1;
+	h[2] = h[0] + 2;
+	h[3] = h[0] + 3;
+
+	for (y = 0; y < height; y++)
+	{
+		row = data + y * rowstride;
+
+		for (x = 0; x + 32 <= row_bytes; x += 32)
+		{
+			memcpy(w, row + x, 32);
+			h[0] = (h[0] ^ w[0]) * RFX_TILE_HASH_PRIME;
+			h[1] = (h[1] ^ w[1]) * RFX_TILE_HASH_PRIME;
+			h[2] = (h[2] ^ w[2]) * RFX_TILE_HASH_PRIME;
+			h[3] = (h[3] ^ w[3]) * RFX_TILE_HASH_PRIME;
+		}
+
+		for (; x < row_bytes; x++)
+			h[0] = (h[0] ^ row[x]) * RFX_TILE_HASH_PRIME;
+	}
+
+	h[0] ^= (h[1] << 16 | h[1] >> 48) ^ (h[2] << 32 | h[2] >> 32) ^ (h[3] << 48 | h[3] >> 16);
+	h[0] ^= h[0] >> 29;
+
+	/* 0 marks an unknown tile */
+	return (h[0] != 0) ? h[0] : 1;
+}
+
+static void rfx_tile_hash_threaded(void* arg, int worker, int index)
+{
+	RFX_TILESET_ENCODER* encoder = (RFX_TILESET_ENCODER*) arg;
+	RFX_CONTEXT_PRIV* priv = encoder->context->priv;
+	int bytesPerPixel = encoder->context->bits_per_pixel / 8;
+	int tileIdx = encoder->tiles[index];
+	int xIdx = tileIdx % encoder->numTilesX;
+	int yIdx = tileIdx / encoder->numTilesX;
+	int tile_width = MIN(64, encoder->width - xIdx * 64);
+	int tile_height = MIN(64, encoder->height - yIdx * 64);
+
+	priv->frame_hashes[index] = rfx_tile_hash(
+		encoder->image_data + yIdx * 64 * encoder->rowstride + xIdx * 64 * bytesPerPixel,
+		tile_width * bytesPerPixel, tile_height, encoder->rowstride);
+}
+
+static void rfx_add_dirty_rect(RFX_CONTEXT_PRIV* priv, int left, int top, int right, int bottom)
+{
+	RFX_RECT* rect;
+
+	if (priv->num_dirty_rects >= priv->dirty_rects_size)
+	{
+		priv->dirty_rects_size = MAX(16, priv->dirty_rects_size * 2);
+		priv->dirty_rects = xrenew(RFX_RECT, priv->dirty_rects, priv->dirty_rects_size);
+	}
+
+	rect = &priv->dirty_rects[priv->num_dirty_rects++];
+	rect->x = left;
+	rect->y = top;
+	rect->width = right - left;
+	rect->height = bottom - top;
+}
+
+/**
+ * Whether the tile at index differs from what was last sent at its
+ * position. Tiles beyond the cache always do.
+ */
+static boolean rfx_tile_changed(RFX_CONTEXT_PRIV* priv, int index, int numTilesX, uint64 hash)
+{
+	int xIdx = index % numTilesX;
+	int yIdx = index / numTilesX;
+
+	if (xIdx >= priv->tile_hashes_cols || yIdx >= priv->tile_hashes_rows)
+		return true;
+
+	return priv->tile_hashes[yIdx * priv->tile_hashes_cols + xIdx] != hash;
+}
+
+/**
+ * Find the tiles that are covered by the caller's rects and whose pixels
+ * differ from what was last sent at the same position. Their indices end up
+ * in priv->dirty_tiles, with their fingerprints in priv->frame_hashes, and
+ * each horizontal run of dirty tiles becomes one rect in priv->dirty_rects.
+ * The whole of a dirty tile is sent, since its fingerprint covers all of
+ * its pixels. Under rate control, unchanged tiles that were sent at a
+ * coarser level than this frame gets are dirty as well, as many as the
+ * budget has room for at that level. Returns the number of dirty tiles.
+ */
+static int rfx_compose_message_find_dirty_tiles(RFX_CONTEXT* context,
+	const RFX_RECT* rects, int num_rects, uint8* image_data, int width, int height, int rowstride)
+{
+	int i, j;
+	int xIdx, yIdx;
+	int run_start;
+	int numTiles;
+	int numCandidates;
+	int numChanged;
+	int numDirty;
+	int level;
+	int cols, rows;
+	boolean changed;
+	RFX_TILESET_ENCODER encoder;
+	RFX_CONTEXT_PRIV* priv = context->priv;
+
+	encoder.context = context;
+	encoder.image_data = image_data;
+	encoder.width = width;
+	encoder.height = height;
+	encoder.rowstride = rowstride;
+	encoder.numTilesX = (width + 63) / 64;
+	encoder.numTilesY = (height + 63) / 64;
+	numTiles = encoder.numTilesX * encoder.numTilesY;
+
+	/* the cache covers the desktop, tiles beyond it are always sent */
+	cols = (context->width > 0) ? (context->width + 63) / 64 : encoder.numTilesX;
+	rows = (context->height > 0) ? (context->height + 63) / 64 : encoder.numTilesY;
+
+	if (priv->tile_hashes == NULL || priv->tile_hashes_cols != cols || priv->tile_hashes_rows != rows)
+	{
+		xfree(priv->tile_hashes);
+		xfree(priv->tile_levels);
+		priv->tile_hashes = xnew0(uint64, cols * rows);
+		priv->tile_levels = xnew0(uint8, cols * rows);
+		priv->tile_hashes_cols = cols;
+		priv->tile_hashes_rows = rows;
+	}
+
+	if (priv->dirty_tiles_size < numTiles)
+	{
+		xfree(priv->dirty_tiles);
+		xfree(priv->frame_hashes);
+		priv->dirty_tiles = (int*) xmalloc(numTiles * sizeof(int));
+		priv->frame_hashes = (uint64*) xmalloc(numTiles * sizeof(uint64));
+		priv->dirty_tiles_size = numTiles;
+	}
+
+	/* only tiles touched by a rect are candidates */
+	numCandidates = 0;
+
+	for (i = 0; i < numTiles; i++)
+	{
+		xIdx = i % encoder.numTilesX;
+		yIdx = i / encoder.numTilesX;
+
+		for (j = 0; j < num_rects; j++)
+		{
+			if (rects[j].x < xIdx * 64 + 64 && rects[j].x + rects[j].width > xIdx * 64 &&
+				rects[j].y < yIdx * 64 + 64 && rects[j].y + rects[j].height > yIdx * 64)
+			{
+				priv->dirty_tiles[numCandidates++] = i;
+				break;
+			}
+		}
+	}
+
+	encoder.tiles = priv->dirty_tiles;
+	freerdp_thread_pool_run(priv->thread_pool, rfx_tile_hash_threaded, &encoder, numCandidates);
+
+	/* the level this frame is sent at, given the tiles that changed */
+	numChanged = 0;
+
+	for (i = 0; i < numCandidates; i++)
+	{
+		if (rfx_tile_changed(priv, priv->dirty_tiles[i], encoder.numTilesX, priv->frame_hashes[i]))
+			numChanged++;
+	}
+
+	level = (priv->rate_target_bits > 0) ? rfx_rate_level(context, numChanged) : 0;
+
+	/* keep the candidates that changed or can be improved, in tile order */
+	numDirty = 0;
+
+	for (i = 0; i < numCandidates; i++)
+	{
+		xIdx = priv->dirty_tiles[i] % encoder.numTilesX;
+		yIdx = priv->dirty_tiles[i] / encoder.numTilesX;
+		changed = rfx_tile_changed(priv, priv->dirty_tiles[i], encoder.numTilesX, priv->frame_hashes[i]);
+
+		if (!changed)
+		{
+			if (priv->tile_levels[yIdx * cols + xIdx] <= level)
+				continue;
+
+			if (!rfx_rate_fits(context, numChanged + 1, level))
+				continue;
+
+			numChanged++;
+		}
+
+		priv->frame_hashes[numDirty] = priv->frame_hashes[i];
+		priv->dirty_tiles[numDirty++] = priv->dirty_tiles[i];
+	}
+
+	/* one rect per horizontal run of dirty tiles, clipped to the image */
+	priv->num_dirty_rects = 0;
+
+	for (i = 0; i < numDirty; i = j)
+	{
+		run_start = priv->dirty_tiles[i];
+
+		for (j = i + 1; j < numDirty; j++)
+		{
+			if (priv->dirty_tiles[j] != run_start + (j - i) ||
+				priv->dirty_tiles[j] % encoder.numTilesX == 0)
+				break;
+		}
+
+		xIdx = run_start % encoder.numTilesX;
+		yIdx = run_start / encoder.numTilesX;
+
+		rfx_add_dirty_rect(priv, xIdx * 64, yIdx * 64,
+			MIN((xIdx + j - i) * 64, width), MIN(yIdx * 64 + 64, height));
+	}
+
+	return numDirty;
+}
+
+/**
+ * Remember the fingerprints of the dirty tiles and the level they were sent
+ * at, once the frame that carries them has been written.
+ */
+static void rfx_compose_message_commit_tiles(RFX_CONTEXT* context, int numTiles, int width)
+{
+	int i;
+	int xIdx, yIdx;
+	int level;
+	int numTilesX = (width + 63) / 64;
+	RFX_CONTEXT_PRIV* priv = context->priv;
+
+	level = (priv->rate_target_bits > 0) ? priv->rate_level : 0;
+
+	for (i = 0; i < numTiles; i++)
+	{
+		xIdx = priv->dirty_tiles[i] % numTilesX;
+		yIdx = priv->dirty_tiles[i] / numTilesX;
+
+		if (xIdx < priv->tile_hashes_cols && yIdx < priv->tile_hashes_rows)
+		{
+			priv->tile_hashes[yIdx * priv->tile_hashes_cols + xIdx] = priv->frame_hashes[i];
+			priv->tile_levels[yIdx * priv->tile_hashes_cols + xIdx] = level;
+		}
+	}
+}
+
 static void rfx_compose_message_data(RFX_CONTEXT* context, STREAM* s,
 	const RFX_RECT* rects, int num_rects, uint8* image_data, int width, int height, int rowstride)
 {
+	int start_pos;
+	int numTiles = 0;
+	const int* tiles = NULL;
+
+	if (context->priv->tile_cache)
+	{
+		numTiles = rfx_compose_message_find_dirty_tiles(context,
+			rects, num_rects, image_data, width, height, rowstride);
+
+		/* nothing changed, so there is no frame to send */
+		if (numTiles == 0)
+			return;
+
+		tiles = context->priv->dirty_tiles;
+		rects = context->priv->dirty_rects;
+		num_rects = context->priv->num_dirty_rects;
+	}
+
+	start_pos = stream_get_pos(s);
+
 	rfx_compose_message_frame_begin(context, s);
 	rfx_compose_message_region(context, s, rects, num_rects);
-	rfx_compose_message_tileset(context, s, image_data, width, height, rowstride);
+	rfx_compose_message_tileset(context, s, image_data, width, height, rowstride, tiles, numTiles);
 	rfx_compose_message_frame_end(context, s);
+
+	if (tiles == NULL)
+		numTiles = ((width + 63) / 64) * ((height + 63) / 64);
+	else
+		rfx_compose_message_commit_tiles(context, numTiles, width);
+
+	rfx_rate_update(context, numTiles, (stream_get_pos(s) - start_pos) * 8);
 }
 
+/**
+ * Encode the parts of image_data covered by rects. With the tile cache
+ * enabled, only the tiles touched by rects that changed are encoded, and
+ * the region is those whole tiles; if no tile changed, no frame is written
+ * at all.
+ */
 FREERDP_API void rfx_compose_message(RFX_CONTEXT* context, STREAM* s,
 	const RFX_RECT* rects, int num_rects, uint8* image_data, int width, int height, int rowstride)
 {
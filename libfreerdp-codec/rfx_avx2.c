@@ -0,0 +1,624 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * RemoteFX Codec Library - AVX2 Optimizations
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Unlike the SSE2 routines, which trade precision for speed, every routine in
+ * this file produces exactly the same output as the C reference in rfx_dwt.c,
+ * rfx_quantization.c, rfx_decode.c and rfx_encode.c. The C code computes in
+ * int before truncating to sint16, so wherever an intermediate sum could leave
+ * the 16 bit range it is rebuilt here from terms that cannot overflow.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <immintrin.h>
+
+#include "rfx_types.h"
+#include "rfx_encode.h"
+#include "rfx_avx2.h"
+
+#define _mm256_between_epi16(_val, _min, _max) \
+	do { _val = _mm256_min_epi16(_max, _mm256_max_epi16(_val, _min)); } while (0)
+
+/* 32 bit lanes holding the 16 bit pair (_lo, _hi), the operand layout of _mm256_madd_epi16 */
+#define _mm256_set1_pair_epi16(_lo, _hi) \
+	_mm256_set1_epi32((int) (((uint32) (uint16) (_hi) << 16) | (uint16) (_lo)))
+
+/* (a + b + 1) >> 1, computed on unsigned values biased by 0x8000 */
+static INLINE __m256i avg_round_epi16(__m256i a, __m256i b)
+{
+	__m256i bias = _mm256_set1_epi16((short) 0x8000);
+
+	return _mm256_xor_si256(_mm256_avg_epu16(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias)), bias);
+}
+
+/* (a + b) >> 1 */
+static INLINE __m256i avg_floor_epi16(__m256i a, __m256i b)
+{
+	__m256i sum = _mm256_add_epi16(_mm256_srai_epi16(a, 1), _mm256_srai_epi16(b, 1));
+
+	return _mm256_add_epi16(sum, _mm256_and_si256(_mm256_and_si256(a, b), _mm256_set1_epi16(1)));
+}
+
+/* (a - b) >> 1 */
+static INLINE __m256i half_diff_epi16(__m256i a, __m256i b)
+{
+	__m256i diff = _mm256_sub_epi16(_mm256_srai_epi16(a, 1), _mm256_srai_epi16(b, 1));
+
+	return _mm256_sub_epi16(diff, _mm256_and_si256(_mm256_andnot_si256(a, b), _mm256_set1_epi16(1)));
+}
+
+/* { p[15], a[0], ..., a[14] } */
+static INLINE __m256i prev_epi16(__m256i p, __m256i a)
+{
+	return _mm256_alignr_epi8(a, _mm256_permute2x128_si256(p, a, 0x21), 14);
+}
+
+/* { a[1], ..., a[15], b[0] } */
+static INLINE __m256i next_epi16(__m256i a, __m256i b)
+{
+	return _mm256_alignr_epi8(_mm256_permute2x128_si256(a, b, 0x21), a, 2);
+}
+
+/**
+ * The sub-bands are processed as flat arrays, 16 coefficients at a time.
+ * These masks select the lanes of the chunk starting at index that hold the
+ * first or the last coefficient of a row, where the neighbour is mirrored.
+ */
+static INLINE __m256i row_start_mask(int index, int width)
+{
+	__m256i ramp = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	__m256i col = _mm256_and_si256(_mm256_add_epi16(_mm256_set1_epi16(index), ramp), _mm256_set1_epi16(width - 1));
+
+	return _mm256_cmpeq_epi16(col, _mm256_setzero_si256());
+}
+
+static INLINE __m256i row_end_mask(int index, int width)
+{
+	__m256i ramp = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	__m256i col = _mm256_and_si256(_mm256_add_epi16(_mm256_set1_epi16(index), ramp), _mm256_set1_epi16(width - 1));
+
+	return _mm256_cmpeq_epi16(col, _mm256_set1_epi16(width - 1));
+}
+
+static void rfx_decode_ycbcr_to_rgb_8_avx2(__m128i y16, __m128i cb16, __m128i cr16,
+	__m256i* r, __m256i* g, __m256i* b)
+{
+	__m256i y = _mm256_cvtepi16_epi32(y16);
+	__m256i cb = _mm256_cvtepi16_epi32(cb16);
+	__m256i cr = _mm256_cvtepi16_epi32(cr16);
+
+	/* see rfx_decode_ycbcr_to_rgb() for the factors */
+	y = _mm256_slli_epi32(_mm256_add_epi32(y, _mm256_set1_epi32(4096)), 16);
+
+	*r = _mm256_add_epi32(y, _mm256_mullo_epi32(cr, _mm256_set1_epi32(91947)));
+	*g = _mm256_sub_epi32(y, _mm256_mullo_epi32(cb, _mm256_set1_epi32(22544)));
+	*g = _mm256_sub_epi32(*g, _mm256_mullo_epi32(cr, _mm256_set1_epi32(46792)));
+	*b = _mm256_add_epi32(y, _mm256_mullo_epi32(cb, _mm256_set1_epi32(115998)));
+
+	*r = _mm256_srai_epi32(*r, 21);
+	*g = _mm256_srai_epi32(*g, 21);
+	*b = _mm256_srai_epi32(*b, 21);
+}
+
+/* packs_epi32 works per 128 bit lane, the permute restores the element order */
+static INLINE __m256i pack_epi32_ordered(__m256i lo, __m256i hi)
+{
+	return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+}
+
+static void rfx_decode_ycbcr_to_rgb_avx2(sint16* y_r_buffer, sint16* cb_g_buffer, sint16* cr_b_buffer)
+{
+	__m256i zero = _mm256_setzero_si256();
+	__m256i max = _mm256_set1_epi16(255);
+	__m256i y, cb, cr;
+	__m256i r_lo, g_lo, b_lo;
+	__m256i r_hi, g_hi, b_hi;
+	__m256i r, g, b;
+	int i;
+
+	for (i = 0; i < 4096; i += 16)
+	{
+		y = _mm256_loadu_si256((__m256i*) &y_r_buffer[i]);
+		cb = _mm256_loadu_si256((__m256i*) &cb_g_buffer[i]);
+		cr = _mm256_loadu_si256((__m256i*) &cr_b_buffer[i]);
+
+		rfx_decode_ycbcr_to_rgb_8_avx2(_mm256_castsi256_si128(y), _mm256_castsi256_si128(cb),
+			_mm256_castsi256_si128(cr), &r_lo, &g_lo, &b_lo);
+		rfx_decode_ycbcr_to_rgb_8_avx2(_mm256_extracti128_si256(y, 1), _mm256_extracti128_si256(cb, 1),
+			_mm256_extracti128_si256(cr, 1), &r_hi, &g_hi, &b_hi);
+
+		r = pack_epi32_ordered(r_lo, r_hi);
+		g = pack_epi32_ordered(g_lo, g_hi);
+		b = pack_epi32_ordered(b_lo, b_hi);
+
+		_mm256_between_epi16(r, zero, max);
+		_mm256_between_epi16(g, zero, max);
+		_mm256_between_epi16(b, zero, max);
+
+		_mm256_storeu_si256((__m256i*) &y_r_buffer[i], r);
+		_mm256_storeu_si256((__m256i*) &cb_g_buffer[i], g);
+		_mm256_storeu_si256((__m256i*) &cr_b_buffer[i], b);
+	}
+}
+
+/* The encoded YCbCr coefficients are represented as 11.5 fixed-point numbers. See rfx_encode.c */
+static INLINE void rfx_encode_ycbcr_avx2(__m256i r, __m256i g, __m256i b, __m256i* y_out, __m256i* cb_out, __m256i* cr_out)
+{
+	__m256i zero = _mm256_setzero_si256();
+	__m256i min = _mm256_set1_epi16(-4096);
+	__m256i max = _mm256_set1_epi16(4095);
+	__m256i c4096 = _mm256_set1_epi32(4096);
+
+	__m256i y_rg = _mm256_set1_pair_epi16(9798, 19235);
+	__m256i y_b = _mm256_set1_pair_epi16(3735, 0);
+	__m256i cb_rg = _mm256_set1_pair_epi16(-5535, -10868);
+	__m256i cb_b = _mm256_set1_pair_epi16(16403, 0);
+	__m256i cr_rg = _mm256_set1_pair_epi16(16377, -13714);
+	__m256i cr_b = _mm256_set1_pair_epi16(-2663, 0);
+
+	__m256i rg_lo, rg_hi, b_lo, b_hi;
+	__m256i lo, hi;
+	__m256i y, cb, cr;
+
+	/* r*f_r + g*f_g + b*f_b in 32 bits, both halves keep the in-lane order of packs_epi32 */
+	rg_lo = _mm256_unpacklo_epi16(r, g);
+	rg_hi = _mm256_unpackhi_epi16(r, g);
+	b_lo = _mm256_unpacklo_epi16(b, zero);
+	b_hi = _mm256_unpackhi_epi16(b, zero);
+
+	lo = _mm256_add_epi32(_mm256_madd_epi16(rg_lo, y_rg), _mm256_madd_epi16(b_lo, y_b));
+	hi = _mm256_add_epi32(_mm256_madd_epi16(rg_hi, y_rg), _mm256_madd_epi16(b_hi, y_b));
+	lo = _mm256_sub_epi32(_mm256_srai_epi32(lo, 10), c4096);
+	hi = _mm256_sub_epi32(_mm256_srai_epi32(hi, 10), c4096);
+	y = _mm256_packs_epi32(lo, hi);
+
+	lo = _mm256_add_epi32(_mm256_madd_epi16(rg_lo, cb_rg), _mm256_madd_epi16(b_lo, cb_b));
+	hi = _mm256_add_epi32(_mm256_madd_epi16(rg_hi, cb_rg), _mm256_madd_epi16(b_hi, cb_b));
+	cb = _mm256_packs_epi32(_mm256_srai_epi32(lo, 10), _mm256_srai_epi32(hi, 10));
+
+	lo = _mm256_add_epi32(_mm256_madd_epi16(rg_lo, cr_rg), _mm256_madd_epi16(b_lo, cr_b));
+	hi = _mm256_add_epi32(_mm256_madd_epi16(rg_hi, cr_rg), _mm256_madd_epi16(b_hi, cr_b));
+	cr = _mm256_packs_epi32(_mm256_srai_epi32(lo, 10), _mm256_srai_epi32(hi, 10));
+
+	_mm256_between_epi16(y, min, max);
+	_mm256_between_epi16(cb, min, max);
+	_mm256_between_epi16(cr, min, max);
+
+	*y_out = y;
+	*cb_out = cb;
+	*cr_out = cr;
+}
+
+static void rfx_encode_rgb_to_ycbcr_avx2(sint16* y_r_buffer, sint16* cb_g_buffer, sint16* cr_b_buffer)
+{
+	__m256i r, g, b;
+	__m256i y, cb, cr;
+	int i;
+
+	for (i = 0; i < 4096; i += 16)
+	{
+		r = _mm256_loadu_si256((__m256i*) &y_r_buffer[i]);
+		g = _mm256_loadu_si256((__m256i*) &cb_g_buffer[i]);
+		b = _mm256_loadu_si256((__m256i*) &cr_b_buffer[i]);
+
+		rfx_encode_ycbcr_avx2(r, g, b, &y, &cb, &cr);
+
+		_mm256_storeu_si256((__m256i*) &y_r_buffer[i], y);
+		_mm256_storeu_si256((__m256i*) &cb_g_buffer[i], cb);
+		_mm256_storeu_si256((__m256i*) &cr_b_buffer[i], cr);
+	}
+}
+
+/* 16 pixels to 16 bit r, g and b lanes, expanded like rfx_encode_format_rgb() */
+static INLINE void rfx_unpack_rgb_avx2(const uint8* src, RFX_PIXEL_FORMAT pixel_format, __m256i* r, __m256i* g, __m256i* b)
+{
+	__m256i mask = _mm256_set1_epi32(0xFF);
+	__m256i lo, hi, px;
+
+	switch (pixel_format)
+	{
+		case RFX_PIXEL_FORMAT_BGRA:
+		case RFX_PIXEL_FORMAT_RGBA:
+			lo = _mm256_loadu_si256((__m256i*) src);
+			hi = _mm256_loadu_si256((__m256i*) (src + 32));
+			*b = pack_epi32_ordered(_mm256_and_si256(lo, mask), _mm256_and_si256(hi, mask));
+			*g = pack_epi32_ordered(_mm256_and_si256(_mm256_srli_epi32(lo, 8), mask),
+				_mm256_and_si256(_mm256_srli_epi32(hi, 8), mask));
+			*r = pack_epi32_ordered(_mm256_and_si256(_mm256_srli_epi32(lo, 16), mask),
+				_mm256_and_si256(_mm256_srli_epi32(hi, 16), mask));
+
+			if (pixel_format == RFX_PIXEL_FORMAT_RGBA)
+			{
+				px = *r;
+				*r = *b;
+				*b = px;
+			}
+			break;
+
+		default:
+			px = _mm256_loadu_si256((__m256i*) src);
+			*b = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(px, 8), _mm256_set1_epi16(0xF8)),
+				_mm256_srli_epi16(px, 13));
+			*g = _mm256_and_si256(_mm256_srli_epi16(px, 3), _mm256_set1_epi16(0xFC));
+			*r = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(px, 3), _mm256_set1_epi16(0xF8)),
+				_mm256_and_si256(_mm256_srli_epi16(px, 2), _mm256_set1_epi16(0x07)));
+
+			if (pixel_format == RFX_PIXEL_FORMAT_RGB565_LE)
+			{
+				px = *r;
+				*r = *b;
+				*b = px;
+			}
+			break;
+	}
+}
+
+static boolean rfx_encode_format_rgb_to_ycbcr_avx2(const uint8* rgb_data, int width, int height, int rowstride,
+	RFX_PIXEL_FORMAT pixel_format, sint16* y_buf, sint16* cb_buf, sint16* cr_buf)
+{
+	int x, y;
+	int bpp;
+	const uint8* src;
+	__m256i r, g, b;
+	__m256i row[64 * 4 / sizeof(__m256i)];
+
+	switch (pixel_format)
+	{
+		case RFX_PIXEL_FORMAT_BGRA:
+		case RFX_PIXEL_FORMAT_RGBA:
+			bpp = 4;
+			break;
+		case RFX_PIXEL_FORMAT_BGR565_LE:
+		case RFX_PIXEL_FORMAT_RGB565_LE:
+			bpp = 2;
+			break;
+		default:
+			return false;
+	}
+
+	for (y = 0; y < height; y++)
+	{
+		src = rgb_data + y * rowstride;
+
+		/* never read past the end of a partial row, the padding is added afterwards */
+		if (width < 64)
+		{
+			memcpy(row, src, width * bpp);
+			src = (uint8*) row;
+		}
+
+		for (x = 0; x < 64; x += 16)
+		{
+			rfx_unpack_rgb_avx2(src + x * bpp, pixel_format, &r, &g, &b);
+			rfx_encode_ycbcr_avx2(r, g, b, &r, &g, &b);
+
+			_mm256_storeu_si256((__m256i*) &y_buf[y * 64 + x], r);
+			_mm256_storeu_si256((__m256i*) &cb_buf[y * 64 + x], g);
+			_mm256_storeu_si256((__m256i*) &cr_buf[y * 64 + x], b);
+		}
+	}
+
+	rfx_encode_pad_planes(width, height, y_buf, cb_buf, cr_buf);
+
+	return true;
+}
+
+static void rfx_quantization_decode_block_avx2(sint16* buffer, int buffer_size, uint32 factor)
+{
+	__m128i shift = _mm_cvtsi32_si128(factor);
+	__m256i* ptr = (__m256i*) buffer;
+	__m256i* buf_end = (__m256i*) (buffer + buffer_size);
+	__m256i a;
+
+	if (factor == 0)
+		return;
+
+	do
+	{
+		a = _mm256_loadu_si256(ptr);
+		_mm256_storeu_si256(ptr, _mm256_sll_epi16(a, shift));
+		ptr++;
+	}
+	while (ptr < buf_end);
+}
+
+static void rfx_quantization_decode_avx2(sint16* buffer, const uint32* quantization_values)
+{
+	rfx_quantization_decode_block_avx2(buffer, 4096, 5);
+
+	rfx_quantization_decode_block_avx2(buffer, 1024, quantization_values[8] - 6); /* HL1 */
+	rfx_quantization_decode_block_avx2(buffer + 1024, 1024, quantization_values[7] - 6); /* LH1 */
+	rfx_quantization_decode_block_avx2(buffer + 2048, 1024, quantization_values[9] - 6); /* HH1 */
+	rfx_quantization_decode_block_avx2(buffer + 3072, 256, quantization_values[5] - 6); /* HL2 */
+	rfx_quantization_decode_block_avx2(buffer + 3328, 256, quantization_values[4] - 6); /* LH2 */
+	rfx_quantization_decode_block_avx2(buffer + 3584, 256, quantization_values[6] - 6); /* HH2 */
+	rfx_quantization_decode_block_avx2(buffer + 3840, 64, quantization_values[2] - 6); /* HL3 */
+	rfx_quantization_decode_block_avx2(buffer + 3904, 64, quantization_values[1] - 6); /* LH3 */
+	rfx_quantization_decode_block_avx2(buffer + 3968, 64, quantization_values[3] - 6); /* HH3 */
+	rfx_quantization_decode_block_avx2(buffer + 4032, 64, quantization_values[0] - 6); /* LL3 */
+}
+
+static void rfx_quantization_encode_block_avx2(sint16* buffer, int buffer_size, uint32 factor)
+{
+	__m128i shift = _mm_cvtsi32_si128(factor);
+	__m256i* ptr = (__m256i*) buffer;
+	__m256i* buf_end = (__m256i*) (buffer + buffer_size);
+	__m256i mask, half;
+	__m256i a, q, rem;
+
+	if (factor == 0)
+		return;
+
+	mask = _mm256_set1_epi16((1 << factor) - 1);
+	half = _mm256_set1_epi16(1 << (factor - 1));
+
+	do
+	{
+		/* (a + half) >> factor, split so that a + half cannot overflow */
+		a = _mm256_loadu_si256(ptr);
+		q = _mm256_sra_epi16(a, shift);
+		rem = _mm256_add_epi16(_mm256_and_si256(a, mask), half);
+		q = _mm256_add_epi16(q, _mm256_srl_epi16(rem, shift));
+		_mm256_storeu_si256(ptr, q);
+		ptr++;
+	}
+	while (ptr < buf_end);
+}
+
+static void rfx_quantization_encode_avx2(sint16* buffer, const uint32* quantization_values)
+{
+	rfx_quantization_encode_block_avx2(buffer, 1024, quantization_values[8] - 6); /* HL1 */
+	rfx_quantization_encode_block_avx2(buffer + 1024, 1024, quantization_values[7] - 6); /* LH1 */
+	rfx_quantization_encode_block_avx2(buffer + 2048, 1024, quantization_values[9] - 6); /* HH1 */
+	rfx_quantization_encode_block_avx2(buffer + 3072, 256, quantization_values[5] - 6); /* HL2 */
+	rfx_quantization_encode_block_avx2(buffer + 3328, 256, quantization_values[4] - 6); /* LH2 */
+	rfx_quantization_encode_block_avx2(buffer + 3584, 256, quantization_values[6] - 6); /* HH2 */
+	rfx_quantization_encode_block_avx2(buffer + 3840, 64, quantization_values[2] - 6); /* HL3 */
+	rfx_quantization_encode_block_avx2(buffer + 3904, 64, quantization_values[1] - 6); /* LH3 */
+	rfx_quantization_encode_block_avx2(buffer + 3968, 64, quantization_values[3] - 6); /* HH3 */
+	rfx_quantization_encode_block_avx2(buffer + 4032, 64, quantization_values[0] - 6); /* LL3 */
+
+	rfx_quantization_encode_block_avx2(buffer, 4096, 5);
+}
+
+/* Interleave l and h into l[0], h[0], l[1], h[1], ... */
+static INLINE void store_interleaved_epi16(sint16* dst, __m256i l, __m256i h)
+{
+	__m256i lo = _mm256_unpacklo_epi16(l, h);
+	__m256i hi = _mm256_unpackhi_epi16(l, h);
+
+	_mm256_storeu_si256((__m256i*) dst, _mm256_permute2x128_si256(lo, hi, 0x20));
+	_mm256_storeu_si256((__m256i*) (dst + 16), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+/* Split 32 coefficients into the 16 even and the 16 odd ones */
+static INLINE void load_deinterleaved_epi16(const sint16* src, __m256i* l, __m256i* h)
+{
+	__m256i shuffle = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+		0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+	__m256i a = _mm256_loadu_si256((__m256i*) src);
+	__m256i b = _mm256_loadu_si256((__m256i*) (src + 16));
+
+	a = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a, shuffle), 0xD8);
+	b = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(b, shuffle), 0xD8);
+
+	*l = _mm256_permute2x128_si256(a, b, 0x20);
+	*h = _mm256_permute2x128_si256(a, b, 0x31);
+}
+
+/* Inverse horizontal DWT of one pair of sub-bands, see rfx_dwt_2d_decode_block() */
+static void rfx_idwt_horizontal_avx2(const sint16* low, const sint16* high, sint16* dst, int subband_width)
+{
+	__m256i l, h, h_next;
+	__m256i even, even_next, odd;
+	__m256i neighbour;
+	int total = subband_width * subband_width;
+	int i;
+
+	h = _mm256_loadu_si256((__m256i*) high);
+	l = _mm256_loadu_si256((__m256i*) low);
+	neighbour = _mm256_blendv_epi8(prev_epi16(h, h), h, row_start_mask(0, subband_width));
+	even = _mm256_sub_epi16(l, avg_round_epi16(neighbour, h));
+
+	for (i = 0; i < total; i += 16)
+	{
+		if (i + 16 < total)
+		{
+			h_next = _mm256_loadu_si256((__m256i*) &high[i + 16]);
+			l = _mm256_loadu_si256((__m256i*) &low[i + 16]);
+			neighbour = _mm256_blendv_epi8(prev_epi16(h, h_next), h_next, row_start_mask(i + 16, subband_width));
+			even_next = _mm256_sub_epi16(l, avg_round_epi16(neighbour, h_next));
+		}
+		else
+		{
+			h_next = h;
+			even_next = even;
+		}
+
+		neighbour = _mm256_blendv_epi8(next_epi16(even, even_next), even, row_end_mask(i, subband_width));
+		odd = _mm256_add_epi16(_mm256_slli_epi16(h, 1), avg_floor_epi16(even, neighbour));
+
+		store_interleaved_epi16(&dst[i << 1], even, odd);
+
+		h = h_next;
+		even = even_next;
+	}
+}
+
+static void rfx_dwt_2d_decode_block_avx2(sint16* buffer, sint16* idwt, int subband_width)
+{
+	__m256i l, h, h_next;
+	__m256i even, even_next, odd;
+	int total_width;
+	int x, n;
+
+	total_width = subband_width << 1;
+
+	/* Inverse DWT in horizontal direction: L from LL(3) and HL(0), H from LH(1) and HH(2). */
+	rfx_idwt_horizontal_avx2(buffer + subband_width * subband_width * 3, buffer,
+		idwt, subband_width);
+	rfx_idwt_horizontal_avx2(buffer + subband_width * subband_width, buffer + subband_width * subband_width * 2,
+		idwt + subband_width * subband_width * 2, subband_width);
+
+	/* Inverse DWT in vertical direction, results are stored in original buffer. */
+	for (x = 0; x < total_width; x += 16)
+	{
+		h = _mm256_loadu_si256((__m256i*) &idwt[subband_width * total_width + x]);
+		l = _mm256_loadu_si256((__m256i*) &idwt[x]);
+		even = _mm256_sub_epi16(l, avg_round_epi16(h, h));
+
+		for (n = 0; n < subband_width; n++)
+		{
+			if (n < subband_width - 1)
+			{
+				h_next = _mm256_loadu_si256((__m256i*) &idwt[(subband_width + n + 1) * total_width + x]);
+				l = _mm256_loadu_si256((__m256i*) &idwt[(n + 1) * total_width + x]);
+				even_next = _mm256_sub_epi16(l, avg_round_epi16(h, h_next));
+			}
+			else
+			{
+				h_next = h;
+				even_next = even;
+			}
+
+			odd = _mm256_add_epi16(_mm256_slli_epi16(h, 1), avg_floor_epi16(even, even_next));
+
+			_mm256_storeu_si256((__m256i*) &buffer[(n << 1) * total_width + x], even);
+			_mm256_storeu_si256((__m256i*) &buffer[((n << 1) + 1) * total_width + x], odd);
+
+			h = h_next;
+			even = even_next;
+		}
+	}
+}
+
+static void rfx_dwt_2d_decode_avx2(sint16* buffer, sint16* dwt_buffer)
+{
+	rfx_dwt_2d_decode_block_avx2(buffer + 3840, dwt_buffer, 8);
+	rfx_dwt_2d_decode_block_avx2(buffer + 3072, dwt_buffer, 16);
+	rfx_dwt_2d_decode_block_avx2(buffer, dwt_buffer, 32);
+}
+
+/* Forward horizontal DWT of one half of the vertical result, see rfx_dwt_2d_encode_block() */
+static void rfx_dwt_horizontal_avx2(const sint16* src, sint16* low, sint16* high, int subband_width)
+{
+	__m256i even, odd, even_next, odd_next;
+	__m256i h, h_prev, l;
+	__m256i neighbour;
+	int total = subband_width * subband_width;
+	int i;
+
+	load_deinterleaved_epi16(src, &even, &odd);
+	h_prev = _mm256_setzero_si256();
+
+	for (i = 0; i < total; i += 16)
+	{
+		if (i + 16 < total)
+		{
+			load_deinterleaved_epi16(&src[(i + 16) << 1], &even_next, &odd_next);
+		}
+		else
+		{
+			even_next = even;
+			odd_next = odd;
+		}
+
+		neighbour = _mm256_blendv_epi8(next_epi16(even, even_next), even, row_end_mask(i, subband_width));
+		h = half_diff_epi16(odd, avg_floor_epi16(even, neighbour));
+
+		neighbour = _mm256_blendv_epi8(prev_epi16(h_prev, h), h, row_start_mask(i, subband_width));
+		l = _mm256_add_epi16(even, avg_floor_epi16(neighbour, h));
+
+		_mm256_storeu_si256((__m256i*) &high[i], h);
+		_mm256_storeu_si256((__m256i*) &low[i], l);
+
+		h_prev = h;
+		even = even_next;
+		odd = odd_next;
+	}
+}
+
+static void rfx_dwt_2d_encode_block_avx2(sint16* buffer, sint16* dwt, int subband_width)
+{
+	__m256i src_even, src_odd, src_next;
+	__m256i h, h_prev, l;
+	int total_width;
+	int x, n;
+
+	total_width = subband_width << 1;
+
+	/* DWT in vertical direction, results in 2 sub-bands in L, H order in tmp buffer dwt. */
+	for (x = 0; x < total_width; x += 16)
+	{
+		src_even = _mm256_loadu_si256((__m256i*) &buffer[x]);
+		h_prev = _mm256_setzero_si256();
+
+		for (n = 0; n < subband_width; n++)
+		{
+			src_odd = _mm256_loadu_si256((__m256i*) &buffer[((n << 1) + 1) * total_width + x]);
+
+			if (n < subband_width - 1)
+				src_next = _mm256_loadu_si256((__m256i*) &buffer[((n << 1) + 2) * total_width + x]);
+			else
+				src_next = src_even;
+
+			h = half_diff_epi16(src_odd, avg_floor_epi16(src_even, src_next));
+			l = _mm256_add_epi16(src_even, (n == 0) ? h : avg_floor_epi16(h_prev, h));
+
+			_mm256_storeu_si256((__m256i*) &dwt[n * total_width + x], l);
+			_mm256_storeu_si256((__m256i*) &dwt[(subband_width + n) * total_width + x], h);
+
+			h_prev = h;
+			src_even = src_next;
+		}
+	}
+
+	/* DWT in horizontal direction: L gives LL(3) and HL(0), H gives LH(1) and HH(2). */
+	rfx_dwt_horizontal_avx2(dwt, buffer + subband_width * subband_width * 3, buffer, subband_width);
+	rfx_dwt_horizontal_avx2(dwt + subband_width * subband_width * 2, buffer + subband_width * subband_width,
+		buffer + subband_width * subband_width * 2, subband_width);
+}
+
+static void rfx_dwt_2d_encode_avx2(sint16* buffer, sint16* dwt_buffer)
+{
+	rfx_dwt_2d_encode_block_avx2(buffer, dwt_buffer, 32);
+	rfx_dwt_2d_encode_block_avx2(buffer + 3072, dwt_buffer, 16);
+	rfx_dwt_2d_encode_block_avx2(buffer + 3840, dwt_buffer, 8);
+}
+
+void rfx_init_avx2(RFX_CONTEXT* context)
+{
+	DEBUG_RFX("Using AVX2 optimizations");
+
+	IF_PROFILER(context->priv->prof_rfx_decode_ycbcr_to_rgb->name = "rfx_decode_ycbcr_to_rgb_avx2");
+	IF_PROFILER(context->priv->prof_rfx_encode_rgb_to_ycbcr->name = "rfx_encode_rgb_to_ycbcr_avx2");
+	IF_PROFILER(context->priv->prof_rfx_encode_format_rgb_to_ycbcr->name = "rfx_encode_format_rgb_to_ycbcr_avx2");
+	IF_PROFILER(context->priv->prof_rfx_quantization_decode->name = "rfx_quantization_decode_avx2");
+	IF_PROFILER(context->priv->prof_rfx_quantization_encode->name = "rfx_quantization_encode_avx2");
+	IF_PROFILER(context->priv->prof_rfx_dwt_2d_decode->name = "rfx_dwt_2d_decode_avx2");
+	IF_PROFILER(context->priv->prof_rfx_dwt_2d_encode->name = "rfx_dwt_2d_encode_avx2");
+
+	context->decode_ycbcr_to_rgb = rfx_decode_ycbcr_to_rgb_avx2;
+	context->encode_rgb_to_ycbcr = rfx_encode_rgb_to_ycbcr_avx2;
+	context->encode_format_rgb_to_ycbcr = rfx_encode_format_rgb_to_ycbcr_avx2;
+	context->quantization_decode = rfx_quantization_decode_avx2;
+	context->quantization_encode = rfx_quantization_encode_avx2;
+	context->dwt_2d_decode = rfx_dwt_2d_decode_avx2;
+	context->dwt_2d_encode = rfx_dwt_2d_encode_avx2;
+}
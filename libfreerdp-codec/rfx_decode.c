@@ -30,53 +30,84 @@
 
 #include "rfx_decode.h"
 
+/**
+ * Pack a width x height block of the decoded 64x64 colour planes into dst_buf,
+ * which may be a tile buffer or a window of a larger surface.
+ */
 static void rfx_decode_format_rgb(sint16* r_buf, sint16* g_buf, sint16* b_buf,
-	RFX_PIXEL_FORMAT pixel_format, uint8* dst_buf)
+	int width, int height, RFX_PIXEL_FORMAT pixel_format, uint8* dst_buf, int dst_stride)
+{
+	sint16* r;
+	sint16* g;
+	sint16* b;
+	uint8* dst;
+	int x, y;
+
+	for (y = 0; y < height; y++)
+	{
+		r = r_buf + y * 64;
+		g = g_buf + y * 64;
+		b = b_buf + y * 64;
+		dst = dst_buf + y * dst_stride;
+
+		switch (pixel_format)
+		{
+			case RFX_PIXEL_FORMAT_BGRA:
+				for (x = 0; x < width; x++)
+				{
+					*dst++ = (uint8) (*b++);
+					*dst++ = (uint8) (*g++);
+					*dst++ = (uint8) (*r++);
+					*dst++ = 0xFF;
+				}
+				break;
+			case RFX_PIXEL_FORMAT_RGBA:
+				for (x = 0; x < width; x++)
+				{
+					*dst++ = (uint8) (*r++);
+					*dst++ = (uint8) (*g++);
+					*dst++ = (uint8) (*b++);
+					*dst++ = 0xFF;
+				}
+				break;
+			case RFX_PIXEL_FORMAT_BGR:
+				for (x = 0; x < width; x++)
+				{
+					*dst++ = (uint8) (*b++);
+					*dst++ = (uint8) (*g++);
+					*dst++ = (uint8) (*r++);
+				}
+				break;
+			case RFX_PIXEL_FORMAT_RGB:
+				for (x = 0; x < width; x++)
+				{
+					*dst++ = (uint8) (*r++);
+					*dst++ = (uint8) (*g++);
+					*dst++ = (uint8) (*b++);
+				}
+				break;
+			default:
+				return;
+		}
+	}
+}
+
+/**
+ * Number of bytes per pixel written by rfx_decode_format_rgb(), or 0 if the
+ * pixel format is not supported as a decoder output.
+ */
+int rfx_decode_format_bpp(RFX_PIXEL_FORMAT pixel_format)
 {
-	sint16* r = r_buf;
-	sint16* g = g_buf;
-	sint16* b = b_buf;
-	uint8* dst = dst_buf;
-	int i;
-	
 	switch (pixel_format)
 	{
 		case RFX_PIXEL_FORMAT_BGRA:
-			for (i = 0; i < 4096; i++)
-			{
-				*dst++ = (uint8) (*b++);
-				*dst++ = (uint8) (*g++);
-				*dst++ = (uint8) (*r++);
-				*dst++ = 0xFF;
-			}
-			break;
 		case RFX_PIXEL_FORMAT_RGBA:
-			for (i = 0; i < 4096; i++)
-			{
-				*dst++ = (uint8) (*r++);
-				*dst++ = (uint8) (*g++);
-				*dst++ = (uint8) (*b++);
-				*dst++ = 0xFF;
-			}
-			break;
+			return 4;
 		case RFX_PIXEL_FORMAT_BGR:
-			for (i = 0; i < 4096; i++)
-			{
-				*dst++ = (uint8) (*b++);
-				*dst++ = (uint8) (*g++);
-				*dst++ = (uint8) (*r++);
-			}
-			break;
 		case RFX_PIXEL_FORMAT_RGB:
-			for (i = 0; i < 4096; i++)
-			{
-				*dst++ = (uint8) (*r++);
-				*dst++ = (uint8) (*g++);
-				*dst++ = (uint8) (*b++);
-			}
-			break;
+			return 3;
 		default:
-			break;
+			return 0;
 	}
 }
 
@@ -144,7 +175,7 @@ void rfx_decode_ycbcr_to_rgb(sint16* y_r_buf, sint16* cb_g_buf, sint16* cr_b_buf
 }
 
 static void rfx_decode_component(RFX_CONTEXT* context, const uint32* quantization_values,
-	const uint8* data, int size, sint16* buffer)
+	const uint8* data, int size, sint16* buffer, sint16* dwt_buffer)
 {
 	PROFILER_ENTER(context->priv->prof_rfx_decode_component);
 
@@ -161,34 +192,116 @@ static void rfx_decode_component(RFX_CONTEXT* context, const uint32* quantizatio
 	PROFILER_EXIT(context->priv->prof_rfx_quantization_decode);
 
 	PROFILER_ENTER(context->priv->prof_rfx_dwt_2d_decode);
-		context->dwt_2d_decode(buffer, context->priv->dwt_buffer);
+		context->dwt_2d_decode(buffer, dwt_buffer);
 	PROFILER_EXIT(context->priv->prof_rfx_dwt_2d_decode);
 
 	PROFILER_EXIT(context->priv->prof_rfx_decode_component);
 }
 
-void rfx_decode_rgb(RFX_CONTEXT* context, STREAM* data_in,
+static void rfx_decode_tile_planes(RFX_CONTEXT* context, RFX_SCRATCH* scratch, const uint8* data,
 	int y_size, const uint32 * y_quants,
 	int cb_size, const uint32 * cb_quants,
-	int cr_size, const uint32 * cr_quants, uint8* rgb_buffer)
+	int cr_size, const uint32 * cr_quants)
 {
-	PROFILER_ENTER(context->priv->prof_rfx_decode_rgb);
-
-	rfx_decode_component(context, y_quants, stream_get_tail(data_in), y_size, context->priv->y_r_buffer); /* YData */
-	stream_seek(data_in, y_size);
-	rfx_decode_component(context, cb_quants, stream_get_tail(data_in), cb_size, context->priv->cb_g_buffer); /* CbData */
-	stream_seek(data_in, cb_size);
-	rfx_decode_component(context, cr_quants, stream_get_tail(data_in), cr_size, context->priv->cr_b_buffer); /* CrData */
-	stream_seek(data_in, cr_size);
+	rfx_decode_component(context, y_quants, data, y_size, scratch->y_r_buffer, scratch->dwt_buffer); /* YData */
+	data += y_size;
+	rfx_decode_component(context, cb_quants, data, cb_size, scratch->cb_g_buffer, scratch->dwt_buffer); /* CbData */
+	data += cb_size;
+	rfx_decode_component(context, cr_quants, data, cr_size, scratch->cr_b_buffer, scratch->dwt_buffer); /* CrData */
 
 	PROFILER_ENTER(context->priv->prof_rfx_decode_ycbcr_to_rgb);
-		context->decode_ycbcr_to_rgb(context->priv->y_r_buffer, context->priv->cb_g_buffer, context->priv->cr_b_buffer);
+		context->decode_ycbcr_to_rgb(scratch->y_r_buffer, scratch->cb_g_buffer, scratch->cr_b_buffer);
 	PROFILER_EXIT(context->priv->prof_rfx_decode_ycbcr_to_rgb);
+}
+
+/**
+ * Decode one tile using the given scratch buffers. This does not touch any
+ * other per-context state, so distinct threads may decode tiles of the same
+ * context concurrently as long as each one uses its own scratch buffers.
+ */
+void rfx_decode_tile(RFX_CONTEXT* context, RFX_SCRATCH* scratch, const uint8* data,
+	int y_size, const uint32 * y_quants,
+	int cb_size, const uint32 * cb_quants,
+	int cr_size, const uint32 * cr_quants, uint8* rgb_buffer)
+{
+	PROFILER_ENTER(context->priv->prof_rfx_decode_rgb);
+
+	rfx_decode_tile_planes(context, scratch, data, y_size, y_quants, cb_size, cb_quants, cr_size, cr_quants);
 
 	PROFILER_ENTER(context->priv->prof_rfx_decode_format_rgb);
-		rfx_decode_format_rgb(context->priv->y_r_buffer, context->priv->cb_g_buffer, context->priv->cr_b_buffer,
-			context->pixel_format, rgb_buffer);
+		rfx_decode_format_rgb(scratch->y_r_buffer, scratch->cb_g_buffer, scratch->cr_b_buffer,
+			64, 64, context->pixel_format, rgb_buffer, 64 * rfx_decode_format_bpp(context->pixel_format));
 	PROFILER_EXIT(context->priv->prof_rfx_decode_format_rgb);
-	
+
 	PROFILER_EXIT(context->priv->prof_rfx_decode_rgb);
 }
+
+/**
+ * Decode the tile at (tile_x, tile_y) of the current message and write it
+ * straight into the target surface, clipped to the message rects and to the
+ * surface bounds. Tiles never overlap, so concurrent calls with distinct
+ * scratch buffers write disjoint parts of the surface.
+ */
+void rfx_decode_tile_to_surface(RFX_CONTEXT* context, RFX_SCRATCH* scratch, const uint8* data,
+	int y_size, const uint32 * y_quants,
+	int cb_size, const uint32 * cb_quants,
+	int cr_size, const uint32 * cr_quants,
+	const RFX_SURFACE* surface, int tile_x, int tile_y)
+{
+	int i;
+	int bpp;
+	int left, top, right, bottom;
+	int tile_left, tile_top;
+	const RFX_RECT* rect;
+	boolean decoded = false;
+
+	bpp = rfx_decode_format_bpp(surface->format);
+	tile_left = surface->left + tile_x;
+	tile_top = surface->top + tile_y;
+
+	for (i = 0; i < surface->num_rects; i++)
+	{
+		rect = &surface->rects[i];
+
+		left = MAX(surface->left + rect->x, tile_left);
+		top = MAX(surface->top + rect->y, tile_top);
+		right = MIN(surface->left + rect->x + rect->width, tile_left + 64);
+		bottom = MIN(surface->top + rect->y + rect->height, tile_top + 64);
+
+		left = MAX(left, 0);
+		top = MAX(top, 0);
+		right = MIN(right, surface->width);
+		bottom = MIN(bottom, surface->height);
+
+		if (left >= right || top >= bottom)
+			continue;
+
+		/* tiles that are entirely clipped away are never decoded */
+		if (!decoded)
+		{
+			PROFILER_ENTER(context->priv->prof_rfx_decode_rgb);
+			rfx_decode_tile_planes(context, scratch, data, y_size, y_quants, cb_size, cb_quants, cr_size, cr_quants);
+			PROFILER_EXIT(context->priv->prof_rfx_decode_rgb);
+			decoded = true;
+		}
+
+		PROFILER_ENTER(context->priv->prof_rfx_decode_format_rgb);
+			rfx_decode_format_rgb(
+				scratch->y_r_buffer + (top - tile_top) * 64 + (left - tile_left),
+				scratch->cb_g_buffer + (top - tile_top) * 64 + (left - tile_left),
+				scratch->cr_b_buffer + (top - tile_top) * 64 + (left - tile_left),
+				right - left, bottom - top, surface->format,
+				surface->data + top * surface->stride + left * bpp, surface->stride);
+		PROFILER_EXIT(context->priv->prof_rfx_decode_format_rgb);
+	}
+}
+
+void rfx_decode_rgb(RFX_CONTEXT* context, STREAM* data_in,
+	int y_size, const uint32 * y_quants,
+	int cb_size, const uint32 * cb_quants,
+	int cr_size, const uint32 * cr_quants, uint8* rgb_buffer)
+{
+	rfx_decode_tile(context, &context->priv->scratch, stream_get_tail(data_in),
+		y_size, y_quants, cb_size, cb_quants, cr_size, cr_quants, rgb_buffer);
+	stream_seek(data_in, y_size + cb_size + cr_size);
+}
@@ -22,8 +22,20 @@
 
 #include <freerdp/codec/rfx.h>
 
+#include "rfx_types.h"
+
 void rfx_decode_ycbcr_to_rgb(sint16* y_r_buf, sint16* cb_g_buf, sint16* cr_b_buf);
+int rfx_decode_format_bpp(RFX_PIXEL_FORMAT pixel_format);
 
+void rfx_decode_tile(RFX_CONTEXT* context, RFX_SCRATCH* scratch, const uint8* data,
+	int y_size, const uint32 * y_quants,
+	int cb_size, const uint32 * cb_quants,
+	int cr_size, const uint32 * cr_quants, uint8* rgb_buffer);
+void rfx_decode_tile_to_surface(RFX_CONTEXT* context, RFX_SCRATCH* scratch, const uint8* data,
+	int y_size, const uint32 * y_quants,
+	int cb_size, const uint32 * cb_quants,
+	int cr_size, const uint32 * cr_quants,
+	const RFX_SURFACE* surface, int tile_x, int tile_y);
 void rfx_decode_rgb(RFX_CONTEXT* context, STREAM* data_in,
 	int y_size, const uint32 * y_quants,
 	int cb_size, const uint32 * cb_quants,
@@ -175,13 +175,34 @@ static void rfx_encode_format_rgb(const uint8* rgb_data, int width, int height,
 	}
 }
 
-void rfx_encode_rgb_to_ycbcr(sint16* y_r_buf, sint16* cb_g_buf, sint16* cr_b_buf)
+static INLINE void rfx_encode_ycbcr(sint32 r, sint32 g, sint32 b, sint16* y_out, sint16* cb_out, sint16* cr_out)
 {
 	/* sint32 is used intentionally because we calculate with shifted factors! */
-	int i;
-	sint32 r, g, b;
 	sint32 y, cb, cr;
 
+	/*
+	 * We scale the factors by << 15 into 32-bit integers in order to avoid slower
+	 * floating point multiplications. Since the terms need to be scaled by << 5 we
+	 * simply scale the final sum by >> 10
+	 *
+	 * Y:  0.299000 << 15 = 9798,  0.587000 << 15 = 19235, 0.114000 << 15 = 3735
+	 * Cb: 0.168935 << 15 = 5535,  0.331665 << 15 = 10868, 0.500590 << 15 = 16403
+	 * Cr: 0.499813 << 15 = 16377, 0.418531 << 15 = 13714, 0.081282 << 15 = 2663
+	 */
+
+	y  = (r *  9798 + g *  19235 + b *  3735) >> 10;
+	cb = (r * -5535 + g * -10868 + b * 16403) >> 10;
+	cr = (r * 16377 + g * -13714 + b * -2663) >> 10;
+
+	*y_out = MINMAX(y - 4096, -4096, 4095);
+	*cb_out = MINMAX(cb, -4096, 4095);
+	*cr_out = MINMAX(cr, -4096, 4095);
+}
+
+void rfx_encode_rgb_to_ycbcr(sint16* y_r_buf, sint16* cb_g_buf, sint16* cr_b_buf)
+{
+	int i;
+
 	/**
 	 * The encoded YCbCr coefficients are represented as 11.5 fixed-point numbers:
 	 *
@@ -192,38 +213,130 @@ void rfx_encode_rgb_to_ycbcr(sint16* y_r_buf, sint16* cb_g_buf, sint16* cr_b_buf
 	 * It will be scaled down to original during the quantization phase.
 	 */
 	for (i = 0; i < 4096; i++)
+		rfx_encode_ycbcr(y_r_buf[i], cb_g_buf[i], cr_b_buf[i], &y_r_buf[i], &cb_g_buf[i], &cr_b_buf[i]);
+}
+
+/**
+ * Fill the part of the 64x64 planes outside of a width x height tile with
+ * the right-most pixel of each row and then with the last row, like
+ * rfx_encode_format_rgb() does before the colour conversion. The conversion
+ * works on single pixels, so padding its output gives the same planes.
+ */
+void rfx_encode_pad_planes(int width, int height, sint16* y_buf, sint16* cb_buf, sint16* cr_buf)
+{
+	int x, y;
+	sint16* planes[3];
+	sint16* row;
+	int i;
+
+	planes[0] = y_buf;
+	planes[1] = cb_buf;
+	planes[2] = cr_buf;
+
+	for (i = 0; i < 3; i++)
+	{
+		if (width < 64)
+		{
+			for (y = 0; y < height; y++)
+			{
+				row = planes[i] + y * 64;
+
+				for (x = width; x < 64; x++)
+					row[x] = row[width - 1];
+			}
+		}
+
+		for (y = height; y < 64; y++)
+			memcpy(planes[i] + y * 64, planes[i] + (height - 1) * 64, 64 * sizeof(sint16));
+	}
+}
+
+/**
+ * Split a tile of packed pixels into planes and convert them to YCbCr in a
+ * single pass. The output is identical to rfx_encode_format_rgb() followed by
+ * rfx_encode_rgb_to_ycbcr(). Returns false for the palette formats, which
+ * take that two-pass route instead.
+ */
+boolean rfx_encode_format_rgb_to_ycbcr(const uint8* rgb_data, int width, int height, int rowstride,
+	RFX_PIXEL_FORMAT pixel_format, sint16* y_buf, sint16* cb_buf, sint16* cr_buf)
+{
+	int x, y;
+	const uint8* src;
+	sint16* y_out;
+	sint16* cb_out;
+	sint16* cr_out;
+
+	switch (pixel_format)
+	{
+		case RFX_PIXEL_FORMAT_BGRA:
+		case RFX_PIXEL_FORMAT_RGBA:
+		case RFX_PIXEL_FORMAT_BGR:
+		case RFX_PIXEL_FORMAT_RGB:
+		case RFX_PIXEL_FORMAT_BGR565_LE:
+		case RFX_PIXEL_FORMAT_RGB565_LE:
+			break;
+		default:
+			return false;
+	}
+
+	for (y = 0; y < height; y++)
 	{
-		r = y_r_buf[i];
-		g = cb_g_buf[i];
-		b = cr_b_buf[i];
-
-		/*
-		 * We scale the factors by << 15 into 32-bit integers in order to avoid slower
-		 * floating point multiplications. Since the terms need to be scaled by << 5 we
-		 * simply scale the final sum by >> 10
-		 *
-		 * Y:  0.299000 << 15 = 9798,  0.587000 << 15 = 19235, 0.114000 << 15 = 3735
-		 * Cb: 0.168935 << 15 = 5535,  0.331665 << 15 = 10868, 0.500590 << 15 = 16403
-		 * Cr: 0.499813 << 15 = 16377, 0.418531 << 15 = 13714, 0.081282 << 15 = 2663
-		 */
-
-		y  = (r *  9798 + g *  19235 + b *  3735) >> 10;
-		cb = (r * -5535 + g * -10868 + b * 16403) >> 10;
-		cr = (r * 16377 + g * -13714 + b * -2663) >> 10;
-
-		y_r_buf[i] = MINMAX(y - 4096, -4096, 4095);
-		cb_g_buf[i] = MINMAX(cb, -4096, 4095);
-		cr_b_buf[i] = MINMAX(cr, -4096, 4095);
+		src = rgb_data + y * rowstride;
+		y_out = y_buf + y * 64;
+		cb_out = cb_buf + y * 64;
+		cr_out = cr_buf + y * 64;
+
+		switch (pixel_format)
+		{
+			case RFX_PIXEL_FORMAT_BGRA:
+				for (x = 0; x < width; x++, src += 4)
+					rfx_encode_ycbcr(src[2], src[1], src[0], y_out++, cb_out++, cr_out++);
+				break;
+			case RFX_PIXEL_FORMAT_RGBA:
+				for (x = 0; x < width; x++, src += 4)
+					rfx_encode_ycbcr(src[0], src[1], src[2], y_out++, cb_out++, cr_out++);
+				break;
+			case RFX_PIXEL_FORMAT_BGR:
+				for (x = 0; x < width; x++, src += 3)
+					rfx_encode_ycbcr(src[2], src[1], src[0], y_out++, cb_out++, cr_out++);
+				break;
+			case RFX_PIXEL_FORMAT_RGB:
+				for (x = 0; x < width; x++, src += 3)
+					rfx_encode_ycbcr(src[0], src[1], src[2], y_out++, cb_out++, cr_out++);
+				break;
+			case RFX_PIXEL_FORMAT_BGR565_LE:
+				for (x = 0; x < width; x++, src += 2)
+				{
+					rfx_encode_ycbcr(((src[0] & 0x1F) << 3) | ((src[0] >> 2) & 0x07),
+						((src[1] & 0x07) << 5) | ((src[0] & 0xE0) >> 3),
+						(src[1] & 0xF8) | (src[1] >> 5), y_out++, cb_out++, cr_out++);
+				}
+				break;
+			case RFX_PIXEL_FORMAT_RGB565_LE:
+				for (x = 0; x < width; x++, src += 2)
+				{
+					rfx_encode_ycbcr((src[1] & 0xF8) | (src[1] >> 5),
+						((src[1] & 0x07) << 5) | ((src[0] & 0xE0) >> 3),
+						((src[0] & 0x1F) << 3) | ((src[0] >> 2) & 0x07), y_out++, cb_out++, cr_out++);
+				}
+				break;
+			default:
+				break;
+		}
 	}
+
+	rfx_encode_pad_planes(width, height, y_buf, cb_buf, cr_buf);
+
+	return true;
 }
 
 static void rfx_encode_component(RFX_CONTEXT* context, const uint32* quantization_values,
-	sint16* data, uint8* buffer, int buffer_size, int* size)
+	sint16* data, sint16* dwt_buffer, uint8* buffer, int buffer_size, int* size)
 {
 	PROFILER_ENTER(context->priv->prof_rfx_encode_component);
 
 	PROFILER_ENTER(context->priv->prof_rfx_dwt_2d_encode);
-		context->dwt_2d_encode(data, context->priv->dwt_buffer);
+		context->dwt_2d_encode(data, dwt_buffer);
 	PROFILER_EXIT(context->priv->prof_rfx_dwt_2d_encode);
 
 	PROFILER_ENTER(context->priv->prof_rfx_quantization_encode);
@@ -241,40 +354,61 @@ static void rfx_encode_component(RFX_CONTEXT* context, const uint32* quantizatio
 	PROFILER_EXIT(context->priv->prof_rfx_encode_component);
 }
 
-void rfx_encode_rgb(RFX_CONTEXT* context, const uint8* rgb_data, int width, int height, int rowstride,
+/**
+ * Encode one tile using the given scratch buffers, see rfx_decode_tile().
+ */
+void rfx_encode_tile(RFX_CONTEXT* context, RFX_SCRATCH* scratch,
+	const uint8* rgb_data, int width, int height, int rowstride,
 	const uint32* y_quants, const uint32* cb_quants, const uint32* cr_quants,
 	STREAM* data_out, int* y_size, int* cb_size, int* cr_size)
 {
-	sint16* y_r_buffer = context->priv->y_r_buffer;
-	sint16* cb_g_buffer = context->priv->cb_g_buffer;
-	sint16* cr_b_buffer = context->priv->cr_b_buffer;
+	sint16* y_r_buffer = scratch->y_r_buffer;
+	sint16* cb_g_buffer = scratch->cb_g_buffer;
+	sint16* cr_b_buffer = scratch->cr_b_buffer;
+	boolean fused;
 
 	PROFILER_ENTER(context->priv->prof_rfx_encode_rgb);
 
-	PROFILER_ENTER(context->priv->prof_rfx_encode_format_rgb);
-		rfx_encode_format_rgb(rgb_data, width, height, rowstride,
-			context->pixel_format, context->palette, y_r_buffer, cb_g_buffer, cr_b_buffer);
-	PROFILER_EXIT(context->priv->prof_rfx_encode_format_rgb);
+	PROFILER_ENTER(context->priv->prof_rfx_encode_format_rgb_to_ycbcr);
+		fused = context->encode_format_rgb_to_ycbcr(rgb_data, width, height, rowstride,
+			context->pixel_format, y_r_buffer, cb_g_buffer, cr_b_buffer);
+	PROFILER_EXIT(context->priv->prof_rfx_encode_format_rgb_to_ycbcr);
 
-	PROFILER_ENTER(context->priv->prof_rfx_encode_rgb_to_ycbcr);
-		context->encode_rgb_to_ycbcr(context->priv->y_r_buffer, context->priv->cb_g_buffer, context->priv->cr_b_buffer);
-	PROFILER_EXIT(context->priv->prof_rfx_encode_rgb_to_ycbcr);
+	if (!fused)
+	{
+		PROFILER_ENTER(context->priv->prof_rfx_encode_format_rgb);
+			rfx_encode_format_rgb(rgb_data, width, height, rowstride,
+				context->pixel_format, context->palette, y_r_buffer, cb_g_buffer, cr_b_buffer);
+		PROFILER_EXIT(context->priv->prof_rfx_encode_format_rgb);
+
+		PROFILER_ENTER(context->priv->prof_rfx_encode_rgb_to_ycbcr);
+			context->encode_rgb_to_ycbcr(y_r_buffer, cb_g_buffer, cr_b_buffer);
+		PROFILER_EXIT(context->priv->prof_rfx_encode_rgb_to_ycbcr);
+	}
 
 	/* Ensure the buffer is reasonably large enough */
 	stream_check_size(data_out, 4096);
-	rfx_encode_component(context, y_quants, context->priv->y_r_buffer,
+	rfx_encode_component(context, y_quants, y_r_buffer, scratch->dwt_buffer,
 		stream_get_tail(data_out), stream_get_left(data_out), y_size);
 	stream_seek(data_out, *y_size);
 
 	stream_check_size(data_out, 4096);
-	rfx_encode_component(context, cb_quants, context->priv->cb_g_buffer,
+	rfx_encode_component(context, cb_quants, cb_g_buffer, scratch->dwt_buffer,
 		stream_get_tail(data_out), stream_get_left(data_out), cb_size);
 	stream_seek(data_out, *cb_size);
 
 	stream_check_size(data_out, 4096);
-	rfx_encode_component(context, cr_quants, context->priv->cr_b_buffer,
+	rfx_encode_component(context, cr_quants, cr_b_buffer, scratch->dwt_buffer,
 		stream_get_tail(data_out), stream_get_left(data_out), cr_size);
 	stream_seek(data_out, *cr_size);
 
 	PROFILER_EXIT(context->priv->prof_rfx_encode_rgb);
 }
+
+void rfx_encode_rgb(RFX_CONTEXT* context, const uint8* rgb_data, int width, int height, int rowstride,
+	const uint32* y_quants, const uint32* cb_quants, const uint32* cr_quants,
+	STREAM* data_out, int* y_size, int* cb_size, int* cr_size)
+{
+	rfx_encode_tile(context, &context->priv->scratch, rgb_data, width, height, rowstride,
+		y_quants, cb_quants, cr_quants, data_out, y_size, cb_size, cr_size);
+}
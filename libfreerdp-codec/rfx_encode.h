@@ -22,8 +22,17 @@
 
 #include <freerdp/codec/rfx.h>
 
+#include "rfx_types.h"
+
 void rfx_encode_rgb_to_ycbcr(sint16* y_r_buf, sint16* cb_g_buf, sint16* cr_b_buf);
+void rfx_encode_pad_planes(int width, int height, sint16* y_buf, sint16* cb_buf, sint16* cr_buf);
+boolean rfx_encode_format_rgb_to_ycbcr(const uint8* rgb_data, int width, int height, int rowstride,
+	RFX_PIXEL_FORMAT pixel_format, sint16* y_buf, sint16* cb_buf, sint16* cr_buf);
 
+void rfx_encode_tile(RFX_CONTEXT* context, RFX_SCRATCH* scratch,
+	const uint8* rgb_data, int width, int height, int rowstride,
+	const uint32* y_quants, const uint32* cb_quants, const uint32* cr_quants,
+	STREAM* data_out, int* y_size, int* cb_size, int* cr_size);
 void rfx_encode_rgb(RFX_CONTEXT* context, const uint8* rgb_data, int width, int height, int rowstride,
 	const uint32* y_quants, const uint32* cb_quants, const uint32* cr_quants,
 	STREAM* data_out, int* y_size, int* cb_size, int* cr_size);
@@ -24,13 +24,19 @@
 
 #include "rfx_pool.h"
 
+/**
+ * The pool is a per-context arena: tiles and messages handed back to it are
+ * kept and handed out again, so once it has grown to the largest frame seen
+ * decoding does not touch the heap any more.
+ */
+
 RFX_POOL* rfx_pool_new()
 {
 	RFX_POOL* pool;
 
 	pool = xnew(RFX_POOL);
 
-	pool->size = 64;
+	pool->size = RFX_POOL_CHUNK_TILES;
 	pool->tiles = (RFX_TILE**) xzalloc(sizeof(RFX_TILE*) * pool->size);
 
 	return pool;
@@ -38,52 +44,81 @@ RFX_POOL* rfx_pool_new()
 
 void rfx_pool_free(RFX_POOL* pool)
 {
-	int i;
-	RFX_TILE* tile;
+	RFX_TILE_CHUNK* chunk;
+	RFX_MESSAGE_SLOT* slot;
 
-	for (i = 0; i < pool->count; i++)
+	while (pool->chunks != NULL)
 	{
-		tile = pool->tiles[i];
+		chunk = pool->chunks;
+		pool->chunks = chunk->next;
 
-		if (tile != NULL)
-		{
-			if (tile->data != NULL)
-				xfree(tile->data);
+		xfree(chunk->buffer);
+		xfree(chunk);
+	}
+
+	while (pool->messages != NULL)
+	{
+		slot = pool->messages;
+		pool->messages = slot->next;
 
-			xfree(tile);
-		}
+		xfree(slot->message.rects);
+		xfree(slot->message.tiles);
+		xfree(slot);
 	}
 
 	xfree(pool->tiles);
 	xfree(pool);
 }
 
-void rfx_pool_put_tile(RFX_POOL* pool, RFX_TILE* tile)
+/**
+ * Grow or allocate a buffer the decoder keeps across frames, like
+ * xrenew(). Everything the pool and the decoder allocate once they are
+ * running goes through here, so that the alloc_hook sees all of it.
+ */
+void* rfx_pool_realloc(RFX_POOL* pool, void* ptr, size_t size)
+{
+	if (pool->alloc_hook != NULL)
+		pool->alloc_hook(pool->alloc_hook_arg, size);
+
+	return xrealloc_check(ptr, size);
+}
+
+static void rfx_pool_add_chunk(RFX_POOL* pool)
 {
-	if (pool->count >= pool->size)
+	int i;
+	uint8* data;
+	RFX_TILE_CHUNK* chunk;
+
+	chunk = (RFX_TILE_CHUNK*) rfx_pool_realloc(pool, NULL, sizeof(RFX_TILE_CHUNK));
+	memset(chunk, 0, sizeof(RFX_TILE_CHUNK));
+	chunk->buffer = (uint8*) rfx_pool_realloc(pool, NULL, RFX_POOL_CHUNK_TILES * 4096 * 4 + 63); /* 64x64 * 4 */
+	chunk->next = pool->chunks;
+	pool->chunks = chunk;
+
+	data = (uint8*) (((size_t) chunk->buffer + 63) & ~((size_t) 63));
+
+	/* the free list can hold every tile, so putting tiles back never reallocates */
+	pool->size += RFX_POOL_CHUNK_TILES;
+	pool->tiles = (RFX_TILE**) rfx_pool_realloc(pool, (void*) pool->tiles, sizeof(RFX_TILE*) * pool->size);
+
+	for (i = 0; i < RFX_POOL_CHUNK_TILES; i++)
 	{
-		pool->size *= 2;
-		pool->tiles = (RFX_TILE**) xrealloc((void*) pool->tiles, sizeof(RFX_TILE*) * pool->size);
+		chunk->tiles[i].data = data + i * 4096 * 4;
+		pool->tiles[(pool->count)++] = &chunk->tiles[i];
 	}
+}
 
+void rfx_pool_put_tile(RFX_POOL* pool, RFX_TILE* tile)
+{
 	pool->tiles[(pool->count)++] = tile;
 }
 
 RFX_TILE* rfx_pool_get_tile(RFX_POOL* pool)
 {
-	RFX_TILE* tile;
-
 	if (pool->count < 1)
-	{
-		tile = xnew(RFX_TILE);
-		tile->data = (uint8*) xmalloc(4096 * 4); /* 64x64 * 4 */
-	}
-	else
-	{
-		tile = pool->tiles[--(pool->count)];
-	}
+		rfx_pool_add_chunk(pool);
 
-	return tile;
+	return pool->tiles[--(pool->count)];
 }
 
 void rfx_pool_put_tiles(RFX_POOL* pool, RFX_TILE** tiles, int count)
@@ -96,17 +131,80 @@ void rfx_pool_put_tiles(RFX_POOL* pool, RFX_TILE** tiles, int count)
 	}
 }
 
-RFX_TILE** rfx_pool_get_tiles(RFX_POOL* pool, int count)
+void rfx_pool_get_tiles(RFX_POOL* pool, RFX_TILE** tiles, int count)
 {
 	int i;
-	RFX_TILE** tiles;
-
-	tiles = (RFX_TILE**) xmalloc(sizeof(RFX_TILE*) * count);
 
 	for (i = 0; i < count; i++)
 	{
 		tiles[i] = rfx_pool_get_tile(pool);
 	}
+}
+
+/**
+ * Get an empty message. Its rects and tiles arrays are kept from its
+ * previous use and only grow when a larger frame comes along.
+ */
+RFX_MESSAGE* rfx_pool_get_message(RFX_POOL* pool)
+{
+	RFX_MESSAGE_SLOT* slot;
+
+	if (pool->messages != NULL)
+	{
+		slot = pool->messages;
+		pool->messages = slot->next;
+		slot->next = NULL;
+	}
+	else
+	{
+		slot = (RFX_MESSAGE_SLOT*) rfx_pool_realloc(pool, NULL, sizeof(RFX_MESSAGE_SLOT));
+		memset(slot, 0, sizeof(RFX_MESSAGE_SLOT));
+	}
+
+	slot->message.num_rects = 0;
+	slot->message.num_tiles = 0;
+
+	return &slot->message;
+}
+
+void rfx_pool_put_message(RFX_POOL* pool, RFX_MESSAGE* message)
+{
+	RFX_MESSAGE_SLOT* slot = (RFX_MESSAGE_SLOT*) message;
+
+	rfx_pool_put_tiles(pool, message->tiles, message->num_tiles);
+	message->num_tiles = 0;
+	message->num_rects = 0;
+
+	slot->next = pool->messages;
+	pool->messages = slot;
+}
+
+void rfx_pool_message_alloc_rects(RFX_POOL* pool, RFX_MESSAGE* message, int count)
+{
+	RFX_MESSAGE_SLOT* slot = (RFX_MESSAGE_SLOT*) message;
+
+	if (slot->rects_size < count)
+	{
+		message->rects = (RFX_RECT*) rfx_pool_realloc(pool, message->rects, sizeof(RFX_RECT) * count);
+		slot->rects_size = count;
+	}
+
+	message->num_rects = count;
+}
+
+/**
+ * Fill the message with count tiles from the pool.
+ */
+void rfx_pool_message_alloc_tiles(RFX_POOL* pool, RFX_MESSAGE* message, int count)
+{
+	RFX_MESSAGE_SLOT* slot = (RFX_MESSAGE_SLOT*) message;
+
+	if (slot->tiles_size < count)
+	{
+		message->tiles = (RFX_TILE**) rfx_pool_realloc(pool, message->tiles, sizeof(RFX_TILE*) * count);
+		slot->tiles_size = count;
+	}
 
-	return tiles;
+	rfx_pool_get_tiles(pool, message->tiles, count);
+	message->num_tiles = count;
 }
@@ -22,19 +22,55 @@
 
 #include <freerdp/codec/rfx.h>
 
+/* number of tiles allocated at once */
+#define RFX_POOL_CHUNK_TILES 16
+
+/* told about every heap allocation the pool makes, see rfx_pool_realloc() */
+typedef void (*RFX_POOL_ALLOC_HOOK)(void* arg, size_t size);
+
+typedef struct _RFX_TILE_CHUNK RFX_TILE_CHUNK;
+
+struct _RFX_TILE_CHUNK
+{
+	RFX_TILE tiles[RFX_POOL_CHUNK_TILES];
+	uint8* buffer; /* tile data, the tiles start at the first 64-byte boundary */
+	RFX_TILE_CHUNK* next;
+};
+
+typedef struct _RFX_MESSAGE_SLOT RFX_MESSAGE_SLOT;
+
+/* a message and the capacity of its arrays, recycled by the pool */
+struct _RFX_MESSAGE_SLOT
+{
+	RFX_MESSAGE message; /* must be the first member */
+	int rects_size;
+	int tiles_size;
+	RFX_MESSAGE_SLOT* next;
+};
+
 struct _RFX_POOL
 {
 	int size;
 	int count;
-	RFX_TILE** tiles;
+	RFX_TILE** tiles; /* free tiles, room for every tile ever allocated */
+	RFX_TILE_CHUNK* chunks;
+	RFX_MESSAGE_SLOT* messages; /* free messages */
+	RFX_POOL_ALLOC_HOOK alloc_hook; /* NULL unless something is watching */
+	void* alloc_hook_arg;
 };
 typedef struct _RFX_POOL RFX_POOL;
 
 RFX_POOL* rfx_pool_new();
 void rfx_pool_free(RFX_POOL* pool);
+void* rfx_pool_realloc(RFX_POOL* pool, void* ptr, size_t size);
 void rfx_pool_put_tile(RFX_POOL* pool, RFX_TILE* tile);
 RFX_TILE* rfx_pool_get_tile(RFX_POOL* pool);
 void rfx_pool_put_tiles(RFX_POOL* pool, RFX_TILE** tiles, int count);
-RFX_TILE** rfx_pool_get_tiles(RFX_POOL* pool, int count);
+void rfx_pool_get_tiles(RFX_POOL* pool, RFX_TILE** tiles, int count);
+
+RFX_MESSAGE* rfx_pool_get_message(RFX_POOL* pool);
+void rfx_pool_put_message(RFX_POOL* pool, RFX_MESSAGE* message);
+void rfx_pool_message_alloc_rects(RFX_POOL* pool, RFX_MESSAGE* message, int count);
+void rfx_pool_message_alloc_tiles(RFX_POOL* pool, RFX_MESSAGE* message, int count);
 
 #endif /* __RFX_POOL_H */
@@ -0,0 +1,155 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * RemoteFX Codec Library - Rate Control
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rfx_types.h"
+#include "rfx_rate.h"
+
+/**
+ * Quantization tables from the finest (level 0) to the coarsest. Level 2 is
+ * the table used by the MS RDP server, which is also our fixed default.
+ * The order of the values is LL3, LH3, HL3, HH3, LH2, HL2, HH2, LH1, HL1, HH1.
+ */
+static const uint32 rfx_rate_quant_levels[RFX_QUALITY_LEVELS][10] =
+{
+	{ 6, 6, 6, 6, 6, 6, 6, 6, 6, 7 },
+	{ 6, 6, 6, 6, 6, 6, 7, 7, 7, 8 },
+	{ 6, 6, 6, 6, 7, 7, 8, 8, 8, 9 },
+	{ 6, 6, 6, 7, 7, 8, 9, 9, 9, 10 },
+	{ 7, 7, 7, 8, 8, 9, 10, 10, 10, 11 },
+	{ 7, 8, 8, 9, 9, 10, 11, 11, 11, 12 },
+	{ 8, 9, 9, 10, 10, 11, 12, 12, 12, 13 },
+	{ 9, 10, 10, 11, 11, 12, 13, 13, 13, 14 },
+	{ 10, 11, 11, 12, 12, 13, 14, 14, 14, 15 }
+};
+
+/**
+ * Expected size of a tile at each level relative to level 0, in 1/256 units.
+ * These only seed the prediction for levels that were not used recently; the
+ * estimate is corrected by every encoded frame.
+ */
+static const uint32 rfx_rate_level_ratio[RFX_QUALITY_LEVELS] =
+{
+	256, 200, 144, 112, 80, 51, 33, 18, 13
+};
+
+#define RFX_RATE_DEFAULT_LEVEL 2
+
+/**
+ * Whether num_tiles tiles are predicted to fit into the frame budget at
+ * level, which is the target plus the bits left over (or minus the bits
+ * overspent) by previous frames. Anything fits while there is no estimate.
+ */
+boolean rfx_rate_fits(RFX_CONTEXT* context, int num_tiles, int level)
+{
+	sint64 budget;
+	uint64 predicted;
+	RFX_CONTEXT_PRIV* priv = context->priv;
+
+	if (priv->rate_complexity == 0)
+		return true;
+
+	budget = (sint64) priv->rate_target_bits + priv->rate_credit;
+	predicted = (uint64) num_tiles * priv->rate_complexity * rfx_rate_level_ratio[level] / 256;
+
+	return (sint64) predicted <= budget;
+}
+
+/**
+ * The finest quantization level num_tiles tiles are predicted to fit at,
+ * or the coarsest one if none does.
+ */
+int rfx_rate_level(RFX_CONTEXT* context, int num_tiles)
+{
+	int level;
+
+	if (context->priv->rate_complexity == 0)
+		return RFX_RATE_DEFAULT_LEVEL;
+
+	for (level = 0; level < RFX_QUALITY_LEVELS - 1; level++)
+	{
+		if (rfx_rate_fits(context, num_tiles, level))
+			break;
+	}
+
+	return level;
+}
+
+/**
+ * Choose the quantization level of the next frame with rfx_rate_level().
+ * Returns two tables: the first one for luma, the second, one level
+ * coarser, for chroma, which the eye is less sensitive to.
+ */
+const uint32* rfx_rate_select(RFX_CONTEXT* context, int num_tiles)
+{
+	int level;
+	RFX_CONTEXT_PRIV* priv = context->priv;
+
+	level = rfx_rate_level(context, num_tiles);
+	priv->rate_level = level;
+
+	memcpy(priv->rate_quants, rfx_rate_quant_levels[level], 10 * sizeof(uint32));
+	memcpy(priv->rate_quants + 10, rfx_rate_quant_levels[MIN(level + 1, RFX_QUALITY_LEVELS - 1)],
+		10 * sizeof(uint32));
+
+	return priv->rate_quants;
+}
+
+/**
+ * Feed back the size of the frame that was just encoded.
+ */
+void rfx_rate_update(RFX_CONTEXT* context, int num_tiles, uint32 frame_bits)
+{
+	uint32 sample;
+	sint64 credit;
+	RFX_CONTEXT_PRIV* priv = context->priv;
+	RFX_RATE_STATS* stats = &priv->rate_stats;
+
+	stats->frame_bits = frame_bits;
+
+	if (stats->average_frame_bits == 0)
+		stats->average_frame_bits = frame_bits;
+	else
+		stats->average_frame_bits = (stats->average_frame_bits * 7 + frame_bits) / 8;
+
+	stats->bitrate = stats->average_frame_bits * priv->rate_frame_rate;
+
+	if (priv->rate_target_bits == 0 || num_tiles < 1)
+	{
+		stats->quality = -1;
+		return;
+	}
+
+	stats->quality = RFX_QUALITY_LEVELS - 1 - priv->rate_level;
+
+	/* bits per tile at level 0 */
+	sample = (uint32) ((uint64) frame_bits * 256 / rfx_rate_level_ratio[priv->rate_level] / num_tiles);
+
+	if (priv->rate_complexity == 0)
+		priv->rate_complexity = sample;
+	else
+		priv->rate_complexity = (priv->rate_complexity + sample) / 2;
+
+	/* carry over at most one frame worth of bits in either direction */
+	credit = priv->rate_credit + (sint64) priv->rate_target_bits - frame_bits;
+	credit = MIN(credit, (sint64) priv->rate_target_bits);
+	credit = MAX(credit, -((sint64) priv->rate_target_bits));
+	priv->rate_credit = credit;
+}
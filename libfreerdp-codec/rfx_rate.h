@@ -0,0 +1,28 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * RemoteFX Codec Library - Rate Control
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RFX_RATE_H
+#define __RFX_RATE_H
+
+#include <freerdp/codec/rfx.h>
+
+boolean rfx_rate_fits(RFX_CONTEXT* context, int num_tiles, int level);
+int rfx_rate_level(RFX_CONTEXT* context, int num_tiles);
+const uint32* rfx_rate_select(RFX_CONTEXT* context, int num_tiles);
+void rfx_rate_update(RFX_CONTEXT* context, int num_tiles, uint32 frame_bits);
+
+#endif /* __RFX_RATE_H */
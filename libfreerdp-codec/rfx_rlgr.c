@@ -26,7 +26,6 @@
 #include <stdlib.h>
 #include <string.h>
 #include <freerdp/utils/memory.h>
-#include "rfx_bitstream.h"
 
 #include "rfx_rlgr.h"
 
@@ -38,8 +37,143 @@
 #define UQ_GR	(3)   /* increase in kp after nonzero symbol in GR mode */
 #define DQ_GR	(3)   /* decrease in kp after zero symbol in GR mode */
 
+/**
+ * The bitstream is accessed through a 64 bit reservoir rather than bit by bit.
+ * Valid bits are kept MSB aligned in acc, the bits below them are always zero.
+ * Running past the end of the input behaves like RFX_BITSTREAM did: a read
+ * returns the bits that are left, right aligned, and zero afterwards.
+ */
+struct _RLGR_READER
+{
+	uint64 acc;
+	int bits;
+	const uint8* ptr;
+	const uint8* end;
+};
+typedef struct _RLGR_READER RLGR_READER;
+
+/* Bits are collected LSB aligned in acc and written out a byte at a time */
+struct _RLGR_WRITER
+{
+	uint64 acc;
+	int bits;
+	uint8* ptr;
+	uint8* start;
+	uint8* end;
+};
+typedef struct _RLGR_WRITER RLGR_WRITER;
+
+/* Number of leading zero bits, 64 for zero */
+#ifdef __GNUC__
+#define rlgr_clz64(_v) ((_v) ? __builtin_clzll(_v) : 64)
+#else
+static INLINE int rlgr_clz64(uint64 v)
+{
+	int n = 0;
+
+	if (v == 0)
+		return 64;
+
+	while (!(v & 0x8000000000000000ULL))
+	{
+		v <<= 1;
+		n++;
+	}
+
+	return n;
+}
+#endif
+
+static INLINE void rlgr_reader_refill(RLGR_READER* br)
+{
+	uint64 v;
+	int n;
+
+	if (br->bits > 56)
+		return;
+
+	if (br->end - br->ptr >= 8)
+	{
+		v = ((uint64) br->ptr[0] << 56) | ((uint64) br->ptr[1] << 48) |
+			((uint64) br->ptr[2] << 40) | ((uint64) br->ptr[3] << 32) |
+			((uint64) br->ptr[4] << 24) | ((uint64) br->ptr[5] << 16) |
+			((uint64) br->ptr[6] << 8) | (uint64) br->ptr[7];
+
+		/* take as many whole bytes as fit */
+		n = (64 - br->bits) >> 3;
+		br->acc |= (v >> br->bits) & (~((uint64) 0) << ((64 - br->bits) & 7));
+		br->ptr += n;
+		br->bits += n << 3;
+		return;
+	}
+
+	while (br->bits <= 56 && br->ptr < br->end)
+	{
+		br->acc |= (uint64) *br->ptr++ << (56 - br->bits);
+		br->bits += 8;
+	}
+}
+
+static INLINE void rlgr_reader_skip(RLGR_READER* br, int nbits)
+{
+	br->acc = (nbits < 64) ? (br->acc << nbits) : 0;
+	br->bits -= nbits;
+}
+
+#define rlgr_reader_eos(_br) ((_br)->bits == 0 && (_br)->ptr >= (_br)->end)
+
 /* Gets (returns) the next nBits from the bitstream */
-#define GetBits(nBits, r) rfx_bitstream_get_bits(bs, nBits, r)
+static INLINE uint32 rlgr_get_bits(RLGR_READER* br, int nbits)
+{
+	uint32 r;
+
+	if (br->bits < nbits)
+	{
+		rlgr_reader_refill(br);
+
+		if (br->bits < nbits)
+			nbits = br->bits;
+	}
+
+	if (nbits == 0)
+		return 0;
+
+	r = (uint32) (br->acc >> (64 - nbits));
+	rlgr_reader_skip(br, nbits);
+
+	return r;
+}
+
+/* Counts and consumes the 1 bits up to and including the terminating 0 */
+static INLINE uint32 rlgr_get_unary(RLGR_READER* br)
+{
+	uint32 vk = 0;
+	int n;
+
+	while (1)
+	{
+		if (br->bits == 0)
+		{
+			rlgr_reader_refill(br);
+
+			if (br->bits == 0)
+				return vk;
+		}
+
+		n = rlgr_clz64(~br->acc);
+
+		if (n < br->bits)
+		{
+			rlgr_reader_skip(br, n + 1);
+			return vk + n;
+		}
+
+		vk += br->bits;
+		rlgr_reader_skip(br, br->bits);
+	}
+}
+
+#define GetBits(nBits, r) r = rlgr_get_bits(br, nBits)
 
 /* From current output pointer, write "value", check and update buffer_size */
 #define WriteValue(value) \
@@ -67,12 +201,7 @@
 #define GetMinBits(_val, _nbits) \
 { \
 	uint32 _v = _val; \
-	_nbits = 0; \
-	while (_v) \
-	{ \
-		_v >>= 1; \
-		_nbits++; \
-	} \
+	_nbits = _v ? 32 - rlgr_clz64((uint64) _v << 32) : 0; \
 }
 
 /* Converts from (2 * magnitude - sign) to integer */
@@ -94,16 +223,8 @@
 
 /* Outputs the Golomb/Rice encoding of a non-negative integer */
 #define GetGRCode(krp, kr, vk, _mag) \
-	vk = 0; \
-	_mag = 0; \
-	/* chew up/count leading 1s and escape 0 */ \
-	do { \
-		GetBits(1, r); \
-		if (r == 1) \
-			vk++; \
-		else \
-			break; \
-	} while (1); \
+	/* count leading 1s and the escape 0 */ \
+	vk = rlgr_get_unary(br); \
 	/* get next *kr bits, and combine with leading 1s */ \
 	GetBits(*kr, _mag); \
 	_mag |= (vk << *kr); \
@@ -121,15 +242,18 @@ int rfx_rlgr_decode(RLGR_MODE mode, const uint8* data, int data_size, sint16* bu
 	int kp;
 	int kr;
 	int krp;
-	uint16 r;
+	int n;
 	sint16* dst;
-	RFX_BITSTREAM* bs;
+	RLGR_READER reader;
+	RLGR_READER* br = &reader;
 
 	int vk;
 	uint16 mag16;
 
-	bs = xnew(RFX_BITSTREAM);
-	rfx_bitstream_attach(bs, data, data_size);
+	br->acc = 0;
+	br->bits = 0;
+	br->ptr = data;
+	br->end = data + data_size;
 	dst = buffer;
 
 	/* initialize the parameters */
@@ -138,7 +262,7 @@ int rfx_rlgr_decode(RLGR_MODE mode, const uint8* data, int data_size, sint16* bu
 	kr = 1;
 	krp = kr << LSGR;
 
-	while (!rfx_bitstream_eos(bs) && buffer_size > 0)
+	while (!rlgr_reader_eos(br) && buffer_size > 0)
 	{
 		int run;
 		if (k)
@@ -147,14 +271,34 @@ int rfx_rlgr_decode(RLGR_MODE mode, const uint8* data, int data_size, sint16* bu
 			uint32 sign;
 
 			/* RL MODE */
-			while (!rfx_bitstream_eos(bs))
+			while (1)
 			{
-				GetBits(1, r);
-				if (r)
+				if (br->bits == 0)
+				{
+					rlgr_reader_refill(br);
+
+					if (br->bits == 0)
+						break;
+				}
+
+				/* a "1" ends the sequence of RL escapes */
+				if (br->acc >> 63)
+				{
+					rlgr_reader_skip(br, 1);
 					break;
-				/* we have an RL escape "0", which translates to a run (1<<k) of zeros */
-				WriteZeroes(1 << k);
-				UpdateParam(kp, UP_GR, k); /* raise k and kp up because of zero run */
+				}
+
+				n = rlgr_clz64(br->acc);
+				if (n > br->bits)
+					n = br->bits;
+				rlgr_reader_skip(br, n);
+
+				/* we have n RL escape "0"s, each translates to a run (1<<k) of zeros */
+				for (; n > 0; n--)
+				{
+					WriteZeroes(1 << k);
+					UpdateParam(kp, UP_GR, k); /* raise k and kp up because of zero run */
+				}
 			}
 
 			/* next k bits will contain remaining run or zeros */
@@ -228,11 +372,55 @@ int rfx_rlgr_decode(RLGR_MODE mode, const uint8* data, int data_size, sint16* bu
 		}
 	}
 
-	xfree(bs);
-
 	return (dst - buffer);
 }
 
+static INLINE void rlgr_writer_flush(RLGR_WRITER* bw)
+{
+	while (bw->bits >= 8)
+	{
+		bw->bits -= 8;
+
+		/* bits past the end of the output buffer are dropped */
+		if (bw->ptr < bw->end)
+			*bw->ptr++ = (uint8) (bw->acc >> bw->bits);
+	}
+}
+
+/* Emit the low nbits (at most 32) of value to the output bitstream */
+static INLINE void rlgr_put_bits(RLGR_WRITER* bw, uint32 value, int nbits)
+{
+	if (nbits < 32)
+		value &= (1 << nbits) - 1;
+
+	bw->acc = (bw->acc << nbits) | value;
+	bw->bits += nbits;
+
+	if (bw->bits >= 32)
+		rlgr_writer_flush(bw);
+}
+
+/* Emit count copies of bit */
+static INLINE void rlgr_put_bit(RLGR_WRITER* bw, uint32 count, int bit)
+{
+	uint32 pattern = bit ? 0xFFFFFFFF : 0;
+
+	for (; count >= 32; count -= 32)
+		rlgr_put_bits(bw, pattern, 32);
+
+	if (count > 0)
+		rlgr_put_bits(bw, pattern, count);
+}
+
+static INLINE int rlgr_is_zero4(const sint16* data)
+{
+	uint64 v;
+
+	memcpy(&v, data, sizeof(v));
+
+	return (v == 0);
+}
+
 /* Returns the next coefficient (a signed int) to encode, from the input stream */
 #define GetNextInput(_n) \
 { \
@@ -248,24 +436,18 @@ int rfx_rlgr_decode(RLGR_MODE mode, const uint8* data, int data_size, sint16* bu
 }
 
 /* Emit bitPattern to the output bitstream */
-#define OutputBits(numBits, bitPattern) rfx_bitstream_put_bits(bs, bitPattern, numBits)
+#define OutputBits(numBits, bitPattern) rlgr_put_bits(bw, (uint16) (bitPattern), numBits)
 
 /* Emit a bit (0 or 1), count number of times, to the output bitstream */
-#define OutputBit(count, bit) \
-{	\
-	uint16 _b = (bit ? 0xFFFF : 0); \
-	int _c = (count); \
-	for (; _c > 0; _c -= 16) \
-		rfx_bitstream_put_bits(bs, _b, (_c > 16 ? 16 : _c)); \
-}
+#define OutputBit(count, bit) rlgr_put_bit(bw, count, bit)
 
 /* Converts the input value to (2 * abs(input) - sign(input)), where sign(input) = (input < 0 ? 1 : 0) and returns it */
 #define Get2MagSign(input) ((input) >= 0 ? 2 * (input) : -2 * (input) - 1)
 
 /* Outputs the Golomb/Rice encoding of a non-negative integer */
-#define CodeGR(krp, val) rfx_rlgr_code_gr(bs, krp, val)
+#define CodeGR(krp, val) rfx_rlgr_code_gr(bw, krp, val)
 
-static void rfx_rlgr_code_gr(RFX_BITSTREAM* bs, int* krp, uint32 val)
+static void rfx_rlgr_code_gr(RLGR_WRITER* bw, int* krp, uint32 val)
 {
 	int kr = *krp >> LSGR;
 
@@ -297,11 +479,14 @@ int rfx_rlgr_encode(RLGR_MODE mode, const sint16* data, int data_size, uint8* bu
 	int k;
 	int kp;
 	int krp;
-	RFX_BITSTREAM* bs;
-	int processed_size;
+	RLGR_WRITER writer;
+	RLGR_WRITER* bw = &writer;
 
-	bs = xnew(RFX_BITSTREAM);
-	rfx_bitstream_attach(bs, buffer, buffer_size);
+	bw->acc = 0;
+	bw->bits = 0;
+	bw->ptr = buffer;
+	bw->start = buffer;
+	bw->end = buffer + buffer_size;
 
 	/* initialize the parameters */
 	k = 1;
@@ -322,8 +507,14 @@ int rfx_rlgr_encode(RLGR_MODE mode, const sint16* data, int data_size, uint8* bu
 
 			/* RUN-LENGTH MODE */
 
-			/* collect the run of zeros in the input stream */
+			/* collect the run of zeros in the input stream, four at a time while possible */
 			numZeros = 0;
+			while (data_size > 4 && rlgr_is_zero4(data))
+			{
+				data += 4;
+				data_size -= 4;
+				numZeros += 4;
+			}
 			GetNextInput(input);
 			while (input == 0 && data_size > 0)
 			{
@@ -424,8 +615,11 @@ int rfx_rlgr_encode(RLGR_MODE mode, const sint16* data, int data_size, uint8* bu
 		}
 	}
 
-	processed_size = rfx_bitstream_get_processed_bytes(bs);
-	xfree(bs);
+	/* pad the last byte with zero bits */
+	rlgr_writer_flush(bw);
+	if (bw->bits > 0)
+		rlgr_put_bits(bw, 0, 8 - bw->bits);
+	rlgr_writer_flush(bw);
 
-	return processed_size;
+	return (bw->ptr - bw->start);
 }
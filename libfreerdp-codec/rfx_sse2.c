@@ -25,6 +25,7 @@
 #include <emmintrin.h>
 
 #include "rfx_types.h"
+#include "rfx_encode.h"
 #include "rfx_sse2.h"
 
 #ifdef _MSC_VER
@@ -130,21 +131,15 @@ static void rfx_decode_ycbcr_to_rgb_sse2(sint16* y_r_buffer, sint16* cb_g_buffer
 }
 
 /* The encodec YCbCr coeffectients are represented as 11.5 fixed-point numbers. See rfx_encode.c */
-static void rfx_encode_rgb_to_ycbcr_sse2(sint16* y_r_buffer, sint16* cb_g_buffer, sint16* cr_b_buffer)
+static __inline void __attribute__((__gnu_inline__, __always_inline__, __artificial__))
+rfx_encode_ycbcr_sse2(__m128i r, __m128i g, __m128i b, __m128i* y_out, __m128i* cb_out, __m128i* cr_out)
 {
 	__m128i min = _mm_set1_epi16(-128 << 5);
 	__m128i max = _mm_set1_epi16(127 << 5);
 
-	__m128i* y_r_buf = (__m128i*) y_r_buffer;
-	__m128i* cb_g_buf = (__m128i*) cb_g_buffer;
-	__m128i* cr_b_buf = (__m128i*) cr_b_buffer;
-
 	__m128i y;
 	__m128i cr;
 	__m128i cb;
-	__m128i r;
-	__m128i g;
-	__m128i b;
 
 	__m128i y_r  = _mm_set1_epi16(9798);   //  0.299000 << 15
 	__m128i y_g  = _mm_set1_epi16(19235);  //  0.587000 << 15
@@ -156,6 +151,55 @@ static void rfx_encode_rgb_to_ycbcr_sse2(sint16* y_r_buffer, sint16* cb_g_buffer
 	__m128i cr_g = _mm_set1_epi16(-13714); // -0.418531 << 15
 	__m128i cr_b = _mm_set1_epi16(-2663);  // -0.081282 << 15
 
+	/*
+	In order to use SSE2 signed 16-bit integer multiplication we need to convert
+	the floating point factors to signed int without loosing information.
+	The result of this multiplication is 32 bit and using SSE2 we get either the
+	product's hi or lo word.
+	Thus we will multiply the factors by the highest possible 2^n and take the
+	upper 16 bits of the signed 32-bit result (_mm_mulhi_epi16).
+	Since the final result needs to be scaled by << 5 and also in in order to keep
+	the precision within the upper 16 bits we will also have to scale the RGB
+	values used in the multiplication by << 5+(16-n).
+	*/
+
+	/* r<<6; g<<6; b<<6 */
+	r = _mm_slli_epi16(r, 6);
+	g = _mm_slli_epi16(g, 6);
+	b = _mm_slli_epi16(b, 6);
+
+	/* y = HIWORD(r*y_r) + HIWORD(g*y_g) + HIWORD(b*y_b) + min */
+	y = _mm_mulhi_epi16(r, y_r);
+	y = _mm_add_epi16(y, _mm_mulhi_epi16(g, y_g));
+	y = _mm_add_epi16(y, _mm_mulhi_epi16(b, y_b));
+	y = _mm_add_epi16(y, min);
+	/* y_r_buf[i] = MINMAX(y, 0, (255 << 5)) - (128 << 5); */
+	_mm_between_epi16(y, min, max);
+	*y_out = y;
+
+	/* cb = HIWORD(r*cb_r) + HIWORD(g*cb_g) + HIWORD(b*cb_b) */
+	cb = _mm_mulhi_epi16(r, cb_r);
+	cb = _mm_add_epi16(cb, _mm_mulhi_epi16(g, cb_g));
+	cb = _mm_add_epi16(cb, _mm_mulhi_epi16(b, cb_b));
+	/* cb_g_buf[i] = MINMAX(cb, (-128 << 5), (127 << 5)); */
+	_mm_between_epi16(cb, min, max);
+	*cb_out = cb;
+
+	/* cr = HIWORD(r*cr_r) + HIWORD(g*cr_g) + HIWORD(b*cr_b) */
+	cr = _mm_mulhi_epi16(r, cr_r);
+	cr = _mm_add_epi16(cr, _mm_mulhi_epi16(g, cr_g));
+	cr = _mm_add_epi16(cr, _mm_mulhi_epi16(b, cr_b));
+	/* cr_b_buf[i] = MINMAX(cr, (-128 << 5), (127 << 5)); */
+	_mm_between_epi16(cr, min, max);
+	*cr_out = cr;
+}
+
+static void rfx_encode_rgb_to_ycbcr_sse2(sint16* y_r_buffer, sint16* cb_g_buffer, sint16* cr_b_buffer)
+{
+	__m128i* y_r_buf = (__m128i*) y_r_buffer;
+	__m128i* cb_g_buf = (__m128i*) cb_g_buffer;
+	__m128i* cr_b_buf = (__m128i*) cr_b_buffer;
+
 	int i;
 
 	for (i = 0; i < (4096 * sizeof(sint16) / sizeof(__m128i)); i += (CACHE_LINE_BYTES / sizeof(__m128i)))
@@ -166,57 +210,105 @@ static void rfx_encode_rgb_to_ycbcr_sse2(sint16* y_r_buffer, sint16* cb_g_buffer
 	}
 	for (i = 0; i < (4096 * sizeof(sint16) / sizeof(__m128i)); i++)
 	{
-		/*
-		In order to use SSE2 signed 16-bit integer multiplication we need to convert
-		the floating point factors to signed int without loosing information.
-		The result of this multiplication is 32 bit and using SSE2 we get either the
-		product's hi or lo word.
-		Thus we will multiply the factors by the highest possible 2^n and take the
-		upper 16 bits of the signed 32-bit result (_mm_mulhi_epi16).
-		Since the final result needs to be scaled by << 5 and also in in order to keep
-		the precision within the upper 16 bits we will also have to scale the RGB
-		values used in the multiplication by << 5+(16-n).
-		*/
+		rfx_encode_ycbcr_sse2(_mm_load_si128(&y_r_buf[i]), _mm_load_si128(&cb_g_buf[i]),
+			_mm_load_si128(&cr_b_buf[i]), &y_r_buf[i], &cb_g_buf[i], &cr_b_buf[i]);
+	}
+}
+
+/**
+ * Unpack 8 pixels into 16-bit r, g and b lanes. 32bpp pixels are split with
+ * shifts and masks and narrowed with packs, which cannot saturate on bytes.
+ */
+static __inline void __attribute__((__gnu_inline__, __always_inline__, __artificial__))
+rfx_unpack_rgb_sse2(const uint8* src, RFX_PIXEL_FORMAT pixel_format, __m128i* r, __m128i* g, __m128i* b)
+{
+	__m128i lo, hi;
+	__m128i px;
+	__m128i mask = _mm_set1_epi32(0xFF);
+
+	switch (pixel_format)
+	{
+		case RFX_PIXEL_FORMAT_BGRA:
+		case RFX_PIXEL_FORMAT_RGBA:
+			lo = _mm_loadu_si128((__m128i*) src);
+			hi = _mm_loadu_si128((__m128i*) (src + 16));
+			*b = _mm_packs_epi32(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask));
+			*g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 8), mask),
+				_mm_and_si128(_mm_srli_epi32(hi, 8), mask));
+			*r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 16), mask),
+				_mm_and_si128(_mm_srli_epi32(hi, 16), mask));
+
+			if (pixel_format == RFX_PIXEL_FORMAT_RGBA)
+			{
+				px = *r;
+				*r = *b;
+				*b = px;
+			}
+			break;
+
+		default:
+			/* BGR565_LE: r in bits 0-4, g in bits 5-10, b in bits 11-15, expanded like rfx_encode_format_rgb() */
+			px = _mm_loadu_si128((__m128i*) src);
+			*b = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(px, 8), _mm_set1_epi16(0xF8)), _mm_srli_epi16(px, 13));
+			*g = _mm_and_si128(_mm_srli_epi16(px, 3), _mm_set1_epi16(0xFC));
+			*r = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(px, 3), _mm_set1_epi16(0xF8)),
+				_mm_and_si128(_mm_srli_epi16(px, 2), _mm_set1_epi16(0x07)));
+
+			if (pixel_format == RFX_PIXEL_FORMAT_RGB565_LE)
+			{
+				px = *r;
+				*r = *b;
+				*b = px;
+			}
+			break;
+	}
+}
+
+static boolean rfx_encode_format_rgb_to_ycbcr_sse2(const uint8* rgb_data, int width, int height, int rowstride,
+	RFX_PIXEL_FORMAT pixel_format, sint16* y_buf, sint16* cb_buf, sint16* cr_buf)
+{
+	int x, y;
+	int bpp;
+	const uint8* src;
+	__m128i r, g, b;
+	__m128i row[64 * 4 / sizeof(__m128i)];
 
-		/* r = y_r_buf[i]; */
-		r = _mm_load_si128(&y_r_buf[i]);
-
-		/* g = cb_g_buf[i]; */
-		g = _mm_load_si128(&cb_g_buf[i]);
-
-		/* b = cr_b_buf[i]; */
-		b = _mm_load_si128(&cr_b_buf[i]);
-
-		/* r<<6; g<<6; b<<6 */
-		r = _mm_slli_epi16(r, 6);
-		g = _mm_slli_epi16(g, 6);
-		b = _mm_slli_epi16(b, 6);
-
-		/* y = HIWORD(r*y_r) + HIWORD(g*y_g) + HIWORD(b*y_b) + min */
-		y = _mm_mulhi_epi16(r, y_r);
-		y = _mm_add_epi16(y, _mm_mulhi_epi16(g, y_g));
-		y = _mm_add_epi16(y, _mm_mulhi_epi16(b, y_b));
-		y = _mm_add_epi16(y, min);
-		/* y_r_buf[i] = MINMAX(y, 0, (255 << 5)) - (128 << 5); */
-		_mm_between_epi16(y, min, max);
-		_mm_store_si128(&y_r_buf[i], y);
-
-		/* cb = HIWORD(r*cb_r) + HIWORD(g*cb_g) + HIWORD(b*cb_b) */
-		cb = _mm_mulhi_epi16(r, cb_r);
-		cb = _mm_add_epi16(cb, _mm_mulhi_epi16(g, cb_g));
-		cb = _mm_add_epi16(cb, _mm_mulhi_epi16(b, cb_b));
-		/* cb_g_buf[i] = MINMAX(cb, (-128 << 5), (127 << 5)); */
-		_mm_between_epi16(cb, min, max);
-		_mm_store_si128(&cb_g_buf[i], cb);
-
-		/* cr = HIWORD(r*cr_r) + HIWORD(g*cr_g) + HIWORD(b*cr_b) */
-		cr = _mm_mulhi_epi16(r, cr_r);
-		cr = _mm_add_epi16(cr, _mm_mulhi_epi16(g, cr_g));
-		cr = _mm_add_epi16(cr, _mm_mulhi_epi16(b, cr_b));
-		/* cr_b_buf[i] = MINMAX(cr, (-128 << 5), (127 << 5)); */
-		_mm_between_epi16(cr, min, max);
-		_mm_store_si128(&cr_b_buf[i], cr);
+	switch (pixel_format)
+	{
+		case RFX_PIXEL_FORMAT_BGRA:
+		case RFX_PIXEL_FORMAT_RGBA:
+			bpp = 4;
+			break;
+		case RFX_PIXEL_FORMAT_BGR565_LE:
+		case RFX_PIXEL_FORMAT_RGB565_LE:
+			bpp = 2;
+			break;
+		default:
+			return false;
 	}
+
+	for (y = 0; y < height; y++)
+	{
+		src = rgb_data + y * rowstride;
+
+		/* never read past the end of a partial row, the padding is added afterwards */
+		if (width < 64)
+		{
+			memcpy(row, src, width * bpp);
+			src = (uint8*) row;
+		}
+
+		for (x = 0; x < 64; x += 8)
+		{
+			rfx_unpack_rgb_sse2(src + x * bpp, pixel_format, &r, &g, &b);
+			rfx_encode_ycbcr_sse2(r, g, b,
+				(__m128i*) &y_buf[y * 64 + x], (__m128i*) &cb_buf[y * 64 + x], (__m128i*) &cr_buf[y * 64 + x]);
+		}
+	}
+
+	rfx_encode_pad_planes(width, height, y_buf, cb_buf, cr_buf);
+
+	return true;
 }
 
 static __inline void __attribute__((__gnu_inline__, __always_inline__, __artificial__))
@@ -655,6 +747,7 @@ void rfx_init_sse2(RFX_CONTEXT* context)
 
 	IF_PROFILER(context->priv->prof_rfx_decode_ycbcr_to_rgb->name = "rfx_decode_ycbcr_to_rgb_sse2");
 	IF_PROFILER(context->priv->prof_rfx_encode_rgb_to_ycbcr->name = "rfx_encode_rgb_to_ycbcr_sse2");
+	IF_PROFILER(context->priv->prof_rfx_encode_format_rgb_to_ycbcr->name = "rfx_encode_format_rgb_to_ycbcr_sse2");
 	IF_PROFILER(context->priv->prof_rfx_quantization_decode->name = "rfx_quantization_decode_sse2");
 	IF_PROFILER(context->priv->prof_rfx_quantization_encode->name = "rfx_quantization_encode_sse2");
 	IF_PROFILER(context->priv->prof_rfx_dwt_2d_decode->name = "rfx_dwt_2d_decode_sse2");
@@ -662,6 +755,7 @@ void rfx_init_sse2(RFX_CONTEXT* context)
 
 	context->decode_ycbcr_to_rgb = rfx_decode_ycbcr_to_rgb_sse2;
 	context->encode_rgb_to_ycbcr = rfx_encode_rgb_to_ycbcr_sse2;
+	context->encode_format_rgb_to_ycbcr = rfx_encode_format_rgb_to_ycbcr_sse2;
 	context->quantization_decode = rfx_quantization_decode_sse2;
 	context->quantization_encode = rfx_quantization_encode_sse2;
 	context->dwt_2d_decode = rfx_dwt_2d_decode_sse2;
@@ -23,6 +23,7 @@
 #include "config.h"
 #include <freerdp/utils/debug.h>
 #include <freerdp/utils/profiler.h>
+#include <freerdp/utils/thread_pool.h>
 
 #ifdef WITH_DEBUG_RFX
 #define DEBUG_RFX(fmt, ...) DEBUG_CLASS(RFX, fmt, ## __VA_ARGS__)
@@ -32,23 +33,88 @@
 
 #include "rfx_pool.h"
 
-struct _RFX_CONTEXT_PRIV
+struct _RFX_SCRATCH
 {
-	/* pre-allocated buffers */
-
-	RFX_POOL* pool; /* memory pool */
-
 	sint16 y_r_mem[4096 + 8]; /* 4096 = 64x64 (+ 8x2 = 16 for mem align) */
 	sint16 cb_g_mem[4096 + 8]; /* 4096 = 64x64 (+ 8x2 = 16 for mem align) */
 	sint16 cr_b_mem[4096 + 8]; /* 4096 = 64x64 (+ 8x2 = 16 for mem align) */
- 
- 	sint16* y_r_buffer;
+
+	sint16* y_r_buffer;
 	sint16* cb_g_buffer;
 	sint16* cr_b_buffer;
- 
+
 	sint16 dwt_mem[32 * 32 * 2 * 2 + 8]; /* maximum sub-band width is 32 */
 
 	sint16* dwt_buffer;
+};
+typedef struct _RFX_SCRATCH RFX_SCRATCH;
+
+typedef struct _RFX_TILE_JOB RFX_TILE_JOB;
+
+/* destination of rfx_process_message_to_surface() */
+struct _RFX_SURFACE
+{
+	uint8* data;
+	int stride;
+	RFX_PIXEL_FORMAT format;
+	int width;
+	int height;
+	int left; /* position of the message origin on the surface */
+	int top;
+
+	const RFX_RECT* rects; /* clipping rects of the current message */
+	int num_rects;
+};
+typedef struct _RFX_SURFACE RFX_SURFACE;
+
+struct _RFX_CONTEXT_PRIV
+{
+	/* pre-allocated buffers */
+
+	RFX_POOL* pool; /* tile and message arena */
+	STREAM* stream; /* attached to the message being decoded */
+	int quants_size; /* number of quantization tables context->quants can hold */
+
+	RFX_SCRATCH scratch; /* tile buffers of the calling thread */
+
+	/* multi-threaded tile decoding and encoding */
+
+	freerdp_thread_pool* thread_pool;
+	RFX_SCRATCH* thread_scratch; /* one per thread, indexed by worker */
+
+	RFX_SURFACE* surface; /* set while decoding straight into a surface */
+
+	RFX_TILE_JOB* tile_jobs; /* per-tile decoding work of the current tileset */
+	int tile_jobs_size;
+
+	STREAM** tile_streams; /* per-tile encoder output, concatenated in tile order */
+	int tile_streams_size;
+
+	/* unchanged tile skipping in the encoder */
+
+	boolean tile_cache;
+	uint64* tile_hashes; /* fingerprint of the last tile sent per grid position, 0 if unknown */
+	uint8* tile_levels; /* rate control level that tile was sent at, 0 without rate control */
+	int tile_hashes_cols;
+	int tile_hashes_rows;
+
+	int* dirty_tiles; /* indices of the tiles to encode in the current frame */
+	uint64* frame_hashes; /* fingerprints of the candidate tiles, same size */
+	int dirty_tiles_size;
+
+	RFX_RECT* dirty_rects; /* caller rects clipped to the dirty tiles */
+	int num_dirty_rects;
+	int dirty_rects_size;
+
+	/* encoder rate control */
+
+	uint32 rate_target_bits; /* per frame, 0 if rate control is off */
+	uint32 rate_frame_rate; /* frames per second, 0 if unknown */
+	sint64 rate_credit; /* bits left over by previous frames, negative if overspent */
+	uint32 rate_complexity; /* estimated bits per tile at the finest level */
+	int rate_level; /* quantization level of the current frame, 0 is the finest */
+	uint32 rate_quants[20]; /* luma and chroma tables of the current frame */
+	RFX_RATE_STATS rate_stats;
 
 	/* profilers */
 	PROFILER_DEFINE(prof_rfx_decode_rgb);
@@ -67,6 +133,7 @@ struct _RFX_CONTEXT_PRIV
 	PROFILER_DEFINE(prof_rfx_quantization_encode);
 	PROFILER_DEFINE(prof_rfx_dwt_2d_encode);
 	PROFILER_DEFINE(prof_rfx_encode_rgb_to_ycbcr);
+	PROFILER_DEFINE(prof_rfx_encode_format_rgb_to_ycbcr);
 	PROFILER_DEFINE(prof_rfx_encode_format_rgb);
 };
 
@@ -1426,6 +1426,7 @@ void rdp_read_bitmap_codecs_capability_set(STREAM* s, uint16 length, rdpSettings
 {
 	uint8 bitmapCodecCount;
 	uint16 codecPropertiesLength;
+	boolean jpeg;
 
 	stream_read_uint8(s, bitmapCodecCount); /* bitmapCodecCount (1 byte) */
 
@@ -1433,10 +1434,13 @@ void rdp_read_bitmap_codecs_capability_set(STREAM* s, uint16 length, rdpSettings
 	{
 		settings->rfx_codec = false;
 		settings->ns_codec = false;
+		settings->jpeg_codec = false;
 	}
 
 	while (bitmapCodecCount > 0)
 	{
+		jpeg = false;
+
 		if (settings->server_mode && strncmp((char*)stream_get_tail(s), CODEC_GUID_REMOTEFX, 16) == 0)
 		{
 			stream_seek(s, 16); /* codecGUID (16 bytes) */
@@ -1449,6 +1453,13 @@ void rdp_read_bitmap_codecs_capability_set(STREAM* s, uint16 length, rdpSettings
 			stream_read_uint8(s, settings->ns_codec_id);
 			settings->ns_codec = true;
 		}
+		else if (settings->server_mode && strncmp((char*)stream_get_tail(s), CODEC_GUID_JPEG, 16) == 0)
+		{
+			stream_seek(s, 16); /* codec GUID (16 bytes) */
+			stream_read_uint8(s, settings->jpeg_codec_id);
+			settings->jpeg_codec = true;
+			jpeg = true;
+		}
 		else
 		{
 			stream_seek(s, 16); /* codecGUID (16 bytes) */
@@ -1456,6 +1467,10 @@ void rdp_read_bitmap_codecs_capability_set(STREAM* s, uint16 length, rdpSettings
 		}
 
 		stream_read_uint16(s, codecPropertiesLength); /* codecPropertiesLength (2 bytes) */
+
+		if (jpeg && codecPropertiesLength >= 1)
+			stream_peek_uint8(s, settings->jpeg_quality); /* quality the client asks for */
+
 		stream_seek(s, codecPropertiesLength); /* codecProperties */
 
 		bitmapCodecCount--;
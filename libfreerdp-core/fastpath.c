@@ -640,12 +640,15 @@ tbool fastpath_send_update_pdu(rdpFastPath* fastpath, uint8 updateCode, STREAM*
 	int fragment;
 	int sec_bytes;
 	uint16 length;
+	uint16 dataLength;
 	tbool result;
+	tbool compressed;
 	uint16 pduLength;
 	uint16 maxLength;
 	uint32 totalLength;
 	uint8 fragmentation;
 	uint8 header;
+	STREAM* frame;
 	STREAM* update;
 
 	result = true;
@@ -657,11 +660,17 @@ tbool fastpath_send_update_pdu(rdpFastPath* fastpath, uint8 updateCode, STREAM*
 	stream_set_pos(s, 0);
 	update = stream_new(0);
 
+	/* fragments are compressed one by one, each has to fit in the history */
+	if (rdp->mppc_enc != NULL)
+		maxLength = MIN(maxLength, rdp->mppc_enc->buf_len);
+
+	/* the fragments go out together */
+	transport_cork(rdp->transport);
+
 	for (fragment = 0; totalLength > 0; fragment++)
 	{
 		length = MIN(maxLength, totalLength);
 		totalLength -= length;
-		pduLength = length + 6 + sec_bytes;
 
 		if (totalLength == 0)
 			fragmentation = (fragment == 0) ? FASTPATH_FRAGMENT_SINGLE : FASTPATH_FRAGMENT_LAST;
@@ -669,27 +678,59 @@ tbool fastpath_send_update_pdu(rdpFastPath* fastpath, uint8 updateCode, STREAM*
 			fragmentation = (fragment == 0) ? FASTPATH_FRAGMENT_FIRST : FASTPATH_FRAGMENT_NEXT;
 
 		stream_get_mark(s, bm);
+		compressed = false;
+
+		if (rdp->mppc_enc != NULL)
+			compressed = compress_rdp(rdp->mppc_enc, bm + 6 + sec_bytes, length);
+
+		if (compressed)
+		{
+			/* one more header byte for the compression flags, the data moves to sendData */
+			frame = fastpath->sendData;
+			dataLength = rdp->mppc_enc->bytes_in_opb;
+			pduLength = dataLength + 7 + sec_bytes;
+			stream_set_pos(frame, 0);
+			memcpy(frame->data + 7 + sec_bytes, rdp->mppc_enc->output_buf, dataLength);
+		}
+		else
+		{
+			/* the header goes in front of the data, over the end of the previous fragment */
+			frame = s;
+			dataLength = length;
+			pduLength = dataLength + 6 + sec_bytes;
+		}
+
+		stream_get_mark(frame, ptr);
 		header = 0;
 		if (sec_bytes > 0)
 			header |= (FASTPATH_OUTPUT_ENCRYPTED << 6);
-		stream_write_uint8(s, header); /* fpOutputHeader (1 byte) */
-		stream_write_uint8(s, 0x80 | (pduLength >> 8)); /* length1 */
-		stream_write_uint8(s, pduLength & 0xFF); /* length2 */
+		stream_write_uint8(frame, header); /* fpOutputHeader (1 byte) */
+		stream_write_uint8(frame, 0x80 | (pduLength >> 8)); /* length1 */
+		stream_write_uint8(frame, pduLength & 0xFF); /* length2 */
 		if (sec_bytes > 0)
-			stream_seek(s, sec_bytes);
-		fastpath_write_update_header(s, updateCode, fragmentation, 0);
-		stream_write_uint16(s, length);
+			stream_seek(frame, sec_bytes);
 
-		stream_attach(update, bm, pduLength);
+		if (compressed)
+		{
+			fastpath_write_update_header(frame, updateCode, fragmentation, FASTPATH_OUTPUT_COMPRESSION_USED);
+			stream_write_uint8(frame, rdp->mppc_enc->flags); /* compressionFlags (1 byte) */
+		}
+		else
+		{
+			fastpath_write_update_header(frame, updateCode, fragmentation, 0);
+		}
+
+		stream_write_uint16(frame, dataLength);
+
+		stream_attach(update, ptr, pduLength);
 		stream_seek(update, pduLength);
 		if (sec_bytes > 0)
 		{
-			ptr = bm + 3 + sec_bytes;
 			if (rdp->sec_flags & SEC_SECURE_CHECKSUM)
-				security_salted_mac_signature(rdp, ptr, length + 3, true, bm + 3);
+				security_salted_mac_signature(rdp, ptr + 3 + sec_bytes, pduLength - 3 - sec_bytes, true, ptr + 3);
 			else
-				security_mac_signature(rdp, ptr, length + 3, bm + 3);
-			security_encrypt(ptr, length + 3, rdp);
+				security_mac_signature(rdp, ptr + 3 + sec_bytes, pduLength - 3 - sec_bytes, ptr + 3);
+			security_encrypt(ptr + 3 + sec_bytes, pduLength - 3 - sec_bytes, rdp);
 		}
 		if (transport_write(fastpath->rdp->transport, update) < 0)
 		{
@@ -700,9 +741,12 @@ tbool fastpath_send_update_pdu(rdpFastPath* fastpath, uint8 updateCode, STREAM*
 		stream_detach(update);
 
 		/* Reserve 6+sec_bytes bytes for the next fragment header, if any. */
-		stream_seek(s, length - 6 - sec_bytes);
+		stream_set_mark(s, bm + length);
 	}
 
+	if (transport_uncork(rdp->transport) < 0)
+		result = false;
+
 	stream_free(update);
 
 	return result;
@@ -715,6 +759,7 @@ rdpFastPath* fastpath_new(rdpRdp* rdp)
 	fastpath = xnew(rdpFastPath);
 	fastpath->rdp = rdp;
 	fastpath->updateData = stream_new(4096);
+	fastpath->sendData = stream_new(FASTPATH_MAX_PACKET_SIZE);
 
 	return fastpath;
 }
@@ -722,5 +767,6 @@ rdpFastPath* fastpath_new(rdpRdp* rdp)
 void fastpath_free(rdpFastPath* fastpath)
 {
 	stream_free(fastpath->updateData);
+	stream_free(fastpath->sendData);
 	xfree(fastpath);
 }
@@ -100,6 +100,7 @@ struct rdp_fastpath
 	uint8 encryptionFlags;
 	uint8 numberEvents;
 	STREAM* updateData;
+	STREAM* sendData;
 };
 
 uint16 fastpath_header_length(STREAM* s);
@@ -108,6 +108,7 @@ tbool freerdp_get_fds(freerdp* instance, void** rfds, int* rcount, void** wfds,
 
 	rdp = instance->context->rdp;
 	transport_get_fds(rdp->transport, rfds, rcount);
+	transport_get_write_fds(rdp->transport, wfds, wcount);
 
 	return true;
 }
@@ -398,6 +398,7 @@ tbool rdp_read_info_packet(STREAM* s, rdpSettings* settings)
 	settings->remote_app = ((flags & INFO_RAIL) ? true : false);
 	settings->console_audio = ((flags & INFO_REMOTECONSOLEAUDIO) ? true : false);
 	settings->compression = ((flags & INFO_COMPRESSION) ? true : false);
+	settings->compression_type = (flags & INFO_CompressionTypeMask) >> 9;
 
 	stream_read_uint16(s, cbDomain); /* cbDomain */
 	stream_read_uint16(s, cbUserName); /* cbUserName */
@@ -604,7 +605,17 @@ tbool rdp_recv_client_info(rdpRdp* rdp, STREAM* s)
 		}
 	}
 
-	return rdp_read_info_packet(s, rdp->settings);
+	if (!rdp_read_info_packet(s, rdp->settings))
+		return false;
+
+	/* compress what we send with the best type both ends know */
+	if (rdp->settings->compression)
+	{
+		mppc_enc_free(rdp->mppc_enc);
+		rdp->mppc_enc = mppc_enc_new(MIN(rdp->settings->compression_type, PACKET_COMPR_TYPE_64K));
+	}
+
+	return true;
 }
 
 /**
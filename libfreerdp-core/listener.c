@@ -22,6 +22,7 @@
 #include <string.h>
 #include <fcntl.h>
 #include <freerdp/utils/print.h>
+#include <freerdp/runtime.h>
 
 #ifndef _WIN32
 #include <netdb.h>
@@ -194,6 +195,9 @@ static tbool freerdp_listener_check_fds(freerdp_listener* instance)
 		inet_ntop(peer_addr.ss_family, sin_addr, client->hostname, sizeof(client->hostname));
 
 		IFCALL(instance->PeerAccepted, instance, client);
+
+		if (instance->runtime != NULL)
+			freerdp_runtime_add_peer((freerdp_runtime*) instance->runtime, client);
 	}
 
 	return true;
@@ -201,505 +201,235 @@ int decompress_rdp(rdpRdp* rdp, uint8* cbuf, int len, int ctype, uint32* roff, u
 }
 
 /**
- * decompress RDP 4 data
- *
- * @param rdp     per session information
- * @param cbuf    compressed data
- * @param len     length of compressed data
- * @param ctype   compression flags
- * @param roff    starting offset of uncompressed data
- * @param rlen    length of uncompressed data
- *
- * @return        True on success, False on failure
+ * The bitstream is read through a 64 bit reservoir. Valid bits are kept MSB
+ * aligned in acc and the bits below them are zero, so that reading past the
+ * end of the input gives zero bits, as the former 32 bit window did.
  */
-
-int decompress_rdp_4(rdpRdp* rdp, uint8* cbuf, int len, int ctype, uint32* roff, uint32* rlen)
+struct _MPPC_READER
 {
-	uint8*    history_buf;    /* uncompressed data goes here */
-	uint8*    history_ptr;    /* points to next free slot in history_buf */
-	uint32    d32;            /* we process 4 compressed bytes at a time */
-	uint16    copy_offset;    /* location to copy data from */
-	uint16    lom;            /* length of match */
-	uint8*    src_ptr;        /* used while copying compressed data */
-	uint8*    cptr;           /* points to next byte in cbuf */
-	uint8     cur_byte;       /* last byte fetched from cbuf */
-	int       bits_left;      /* bits left in d34 for processing */
-	int       cur_bits_left;  /* bits left in cur_byte for processing */
-	int       tmp;
-	uint32    i32;
-
-	printf("decompress_rdp_4:\n");
-
-	if ((rdp->mppc == NULL) || (rdp->mppc->history_buf == NULL))
-	{
-		printf("decompress_rdp_4: null\n");
-		return false;
-	}
-
-	src_ptr = 0;
-	cptr = cbuf;
-	copy_offset = 0;
-	lom = 0;
-	bits_left = 0;
-	cur_bits_left = 0;
-	d32 = 0;
-	cur_byte = 0;
-	*rlen = 0;
-
-	/* get start of history buffer */
-	history_buf = rdp->mppc->history_buf;
-
-	/* get next free slot in history buffer */
-	history_ptr = rdp->mppc->history_ptr;
-	*roff = history_ptr - history_buf;
-
-	if (ctype & PACKET_AT_FRONT)
-	{
-		/* place compressed data at start of history buffer */
-		history_ptr = rdp->mppc->history_buf;
-		rdp->mppc->history_ptr = rdp->mppc->history_buf;
-		*roff = 0;
-	}
+	uint64 acc;
+	int bits;
+	uint8* ptr;
+	uint8* end;
+};
+typedef struct _MPPC_READER MPPC_READER;
 
-	if (ctype & PACKET_FLUSHED)
-	{
-		/* re-init history buffer */
-		history_ptr = rdp->mppc->history_buf;
-		memset(history_buf, 0, RDP6_HISTORY_BUF_SIZE);
-		*roff = 0;
-	}
+static INLINE void mppc_reader_refill(MPPC_READER* br)
+{
+	uint64 v;
+	int n;
 
-	if ((ctype & PACKET_COMPRESSED) != PACKET_COMPRESSED)
-	{
-		/* data in cbuf is not compressed - copy to history buf as is */
-		memcpy(history_ptr, cbuf, len);
-		history_ptr += len;
-		*rlen = history_ptr - rdp->mppc->history_ptr;
-		rdp->mppc->history_ptr = history_ptr;
-		return true;
-	}
+	if (br->bits > 56)
+		return;
 
-	/* load initial data */
-	tmp = 24;
-	while (cptr < cbuf + len)
+	if (br->end - br->ptr >= 8)
 	{
-		i32 = *cptr++;
-		d32  |= i32 << tmp;
-		bits_left += 8;
-		tmp -= 8;
-		if (tmp < 0)
-		{
-			break;
-		}
+		v = ((uint64) br->ptr[0] << 56) | ((uint64) br->ptr[1] << 48) |
+			((uint64) br->ptr[2] << 40) | ((uint64) br->ptr[3] << 32) |
+			((uint64) br->ptr[4] << 24) | ((uint64) br->ptr[5] << 16) |
+			((uint64) br->ptr[6] << 8) | (uint64) br->ptr[7];
+
+		/* take as many whole bytes as fit */
+		n = (64 - br->bits) >> 3;
+		br->acc |= (v >> br->bits) & (~((uint64) 0) << ((64 - br->bits) & 7));
+		br->ptr += n;
+		br->bits += n << 3;
+		return;
 	}
 
-	if (cptr < cbuf + len)
+	while (br->bits <= 56 && br->ptr < br->end)
 	{
-		cur_byte = *cptr++;
-		cur_bits_left = 8;
+		br->acc |= (uint64) *br->ptr++ << (56 - br->bits);
+		br->bits += 8;
 	}
-	else
-	{
-		cur_bits_left = 0;
-	}
-
-	/*
-	** start uncompressing data in cbuf
-	*/
-
-	while (bits_left >= 8)
-	{
-		/*
-		   value 0xxxxxxx  = literal, not encoded
-		   value 10xxxxxx  = literal, encoded
-		   value 1111xxxx  = copy offset   0 - 63
-		   value 1110xxxx  = copy offset  64 - 319
-		   value 110xxxxx  = copy offset 320 - 8191
-		*/
-
-		/*
-		   at this point, we are guaranteed that d32 has 32 bits to
-		   be processed, unless we have reached end of cbuf
-		*/
-
-		copy_offset = 0;
+}
 
-		if ((d32 & 0x80000000) == 0)
-		{
-			/* got a literal */
-			*history_ptr++ = d32 >> 24;
-			d32 <<= 8;
-			bits_left -= 8;
-		}
-		else if ((d32 & 0xc0000000) == 0x80000000)
-		{
-			/* got encoded literal */
-			d32 <<= 2;
-			*history_ptr++ = (d32 >> 25) | 0x80;
-			d32 <<= 7;
-			bits_left -= 9;
-		}
-		else if ((d32 & 0xf0000000) == 0xf0000000)
-		{
-			/* got copy offset in range 0 - 63, */
-			/* with 6 bit copy offset */
-			d32 <<= 4;
-			copy_offset = d32 >> 26;
-			d32 <<= 6;
-			bits_left -= 10;
-		}
-		else if ((d32 & 0xf0000000) == 0xe0000000)
-		{
-			/* got copy offset in range 64 - 319, */
-			/* with 8 bit copy offset */
-			d32 <<= 4;
-			copy_offset = d32 >> 24;
-			copy_offset += 64;
-			d32 <<= 8;
-			bits_left -= 12;
-		}
-		else if ((d32 & 0xe0000000) == 0xc0000000)
-		{
-			/* got copy offset in range 320 - 8191, */
-			/* with 13 bits copy offset */
-			d32 <<= 3;
-			copy_offset = d32 >> 19;
-			copy_offset += 320;
-			d32 <<= 13;
-			bits_left -= 16;
-		}
+static INLINE uint32 mppc_get_bits(MPPC_READER* br, int nbits)
+{
+	uint32 r;
 
-		/*
-		** get more bits before we process length of match
-		*/
+	r = (uint32) (br->acc >> (64 - nbits));
+	br->acc <<= nbits;
+	br->bits -= nbits;
 
-		/* how may bits do we need to get? */
-		tmp = 32 - bits_left;
+	return r;
+}
 
-		while (tmp)
-		{
-			if (cur_bits_left < tmp)
-			{
-				/* we have less bits than we need */
-				i32 = cur_byte >> (8 - cur_bits_left);
-				d32 |= i32 << ((32 - bits_left) - cur_bits_left);
-				bits_left += cur_bits_left;
-				tmp -= cur_bits_left;
-				if (cptr < cbuf + len)
-				{
-					/* more compressed data available */
-					cur_byte = *cptr++;
-					cur_bits_left = 8;
-				}
-				else
-				{
-					/* no more compressed data available */
-					tmp = 0;
-					cur_bits_left = 0;
-				}
-			}
-			else if (cur_bits_left > tmp)
-			{
-				/* we have more bits than we need */
-				d32 |= cur_byte >> (8 - tmp);
-				cur_byte <<= tmp;
-				cur_bits_left -= tmp;
-				bits_left = 32;
-				break;
-			}
-			else
-			{
-				/* we have just the right amount of bits */
-				d32 |= cur_byte >> (8 - tmp);
-				bits_left = 32;
-				if (cptr < cbuf + len)
-				{
-					cur_byte = *cptr++;
-					cur_bits_left = 8;
-				}
-				else
-				{
-					cur_bits_left = 0;
-				}
-				break;
-			}
-		}
+/**
+ * Literals and copy offsets, looked up by the top 5 bits of the bitstream:
+ * the length of the prefix, the number of value bits after it and the
+ * value they are added to.
+ */
+struct _MPPC_TOKEN
+{
+	uint8 literal;
+	uint8 prefix;
+	uint8 bits;
+	uint16 base;
+};
+typedef struct _MPPC_TOKEN MPPC_TOKEN;
 
-		if (!copy_offset)
-		{
-			continue;
-		}
+#define MPPC_LITERAL		{ true, 1, 7, 0x00 }
+#define MPPC_LITERAL_ENCODED	{ true, 2, 7, 0x80 }
+#define MPPC_OFFSET(_prefix, _bits, _base) { false, _prefix, _bits, _base }
 
-		/*
-		** compute Length of Match
-		*/
+static const MPPC_TOKEN mppc_tokens_rdp4[32] =
+{
+	/* 0xxxxxxx */
+	MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL,
+	MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL,
+	MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL,
+	MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL,
+	/* 10xxxxxxx */
+	MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED,
+	MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED,
+	/* 110 + 13 bits: copy offset 320 - 8191 */
+	MPPC_OFFSET(3, 13, 320), MPPC_OFFSET(3, 13, 320), MPPC_OFFSET(3, 13, 320), MPPC_OFFSET(3, 13, 320),
+	/* 1110 + 8 bits: copy offset 64 - 319 */
+	MPPC_OFFSET(4, 8, 64), MPPC_OFFSET(4, 8, 64),
+	/* 1111 + 6 bits: copy offset 0 - 63 */
+	MPPC_OFFSET(4, 6, 0), MPPC_OFFSET(4, 6, 0)
+};
 
-		/*
-		   lengh of match  Encoding (binary header + LoM bits
-		   --------------  ----------------------------------
-		   3               0
-		   4...7           10 + 2 lower bits of L-o-M
-		   8...15          110 + 3 lower bits of L-o-M
-		   16...31         1110 + 4 lower bits of L-o-M
-		   32...63         11110 + 5 lower bits of L-o-M
-		   64...127        111110 + 6 lower bits of L-o-M
-		   128...255       1111110 + 7 lower bits of L-o-M
-		   256...511       11111110 + 8 lower bits of L-o-M
-		   512...1023      111111110 + 9 lower bits of L-o-M
-		   1024...2047     1111111110 + 10 lower bits of L-o-M
-		   2048...4095     11111111110 + 11 lower bits of L-o-M
-		   4096...8191     111111111110 + 12 lower bits of L-o-M
-		*/
+static const MPPC_TOKEN mppc_tokens_rdp5[32] =
+{
+	/* 0xxxxxxx */
+	MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL,
+	MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL,
+	MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL,
+	MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL, MPPC_LITERAL,
+	/* 10xxxxxxx */
+	MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED,
+	MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED, MPPC_LITERAL_ENCODED,
+	/* 110 + 16 bits: copy offset 2368+ */
+	MPPC_OFFSET(3, 16, 2368), MPPC_OFFSET(3, 16, 2368), MPPC_OFFSET(3, 16, 2368), MPPC_OFFSET(3, 16, 2368),
+	/* 1110 + 11 bits: copy offset 320 - 2367 */
+	MPPC_OFFSET(4, 11, 320), MPPC_OFFSET(4, 11, 320),
+	/* 11110 + 8 bits: copy offset 64 - 319 */
+	MPPC_OFFSET(5, 8, 64),
+	/* 11111 + 6 bits: copy offset 0 - 63 */
+	MPPC_OFFSET(5, 6, 0)
+};
 
-		if ((d32 & 0x80000000) == 0)
-		{
-			/* lom is fixed to 3 */
-			lom = 3;
-			d32 <<= 1;
-			bits_left -= 1;
-		}
-		else if ((d32 & 0xc0000000) == 0x80000000)
-		{
-			/* 2 lower bits of LoM */
-			lom = ((d32 >> 28) & 0x03) + 4;
-			d32 <<= 4;
-			bits_left -= 4;
-		}
-		else if ((d32 & 0xe0000000) == 0xc0000000)
-		{
-			/* 3 lower bits of LoM */
-			lom = ((d32 >> 26) & 0x07) + 8;
-			d32 <<= 6;
-			bits_left -= 6;
-		}
-		else if ((d32 & 0xf0000000) == 0xe0000000)
-		{
-			/* 4 lower bits of LoM */
-			lom = ((d32 >> 24) & 0x0f) + 16;
-			d32 <<= 8;
-			bits_left -= 8;
-		}
-		else if ((d32 & 0xf8000000) == 0xf0000000)
-		{
-			/* 5 lower bits of LoM */
-			lom = ((d32 >> 22) & 0x1f) + 32;
-			d32 <<= 10;
-			bits_left -= 10;
-		}
-		else if ((d32 & 0xfc000000) == 0xf8000000)
-		{
-			/* 6 lower bits of LoM */
-			lom = ((d32 >> 20) & 0x3f) + 64;
-			d32 <<= 12;
-			bits_left -= 12;
-		}
-		else if ((d32 & 0xfe000000) == 0xfc000000)
-		{
-			/* 7 lower bits of LoM */
-			lom = ((d32 >> 18) & 0x7f) + 128;
-			d32 <<= 14;
-			bits_left -= 14;
-		}
-		else if ((d32 & 0xff000000) == 0xfe000000)
-		{
-			/* 8 lower bits of LoM */
-			lom = ((d32 >> 16) & 0xff) + 256;
-			d32 <<= 16;
-			bits_left -= 16;
-		}
-		else if ((d32 & 0xff800000) == 0xff000000)
-		{
-			/* 9 lower bits of LoM */
-			lom = ((d32 >> 14) & 0x1ff) + 512;
-			d32 <<= 18;
-			bits_left -= 18;
-		}
-		else if ((d32 & 0xffc00000) == 0xff800000)
-		{
-			/* 10 lower bits of LoM */
-			lom = ((d32 >> 12) & 0x3ff) + 1024;
-			d32 <<= 20;
-			bits_left -= 20;
-		}
-		else if ((d32 & 0xffe00000) == 0xffc00000)
-		{
-			/* 11 lower bits of LoM */
-			lom = ((d32 >> 10) & 0x7ff) + 2048;
-			d32 <<= 22;
-			bits_left -= 22;
-		}
-		else if ((d32 & 0xfff00000) == 0xffe00000)
-		{
-			/* 12 lower bits of LoM */
-			lom = ((d32 >> 8) & 0xfff) + 4096;
-			d32 <<= 24;
-			bits_left -= 24;
-		}
+/* Number of leading one bits of a byte */
+static const uint8 mppc_leading_ones[256] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 7, 8
+};
 
-		/* now that we have copy_offset and LoM, process them */
+/**
+ * Copy lom bytes from offset bytes back in the history. Matches may overlap
+ * the bytes they produce, so wide copies are only used when offset allows.
+ */
+static INLINE uint8* mppc_copy_match(uint8* dst, int offset, int lom)
+{
+	uint8* src = dst - offset;
 
-		src_ptr = history_ptr - copy_offset;
-		if (src_ptr >= rdp->mppc->history_buf)
+	if (lom < 16)
+	{
+		/* short matches are the common case, a call costs more than the loop */
+		while (lom > 0)
 		{
-			/* data does not wrap around */
-			while (lom > 0)
-			{
-				*history_ptr++ = *src_ptr++;
-				lom--;
-			}
+			*dst++ = *src++;
+			lom--;
 		}
-		else
-		{
-			src_ptr = rdp->mppc->history_buf_end - (copy_offset - (history_ptr - rdp->mppc->history_buf));
-			src_ptr++;
-			while (lom && (src_ptr <= rdp->mppc->history_buf_end))
-			{
-				*history_ptr++ = *src_ptr++;
-				lom--;
-			}
 
-			src_ptr = rdp->mppc->history_buf;
-			while (lom > 0)
-			{
-				*history_ptr++ = *src_ptr++;
-				lom--;
-			}
-		}
+		return dst;
+	}
 
-		/*
-		** get more bits before we restart the loop
-		*/
+	if (offset >= lom)
+	{
+		memcpy(dst, src, lom);
+		return dst + lom;
+	}
 
-		/* how may bits do we need to get? */
-		tmp = 32 - bits_left;
+	if (offset == 1)
+	{
+		memset(dst, *src, lom);
+		return dst + lom;
+	}
 
-		while (tmp)
+	if (offset >= 8)
+	{
+		while (lom >= 8)
 		{
-			if (cur_bits_left < tmp)
-			{
-				/* we have less bits than we need */
-				i32 = cur_byte >> (8 - cur_bits_left);
-				d32 |= i32 << ((32 - bits_left) - cur_bits_left);
-				bits_left += cur_bits_left;
-				tmp -= cur_bits_left;
-				if (cptr < cbuf + len)
-				{
-					/* more compressed data available */
-					cur_byte = *cptr++;
-					cur_bits_left = 8;
-				}
-				else
-				{
-					/* no more compressed data available */
-					tmp = 0;
-					cur_bits_left = 0;
-				}
-			}
-			else if (cur_bits_left > tmp)
-			{
-				/* we have more bits than we need */
-				d32 |= cur_byte >> (8 - tmp);
-				cur_byte <<= tmp;
-				cur_bits_left -= tmp;
-				bits_left = 32;
-				break;
-			}
-			else
-			{
-				/* we have just the right amount of bits */
-				d32 |= cur_byte >> (8 - tmp);
-				bits_left = 32;
-				if (cptr < cbuf + len)
-				{
-					cur_byte = *cptr++;
-					cur_bits_left = 8;
-				}
-				else
-				{
-					cur_bits_left = 0;
-				}
-				break;
-			}
+			memcpy(dst, src, 8);
+			dst += 8;
+			src += 8;
+			lom -= 8;
 		}
-	} /* end while (bits_left >= 8) */
-
-	*rlen = history_ptr - rdp->mppc->history_ptr;
+	}
 
-	rdp->mppc->history_ptr = history_ptr;
+	while (lom > 0)
+	{
+		*dst++ = *src++;
+		lom--;
+	}
 
-	return true;
+	return dst;
 }
 
 /**
- * decompress RDP 5 data
- *
- * @param rdp     per session information
- * @param cbuf    compressed data
- * @param len     length of compressed data
- * @param ctype   compression flags
- * @param roff    starting offset of uncompressed data
- * @param rlen    length of uncompressed data
- *
- * @return        True on success, False on failure
+ * decompress RDP 4 or RDP 5 data, see decompress_rdp_4 and decompress_rdp_5
  */
 
-int decompress_rdp_5(rdpRdp* rdp, uint8* cbuf, int len, int ctype, uint32* roff, uint32* rlen)
+static int mppc_decompress(rdpRdp* rdp, uint8* cbuf, int len, int ctype, uint32* roff, uint32* rlen,
+	const MPPC_TOKEN* tokens, int max_lom_bits)
 {
-	uint8*    history_buf;    /* uncompressed data goes here */
-	uint8*    history_ptr;    /* points to next free slot in bistory_buf */
-	uint32    d32;            /* we process 4 compressed bytes at a time */
-	uint16    copy_offset;    /* location to copy data from */
-	uint16    lom;            /* length of match */
-	uint8*    src_ptr;        /* used while copying compressed data */
-	uint8*    cptr;           /* points to next byte in cbuf */
-	uint8     cur_byte;       /* last byte fetched from cbuf */
-	int       bits_left;      /* bits left in d32 for processing */
-	int       cur_bits_left;  /* bits left in cur_byte for processing */
-	int       tmp;
-	uint32    i32;
+	uint8* history_buf;
+	uint8* history_end;
+	uint8* history_ptr;
+	uint8* src_ptr;
+	const MPPC_TOKEN* token;
+	MPPC_READER br;
+	uint16 copy_offset;
+	int lom;
+	int ones;
 
-	if ((rdp->mppc == NULL) || (rdp->mppc->history_buf == NULL))
-	{
-		printf("decompress_rdp_5: null\n");
-		return false;
-	}
-
-	src_ptr = 0;
-	cptr = cbuf;
-	copy_offset = 0;
-	lom = 0;
-	bits_left = 0;
-	cur_bits_left = 0;
-	d32 = 0;
-	cur_byte = 0;
 	*rlen = 0;
 
-	/* get start of history buffer */
 	history_buf = rdp->mppc->history_buf;
+	history_end = history_buf + RDP6_HISTORY_BUF_SIZE;
 
 	/* get next free slot in history buffer */
 	history_ptr = rdp->mppc->history_ptr;
 	*roff = history_ptr - history_buf;
 
-	if (ctype & PACKET_AT_FRONT)
+	if (ctype & (PACKET_AT_FRONT | PACKET_FLUSHED))
 	{
-		/* place compressed data at start of history buffer */
-		history_ptr = rdp->mppc->history_buf;
-		rdp->mppc->history_ptr = rdp->mppc->history_buf;
+		/* place data at start of history buffer */
+		history_ptr = history_buf;
+		rdp->mppc->history_ptr = history_buf;
 		*roff = 0;
 	}
 
 	if (ctype & PACKET_FLUSHED)
 	{
 		/* re-init history buffer */
-		history_ptr = rdp->mppc->history_buf;
 		memset(history_buf, 0, RDP6_HISTORY_BUF_SIZE);
-		*roff = 0;
 	}
 
 	if ((ctype & PACKET_COMPRESSED) != PACKET_COMPRESSED)
 	{
 		/* data in cbuf is not compressed - copy to history buf as is */
+		if (len > history_end - history_ptr)
+			return false;
+
 		memcpy(history_ptr, cbuf, len);
 		history_ptr += len;
 		*rlen = history_ptr - rdp->mppc->history_ptr;
@@ -707,391 +437,159 @@ int decompress_rdp_5(rdpRdp* rdp, uint8* cbuf, int len, int ctype, uint32* roff,
 		return true;
 	}
 
-	/* load initial data */
-	tmp = 24;
-	while (cptr < cbuf + len)
-	{
-		i32 = *cptr++;
-		d32  |= i32 << tmp;
-		bits_left += 8;
-		tmp -= 8;
-		if (tmp < 0)
-		{
-			break;
-		}
-	}
-
-	if (cptr < cbuf + len)
-	{
-		cur_byte = *cptr++;
-		cur_bits_left = 8;
-	}
-	else
-	{
-		cur_bits_left = 0;
-	}
-
-	/*
-	** start uncompressing data in cbuf
-	*/
+	br.acc = 0;
+	br.bits = 0;
+	br.ptr = cbuf;
+	br.end = cbuf + len;
 
-	while (bits_left >= 8)
+	while (1)
 	{
-		/*
-		   value 0xxxxxxx  = literal, not encoded
-		   value 10xxxxxx  = literal, encoded
-		   value 11111xxx  = copy offset     0 - 63
-		   value 11110xxx  = copy offset    64 - 319
-		   value 1110xxxx  = copy offset   320 - 2367
-		   value 110xxxxx  = copy offset  2368+
-		*/
+		/* one token takes at most 49 bits, a refill leaves more unless the input ends */
+		if (br.bits < 49)
+			mppc_reader_refill(&br);
 
-		/*
-		   at this point, we are guaranteed that d32 has 32 bits to
-		   be processed, unless we have reached end of cbuf
-		*/
+		if (br.bits < 8)
+			break;
 
-		copy_offset = 0;
+		if (history_ptr >= history_end)
+			return false;
 
-		if ((d32 & 0x80000000) == 0)
-		{
-			/* got a literal */
-			*history_ptr++ = d32 >> 24;
-			d32 <<= 8;
-			bits_left -= 8;
-		}
-		else if ((d32 & 0xc0000000) == 0x80000000)
-		{
-			/* got encoded literal */
-			d32 <<= 2;
-			*history_ptr++ = (d32 >> 25) | 0x80;
-			d32 <<= 7;
-			bits_left -= 9;
-		}
-		else if ((d32 & 0xf8000000) == 0xf8000000)
-		{
-			/* got copy offset in range 0 - 63, */
-			/* with 6 bit copy offset */
-			d32 <<= 5;
-			copy_offset = d32 >> 26;
-			d32 <<= 6;
-			bits_left -= 11;
-		}
-		else if ((d32 & 0xf8000000) == 0xf0000000)
-		{
-			/* got copy offset in range 64 - 319, */
-			/* with 8 bit copy offset */
-			d32 <<= 5;
-			copy_offset = d32 >> 24;
-			copy_offset += 64;
-			d32 <<= 8;
-			bits_left -= 13;
-		}
-		else if ((d32 & 0xf0000000) == 0xe0000000)
+		if (!(br.acc >> 63))
 		{
-			/* got copy offset in range 320 - 2367, */
-			/* with 11 bits copy offset */
-			d32 <<= 4;
-			copy_offset = d32 >> 21;
-			copy_offset += 320;
-			d32 <<= 11;
-			bits_left -= 15;
-		}
-		else if ((d32 & 0xe0000000) == 0xc0000000)
-		{
-			/* got copy offset in range 2368+, */
-			/* with 16 bits copy offset */
-			d32 <<= 3;
-			copy_offset = d32 >> 16;
-			copy_offset += 2368;
-			d32 <<= 16;
-			bits_left -= 19;
+			/* literal, not encoded */
+			*history_ptr++ = mppc_get_bits(&br, 8);
+			continue;
 		}
 
-		/*
-		** get more bits before we process length of match
-		*/
-
-		/* how may bits do we need to get? */
-		tmp = 32 - bits_left;
+		token = &tokens[br.acc >> 59];
+		mppc_get_bits(&br, token->prefix);
 
-		while (tmp)
+		if (token->literal)
 		{
-			if (cur_bits_left < tmp)
-			{
-				/* we have less bits than we need */
-				i32 = cur_byte >> (8 - cur_bits_left);
-				d32 |= i32 << ((32 - bits_left) - cur_bits_left);
-				bits_left += cur_bits_left;
-				tmp -= cur_bits_left;
-				if (cptr < cbuf + len)
-				{
-					/* more compressed data available */
-					cur_byte = *cptr++;
-					cur_bits_left = 8;
-				}
-				else
-				{
-					/* no more compressed data available */
-					tmp = 0;
-					cur_bits_left = 0;
-				}
-			}
-			else if (cur_bits_left > tmp)
-			{
-				/* we have more bits than we need */
-				d32 |= cur_byte >> (8 - tmp);
-				cur_byte <<= tmp;
-				cur_bits_left -= tmp;
-				bits_left = 32;
-				break;
-			}
-			else
-			{
-				/* we have just the right amount of bits */
-				d32 |= cur_byte >> (8 - tmp);
-				bits_left = 32;
-				if (cptr < cbuf + len)
-				{
-					cur_byte = *cptr++;
-					cur_bits_left = 8;
-				}
-				else
-				{
-					cur_bits_left = 0;
-				}
-				break;
-			}
+			*history_ptr++ = token->base | mppc_get_bits(&br, token->bits);
+			continue;
 		}
 
+		copy_offset = token->base + mppc_get_bits(&br, token->bits);
+
 		if (!copy_offset)
-		{
 			continue;
-		}
 
 		/*
-		** compute Length of Match
-		*/
-
-		/*
-		   lengh of match  Encoding (binary header + LoM bits
+		   length of match  Encoding (binary header + LoM bits)
 		   --------------  ----------------------------------
 		   3               0
-		   4..7            10 + 2 lower bits of LoM
-		   8..15           110 + 3 lower bits of LoM
-		   16..31          1110 + 4 lower bits of LoM
-		   32..63          1111-0 + 5 lower bits of LoM
-		   64..127         1111-10 + 6 lower bits of LoM
-		   128..255        1111-110 + 7 lower bits of LoM
-		   256..511        1111-1110 + 8 lower bits of LoM
-		   512..1023       1111-1111-0 + 9 lower bits of LoM
-		   1024..2047      1111-1111-10 + 10 lower bits of LoM
-		   2048..4095      1111-1111-110 + 11 lower bits of LoM
-		   4096..8191      1111-1111-1110 + 12 lower bits of LoM
-		   8192..16383     1111-1111-1111-0 + 13 lower bits of LoM
-		   16384..32767    1111-1111-1111-10 + 14 lower bits of LoM
-		   32768..65535    1111-1111-1111-110 + 15 lower bits of LoM
+		   4...7           10 + 2 lower bits of L-o-M
+		   8...15          110 + 3 lower bits of L-o-M
+		   ...
+		   2^k...2^(k+1)-1 k - 1 ones, a zero and k lower bits of L-o-M
 		*/
 
-		if ((d32 & 0x80000000) == 0)
+		ones = mppc_leading_ones[br.acc >> 56];
+
+		if (ones == 8)
+			ones += mppc_leading_ones[(br.acc >> 48) & 0xFF];
+
+		if (ones == 0)
 		{
-			/* lom is fixed to 3 */
 			lom = 3;
-			d32 <<= 1;
-			bits_left -= 1;
-		}
-		else if ((d32 & 0xc0000000) == 0x80000000)
-		{
-			/* 2 lower bits of LoM */
-			lom = ((d32 >> 28) & 0x03) + 4;
-			d32 <<= 4;
-			bits_left -= 4;
-		}
-		else if ((d32 & 0xe0000000) == 0xc0000000)
-		{
-			/* 3 lower bits of LoM */
-			lom = ((d32 >> 26) & 0x07) + 8;
-			d32 <<= 6;
-			bits_left -= 6;
-		}
-		else if ((d32 & 0xf0000000) == 0xe0000000)
-		{
-			/* 4 lower bits of LoM */
-			lom = ((d32 >> 24) & 0x0f) + 16;
-			d32 <<= 8;
-			bits_left -= 8;
-		}
-		else if ((d32 & 0xf8000000) == 0xf0000000)
-		{
-			/* 5 lower bits of LoM */
-			lom = ((d32 >> 22) & 0x1f) + 32;
-			d32 <<= 10;
-			bits_left -= 10;
-		}
-		else if ((d32 & 0xfc000000) == 0xf8000000)
-		{
-			/* 6 lower bits of LoM */
-			lom = ((d32 >> 20) & 0x3f) + 64;
-			d32 <<= 12;
-			bits_left -= 12;
-		}
-		else if ((d32 & 0xfe000000) == 0xfc000000)
-		{
-			/* 7 lower bits of LoM */
-			lom = ((d32 >> 18) & 0x7f) + 128;
-			d32 <<= 14;
-			bits_left -= 14;
-		}
-		else if ((d32 & 0xff000000) == 0xfe000000)
-		{
-			/* 8 lower bits of LoM */
-			lom = ((d32 >> 16) & 0xff) + 256;
-			d32 <<= 16;
-			bits_left -= 16;
-		}
-		else if ((d32 & 0xff800000) == 0xff000000)
-		{
-			/* 9 lower bits of LoM */
-			lom = ((d32 >> 14) & 0x1ff) + 512;
-			d32 <<= 18;
-			bits_left -= 18;
+			mppc_get_bits(&br, 1);
 		}
-		else if ((d32 & 0xffc00000) == 0xff800000)
+		else if (ones < max_lom_bits)
 		{
-			/* 10 lower bits of LoM */
-			lom = ((d32 >> 12) & 0x3ff) + 1024;
-			d32 <<= 20;
-			bits_left -= 20;
+			mppc_get_bits(&br, ones + 1);
+			lom = (1 << (ones + 1)) + mppc_get_bits(&br, ones + 1);
 		}
-		else if ((d32 & 0xffe00000) == 0xffc00000)
-		{
-			/* 11 lower bits of LoM */
-			lom = ((d32 >> 10) & 0x7ff) + 2048;
-			d32 <<= 22;
-			bits_left -= 22;
-		}
-		else if ((d32 & 0xfff00000) == 0xffe00000)
-		{
-			/* 12 lower bits of LoM */
-			lom = ((d32 >> 8) & 0xfff) + 4096;
-			d32 <<= 24;
-			bits_left -= 24;
-		}
-		else if ((d32 & 0xfff80000) == 0xfff00000)
-		{
-			/* 13 lower bits of LoM */
-			lom = ((d32 >> 6) & 0x1fff) + 8192;
-			d32 <<= 26;
-			bits_left -= 26;
-		}
-		else if ((d32 & 0xfffc0000) == 0xfff80000)
-		{
-			/* 14 lower bits of LoM */
-			lom = ((d32 >> 4) & 0x3fff) + 16384;
-			d32 <<= 28;
-			bits_left -= 28;
-		}
-		else if ((d32 & 0xfffe0000) == 0xfffc0000)
+		else
 		{
-			/* 15 lower bits of LoM */
-			lom = ((d32 >> 2) & 0x7fff) + 32768;
-			d32 <<= 30;
-			bits_left -= 30;
+			return false;
 		}
 
+		if (lom > history_end - history_ptr)
+			return false;
+
 		/* now that we have copy_offset and LoM, process them */
 
-		src_ptr = history_ptr - copy_offset;
-		if (src_ptr >= rdp->mppc->history_buf)
+		if (copy_offset <= history_ptr - history_buf)
 		{
 			/* data does not wrap around */
-			while (lom > 0)
-			{
-				*history_ptr++ = *src_ptr++;
-				lom--;
-			}
+			history_ptr = mppc_copy_match(history_ptr, copy_offset, lom);
 		}
 		else
 		{
-			src_ptr = rdp->mppc->history_buf_end - (copy_offset - (history_ptr - rdp->mppc->history_buf));
-			src_ptr++;
-			while (lom && (src_ptr <= rdp->mppc->history_buf_end))
+			src_ptr = history_end - (copy_offset - (history_ptr - history_buf));
+
+			while (lom && (src_ptr < history_end))
 			{
 				*history_ptr++ = *src_ptr++;
 				lom--;
 			}
 
-			src_ptr = rdp->mppc->history_buf;
+			src_ptr = history_buf;
+
 			while (lom > 0)
 			{
 				*history_ptr++ = *src_ptr++;
 				lom--;
 			}
 		}
+	}
 
-		/*
-		** get more bits before we restart the loop
-		*/
+	*rlen = history_ptr - rdp->mppc->history_ptr;
 
-		/* how may bits do we need to get? */
-		tmp = 32 - bits_left;
+	rdp->mppc->history_ptr = history_ptr;
 
-		while (tmp)
-		{
-			if (cur_bits_left < tmp)
-			{
-				/* we have less bits than we need */
-				i32 = cur_byte >> (8 - cur_bits_left);
-				d32 |= i32 << ((32 - bits_left) - cur_bits_left);
-				bits_left += cur_bits_left;
-				tmp -= cur_bits_left;
-				if (cptr < cbuf + len)
-				{
-					/* more compressed data available */
-					cur_byte = *cptr++;
-					cur_bits_left = 8;
-				}
-				else
-				{
-					/* no more compressed data available */
-					tmp = 0;
-					cur_bits_left = 0;
-				}
-			}
-			else if (cur_bits_left > tmp)
-			{
-				/* we have more bits than we need */
-				d32 |= cur_byte >> (8 - tmp);
-				cur_byte <<= tmp;
-				cur_bits_left -= tmp;
-				bits_left = 32;
-				break;
-			}
-			else
-			{
-				/* we have just the right amount of bits */
-				d32 |= cur_byte >> (8 - tmp);
-				bits_left = 32;
-				if (cptr < cbuf + len)
-				{
-					cur_byte = *cptr++;
-					cur_bits_left = 8;
-				}
-				else
-				{
-					cur_bits_left = 0;
-				}
-				break;
-			}
-		}
+	return true;
+}
 
-	} /* end while (cptr < cbuf + len) */
+/**
+ * decompress RDP 4 data
+ *
+ * @param rdp     per session information
+ * @param cbuf    compressed data
+ * @param len     length of compressed data
+ * @param ctype   compression flags
+ * @param roff    starting offset of uncompressed data
+ * @param rlen    length of uncompressed data
+ *
+ * @return        True on success, False on failure
+ */
 
-	*rlen = history_ptr - rdp->mppc->history_ptr;
+int decompress_rdp_4(rdpRdp* rdp, uint8* cbuf, int len, int ctype, uint32* roff, uint32* rlen)
+{
+	if ((rdp->mppc == NULL) || (rdp->mppc->history_buf == NULL))
+	{
+		printf("decompress_rdp_4: null\n");
+		return false;
+	}
 
-	rdp->mppc->history_ptr = history_ptr;
+	/* lengths of match up to 8191 */
+	return mppc_decompress(rdp, cbuf, len, ctype, roff, rlen, mppc_tokens_rdp4, 12);
+}
 
-	return true;
+/**
+ * decompress RDP 5 data
+ *
+ * @param rdp     per session information
+ * @param cbuf    compressed data
+ * @param len     length of compressed data
+ * @param ctype   compression flags
+ * @param roff    starting offset of uncompressed data
+ * @param rlen    length of uncompressed data
+ *
+ * @return        True on success, False on failure
+ */
+
+int decompress_rdp_5(rdpRdp* rdp, uint8* cbuf, int len, int ctype, uint32* roff, uint32* rlen)
+{
+	if ((rdp->mppc == NULL) || (rdp->mppc->history_buf == NULL))
+	{
+		printf("decompress_rdp_5: null\n");
+		return false;
+	}
+
+	/* lengths of match up to 65535 */
+	return mppc_decompress(rdp, cbuf, len, ctype, roff, rlen, mppc_tokens_rdp5, 15);
 }
 
 /**
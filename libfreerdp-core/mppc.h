@@ -25,6 +25,9 @@
 #define RDP6_HISTORY_BUF_SIZE     65536
 #define RDP6_OFFSET_CACHE_SIZE     4
 
+#define RDP4_HISTORY_BUF_SIZE     8192
+#define RDP5_HISTORY_BUF_SIZE     65536
+
 struct rdp_mppc
 {
 	uint8 *history_buf;
@@ -33,6 +36,21 @@ struct rdp_mppc
 	uint8 *history_ptr;
 };
 
+/* bulk compressor state, one per session and direction */
+struct rdp_mppc_enc
+{
+	int protocol_type;    /* PACKET_COMPR_TYPE_8K or PACKET_COMPR_TYPE_64K */
+	int buf_len;          /* size of the history buffer */
+	uint8* history_buf;
+	int history_offset;   /* next free byte in history_buf */
+	uint8* output_buf;    /* compressed data of the last packet */
+	int bytes_in_opb;     /* length of the compressed data */
+	uint8 flags;          /* compression flags of the last packet */
+	uint8 flags_hold;     /* flags carried over to the next compressed packet */
+	uint32* hash_head;    /* newest position + 1 of each 3 byte hash */
+	uint32* hash_prev;    /* previous position + 1 with the same hash */
+};
+
 // forward declarations
 int decompress_rdp(rdpRdp *, uint8 *, int, int, uint32 *, uint32 *);
 int decompress_rdp_4(rdpRdp *, uint8 *, int, int, uint32 *, uint32 *);
@@ -42,4 +60,10 @@ int decompress_rdp_61(rdpRdp *, uint8 *, int, int, uint32 *, uint32 *);
 struct rdp_mppc *mppc_new(rdpRdp *rdp);
 void mppc_free(rdpRdp *rdp);
 
+boolean compress_rdp(struct rdp_mppc_enc* enc, uint8* srcData, int len);
+boolean compress_rdp_4(struct rdp_mppc_enc* enc, uint8* srcData, int len);
+boolean compress_rdp_5(struct rdp_mppc_enc* enc, uint8* srcData, int len);
+struct rdp_mppc_enc* mppc_enc_new(int protocol_type);
+void mppc_enc_free(struct rdp_mppc_enc* enc);
+
 #endif
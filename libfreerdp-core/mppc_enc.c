@@ -0,0 +1,291 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * Implements Microsoft Point to Point Compression (MPPC) protocol
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rdp.h"
+
+/**
+ * Matches are found with hash chains: hash_head maps the hash of the three
+ * bytes at a position to the newest position with that hash, and hash_prev
+ * links each position to the previous one with the same hash. At most
+ * MPPC_ENC_MAX_CHAIN candidates are tried per position.
+ */
+#define MPPC_ENC_HASH_BITS	12
+#define MPPC_ENC_HASH_SIZE	(1 << MPPC_ENC_HASH_BITS)
+#define MPPC_ENC_MAX_CHAIN	16
+
+#define MPPC_ENC_HASH(_p) \
+	((((_p)[0] << 16 | (_p)[1] << 8 | (_p)[2]) * 0x9E3779B1) >> (32 - MPPC_ENC_HASH_BITS))
+
+#define MPPC_PUT_BITS(_value, _nbits) \
+	do { \
+		bits = (bits << (_nbits)) | (_value); \
+		nbits += (_nbits); \
+		while (nbits >= 8) \
+		{ \
+			nbits -= 8; \
+			*out++ = (uint8) (bits >> nbits); \
+		} \
+	} while (0)
+
+/**
+ * Forget the history, the next compressed packet tells the decompressor
+ * to do the same with flags.
+ */
+static void mppc_enc_reset(struct rdp_mppc_enc* enc, uint8 flags)
+{
+	enc->history_offset = 0;
+	enc->flags_hold |= flags;
+	memset(enc->hash_head, 0, MPPC_ENC_HASH_SIZE * sizeof(uint32));
+}
+
+/**
+ * compress RDP 4 or RDP 5 data
+ *
+ * @param enc     per session compressor
+ * @param srcData uncompressed data
+ * @param len     length of uncompressed data
+ * @param rdp5    use the 64K history encoding
+ *
+ * @return        true if the compressed data is in enc->output_buf,
+ *                false if srcData has to be sent as it is
+ */
+
+static boolean mppc_compress(struct rdp_mppc_enc* enc, uint8* srcData, int len, boolean rdp5)
+{
+	uint8* history;
+	uint8* out;
+	uint8* out_end;
+	uint32 bits;
+	int nbits;
+	int pos, end;
+	int max_lom;
+	int lom, best_lom, best_offset;
+	int offset, chain, k, i;
+	uint32 candidate;
+	uint32 hash;
+
+	enc->flags = 0;
+	enc->bytes_in_opb = 0;
+
+	/* packets larger than the history go out uncompressed, the history is untouched */
+	if (len <= 0 || len > enc->buf_len)
+		return false;
+
+	if (enc->history_offset + len > enc->buf_len)
+		mppc_enc_reset(enc, PACKET_AT_FRONT);
+
+	history = enc->history_buf;
+	pos = enc->history_offset;
+	end = pos + len;
+	memcpy(history + pos, srcData, len);
+
+	max_lom = rdp5 ? 65535 : 8191;
+	out = enc->output_buf;
+	out_end = out + len;
+	bits = 0;
+	nbits = 0;
+
+	while (pos < end)
+	{
+		best_lom = 0;
+		best_offset = 0;
+
+		if (pos + 2 < end)
+		{
+			hash = MPPC_ENC_HASH(&history[pos]);
+			candidate = enc->hash_head[hash];
+
+			for (chain = 0; candidate != 0 && chain < MPPC_ENC_MAX_CHAIN; chain++)
+			{
+				k = candidate - 1;
+
+				if (history[k + best_lom] == history[pos + best_lom])
+				{
+					lom = 0;
+					i = MIN(end - pos, max_lom);
+
+					while (lom < i && history[k + lom] == history[pos + lom])
+						lom++;
+
+					if (lom > best_lom)
+					{
+						best_lom = lom;
+						best_offset = pos - k;
+
+						if (lom == i)
+							break;
+					}
+				}
+
+				candidate = enc->hash_prev[k];
+			}
+
+			enc->hash_prev[pos] = enc->hash_head[hash];
+			enc->hash_head[hash] = pos + 1;
+		}
+
+		if (best_lom < 3)
+		{
+			/* literal, 0xxxxxxx or 10xxxxxxx */
+			if (history[pos] < 0x80)
+				MPPC_PUT_BITS(history[pos], 8);
+			else
+				MPPC_PUT_BITS(0x100 | (history[pos] & 0x7F), 9);
+
+			pos++;
+		}
+		else
+		{
+			/* copy offset, see decompress_rdp_4 and decompress_rdp_5 */
+			offset = best_offset;
+
+			if (rdp5)
+			{
+				if (offset < 64)
+					MPPC_PUT_BITS(0x7C0 | offset, 11);
+				else if (offset < 320)
+					MPPC_PUT_BITS(0x1E00 | (offset - 64), 13);
+				else if (offset < 2368)
+					MPPC_PUT_BITS(0x7000 | (offset - 320), 15);
+				else
+					MPPC_PUT_BITS(0x60000 | (offset - 2368), 19);
+			}
+			else
+			{
+				if (offset < 64)
+					MPPC_PUT_BITS(0x3C0 | offset, 10);
+				else if (offset < 320)
+					MPPC_PUT_BITS(0xE00 | (offset - 64), 12);
+				else
+					MPPC_PUT_BITS(0xC000 | (offset - 320), 16);
+			}
+
+			/* length of match, 3 is 0, 2^k to 2^(k+1) - 1 is k - 1 ones, a zero and k bits */
+			if (best_lom == 3)
+			{
+				MPPC_PUT_BITS(0, 1);
+			}
+			else
+			{
+				for (k = 2; (best_lom >> (k + 1)) != 0; k++);
+
+				MPPC_PUT_BITS(((1 << (k - 1)) - 1) << 1, k);
+				MPPC_PUT_BITS(best_lom & ((1 << k) - 1), k);
+			}
+
+			/* the rest of the match goes into the hash chains too */
+			for (i = pos + 1; i < pos + best_lom && i + 2 < end; i++)
+			{
+				hash = MPPC_ENC_HASH(&history[i]);
+				enc->hash_prev[i] = enc->hash_head[hash];
+				enc->hash_head[hash] = i + 1;
+			}
+
+			pos += best_lom;
+		}
+
+		if (out >= out_end)
+			break;
+	}
+
+	if (nbits > 0)
+		*out++ = (uint8) (bits << (8 - nbits));
+
+	if (out >= out_end)
+	{
+		/* no gain, the decompressor has to drop this packet from its history as well */
+		mppc_enc_reset(enc, PACKET_FLUSHED | PACKET_AT_FRONT);
+		return false;
+	}
+
+	enc->history_offset = end;
+	enc->bytes_in_opb = out - enc->output_buf;
+	enc->flags = PACKET_COMPRESSED | enc->protocol_type | enc->flags_hold;
+	enc->flags_hold = 0;
+
+	return true;
+}
+
+boolean compress_rdp_4(struct rdp_mppc_enc* enc, uint8* srcData, int len)
+{
+	return mppc_compress(enc, srcData, len, false);
+}
+
+boolean compress_rdp_5(struct rdp_mppc_enc* enc, uint8* srcData, int len)
+{
+	return mppc_compress(enc, srcData, len, true);
+}
+
+/**
+ * Compress a packet into enc->output_buf. When true is returned, the
+ * packet goes out as enc->bytes_in_opb bytes with the compression flags in
+ * enc->flags. Otherwise it goes out uncompressed, with no compression flags.
+ */
+
+boolean compress_rdp(struct rdp_mppc_enc* enc, uint8* srcData, int len)
+{
+	switch (enc->protocol_type)
+	{
+		case PACKET_COMPR_TYPE_8K:
+			return compress_rdp_4(enc, srcData, len);
+
+		case PACKET_COMPR_TYPE_64K:
+			return compress_rdp_5(enc, srcData, len);
+
+		default:
+			enc->flags = 0;
+			enc->bytes_in_opb = 0;
+			return false;
+	}
+}
+
+/**
+ * allocate a compressor
+ *
+ * @param protocol_type PACKET_COMPR_TYPE_8K or PACKET_COMPR_TYPE_64K
+ * @return new compressor, or NULL for an unsupported type
+ */
+
+struct rdp_mppc_enc* mppc_enc_new(int protocol_type)
+{
+	struct rdp_mppc_enc* enc;
+
+	if (protocol_type != PACKET_COMPR_TYPE_8K && protocol_type != PACKET_COMPR_TYPE_64K)
+		return NULL;
+
+	enc = xnew(struct rdp_mppc_enc);
+	enc->protocol_type = protocol_type;
+	enc->buf_len = (protocol_type == PACKET_COMPR_TYPE_8K) ? RDP4_HISTORY_BUF_SIZE : RDP5_HISTORY_BUF_SIZE;
+	enc->history_buf = (uint8*) xzalloc(enc->buf_len);
+	enc->output_buf = (uint8*) xzalloc(enc->buf_len + 8);
+	enc->hash_head = (uint32*) xzalloc(MPPC_ENC_HASH_SIZE * sizeof(uint32));
+	enc->hash_prev = (uint32*) xzalloc(enc->buf_len * sizeof(uint32));
+
+	return enc;
+}
+
+void mppc_enc_free(struct rdp_mppc_enc* enc)
+{
+	if (enc == NULL)
+		return;
+
+	xfree(enc->history_buf);
+	xfree(enc->output_buf);
+	xfree(enc->hash_head);
+	xfree(enc->hash_prev);
+	xfree(enc);
+}
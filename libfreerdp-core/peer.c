@@ -36,3 +36,15 @@ void freerdp_peer_free(freerdp_peer* client)
 {
 }
 
+
+/**
+ * Bytes sent to the client that are still waiting for the socket. A server
+ * can skip or merge frames while this is large, instead of queueing more.
+ */
+uint32 freerdp_peer_get_queued_bytes(freerdp_peer* client)
+{
+	if (client->context == NULL || client->context->rdp == NULL)
+		return 0;
+
+	return transport_get_queued_bytes(client->context->rdp->transport);
+}
@@ -143,7 +143,8 @@ tbool rdp_read_share_data_header(STREAM* s, uint16* length, uint8* type, uint32*
 	return true;
 }
 
-void rdp_write_share_data_header(STREAM* s, uint16 length, uint8 type, uint32 share_id)
+void rdp_write_share_data_header(STREAM* s, uint16 length, uint8 type, uint32 share_id,
+					uint8 compressed_type, uint16 compressed_len)
 {
 	length -= RDP_PACKET_HEADER_MAX_LENGTH;
 	length -= RDP_SHARE_CONTROL_HEADER_LENGTH;
@@ -155,8 +156,8 @@ void rdp_write_share_data_header(STREAM* s, uint16 length, uint8 type, uint32 sh
 	stream_write_uint8(s, STREAM_LOW); /* streamId (1 byte) */
 	stream_write_uint16(s, length); /* uncompressedLength (2 bytes) */
 	stream_write_uint8(s, type); /* pduType2, Data PDU Type (1 byte) */
-	stream_write_uint8(s, 0); /* compressedType (1 byte) */
-	stream_write_uint16(s, 0); /* compressedLength (2 bytes) */
+	stream_write_uint8(s, compressed_type); /* compressedType (1 byte) */
+	stream_write_uint16(s, compressed_len); /* compressedLength (2 bytes) */
 }
 
 static int rdp_security_stream_init(rdpRdp* rdp, STREAM* s)
@@ -447,20 +448,47 @@ tbool rdp_send_pdu(rdpRdp* rdp, STREAM* s, uint16 type, uint16 channel_id)
 tbool rdp_send_data_pdu(rdpRdp* rdp, STREAM* s, uint8 type, uint16 channel_id)
 {
 	uint16 length;
+	uint16 uncompressed_length;
 	uint32 sec_bytes;
 	uint8* sec_hold;
+	uint8* data;
+	uint16 data_length;
+	uint8 compressed_type;
+	uint16 compressed_len;
 
 	length = stream_get_length(s);
+	uncompressed_length = length;
 	stream_set_pos(s, 0);
 
+	sec_bytes = rdp_get_sec_bytes(rdp);
+	compressed_type = 0;
+	compressed_len = 0;
+
+	if (rdp->mppc_enc != NULL)
+	{
+		data = s->data + RDP_PACKET_HEADER_MAX_LENGTH + sec_bytes +
+			RDP_SHARE_CONTROL_HEADER_LENGTH + RDP_SHARE_DATA_HEADER_LENGTH;
+		data_length = length - (data - s->data);
+
+		if (compress_rdp(rdp->mppc_enc, data, data_length))
+		{
+			/* the compressed data is shorter, it replaces the data in place */
+			memcpy(data, rdp->mppc_enc->output_buf, rdp->mppc_enc->bytes_in_opb);
+			compressed_type = rdp->mppc_enc->flags;
+			compressed_len = rdp->mppc_enc->bytes_in_opb +
+				RDP_SHARE_CONTROL_HEADER_LENGTH + RDP_SHARE_DATA_HEADER_LENGTH;
+			length -= data_length - rdp->mppc_enc->bytes_in_opb;
+		}
+	}
+
 	rdp_write_header(rdp, s, length, MCS_GLOBAL_CHANNEL_ID);
 
-	sec_bytes = rdp_get_sec_bytes(rdp);
 	sec_hold = s->p;
 	stream_seek(s, sec_bytes);
 
 	rdp_write_share_control_header(s, length - sec_bytes, PDU_TYPE_DATA, channel_id);
-	rdp_write_share_data_header(s, length - sec_bytes, type, rdp->settings->share_id);
+	rdp_write_share_data_header(s, uncompressed_length - sec_bytes, type, rdp->settings->share_id,
+		compressed_type, compressed_len);
 
 	s->p = sec_hold;
 	length += rdp_security_stream_out(rdp, s, length);
@@ -1050,6 +1078,7 @@ void rdp_free(rdpRdp* rdp)
 		mcs_free(rdp->mcs);
 		redirection_free(rdp->redirection);
 		mppc_free(rdp);
+		mppc_enc_free(rdp->mppc_enc);
 		xfree(rdp);
 	}
 }
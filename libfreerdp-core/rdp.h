@@ -136,6 +136,7 @@ struct rdp_rdp
 	struct rdp_transport* transport;
 	struct rdp_extension* extension;
 	struct rdp_mppc* mppc;
+	struct rdp_mppc_enc* mppc_enc;
 	struct crypto_rc4_struct* rc4_decrypt_key;
 	int decrypt_use_count;
 	struct crypto_rc4_struct* rc4_encrypt_key;
@@ -172,7 +173,7 @@ boolean rdp_read_share_data_header(STREAM* s, uint16* length, uint8* type,
 		uint32* share_id, uint8 *compressed_type, uint16 *compressed_len);
 
 void rdp_write_share_data_header(STREAM* s, uint16 length, uint8 type,
-		uint32 share_id);
+		uint32 share_id, uint8 compressed_type, uint16 compressed_len);
 
 STREAM* rdp_send_stream_init(rdpRdp* rdp);
 
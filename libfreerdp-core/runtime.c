@@ -0,0 +1,813 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol Client
+ * RDP Server Runtime
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <freerdp/utils/memory.h>
+
+#include "peer.h"
+#include <freerdp/runtime.h>
+
+#ifdef HAVE_SYS_EPOLL_H
+
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+/* as many fds per session as the select() loops of the servers take */
+#define RUNTIME_MAX_FDS		32
+#define RUNTIME_MAX_SOURCES	8
+#define RUNTIME_MAX_EVENTS	64
+
+/* what the data.ptr of an epoll event points to, the wakeup eventfd has NULL */
+#define RUNTIME_HANDLE_SESSION	1
+#define RUNTIME_HANDLE_TIMER	2
+
+typedef struct rdp_runtime rdpRuntime;
+typedef struct _RUNTIME_WORKER RUNTIME_WORKER;
+typedef struct _RUNTIME_SESSION RUNTIME_SESSION;
+typedef struct _RUNTIME_SOURCE RUNTIME_SOURCE;
+typedef struct _RUNTIME_TIMER RUNTIME_TIMER;
+
+struct _RUNTIME_SOURCE
+{
+	void* object;
+	psRuntimeGetFileDescriptor GetFileDescriptor;
+	psRuntimeCheckFileDescriptor CheckFileDescriptor;
+};
+
+struct _RUNTIME_TIMER
+{
+	int type;
+	int fd;
+	psRuntimeTimer callback;
+	void* param;
+	RUNTIME_SESSION* session;
+	RUNTIME_TIMER* next;
+};
+
+struct _RUNTIME_SESSION
+{
+	int type;
+	freerdp_peer* client;
+	RUNTIME_WORKER* worker;
+	boolean started;
+	boolean closed;
+	uint32 serial;
+
+	RUNTIME_SOURCE sources[RUNTIME_MAX_SOURCES];
+	int num_sources;
+	RUNTIME_TIMER* timers;
+
+	/* what is registered with the epoll fd of the worker */
+	int fds[RUNTIME_MAX_FDS];
+	uint32 events[RUNTIME_MAX_FDS];
+	int num_fds;
+
+	RUNTIME_SESSION* prev;
+	RUNTIME_SESSION* next;
+};
+
+struct _RUNTIME_WORKER
+{
+	rdpRuntime* runtime;
+	pthread_t thread;
+	int epoll_fd;
+	int wakeup_fd;
+	uint32 serial;
+
+	/* protected by the runtime lock */
+	RUNTIME_SESSION* pending;
+	int num_sessions;
+
+	/* only touched by the worker thread once it runs */
+	RUNTIME_SESSION* sessions;
+	RUNTIME_SESSION* closed;
+};
+
+struct rdp_runtime
+{
+	freerdp_runtime* instance;
+
+	pthread_mutex_t lock;
+	boolean quit;
+
+	RUNTIME_WORKER* workers;
+	int num_workers;
+
+	/* sessions with sources or timers whose peer was not added yet, protected by lock */
+	RUNTIME_SESSION* idle;
+};
+
+static void runtime_list_add(RUNTIME_SESSION** list, RUNTIME_SESSION* session)
+{
+	session->prev = NULL;
+	session->next = *list;
+
+	if (*list != NULL)
+		(*list)->prev = session;
+
+	*list = session;
+}
+
+static void runtime_list_remove(RUNTIME_SESSION** list, RUNTIME_SESSION* session)
+{
+	if (session->prev != NULL)
+		session->prev->next = session->next;
+	else
+		*list = session->next;
+
+	if (session->next != NULL)
+		session->next->prev = session->prev;
+
+	session->prev = NULL;
+	session->next = NULL;
+}
+
+/**
+ * The session of a peer, created on the least busy worker the first time
+ * the peer is seen.
+ */
+static RUNTIME_SESSION* runtime_session_get(rdpRuntime* runtime, freerdp_peer* client)
+{
+	int i;
+	RUNTIME_SESSION* session;
+	RUNTIME_WORKER* worker;
+
+	if (client->runtime != NULL)
+		return (RUNTIME_SESSION*) client->runtime;
+
+	session = xnew(RUNTIME_SESSION);
+	session->type = RUNTIME_HANDLE_SESSION;
+	session->client = client;
+	client->runtime = session;
+
+	pthread_mutex_lock(&runtime->lock);
+
+	worker = &runtime->workers[0];
+
+	for (i = 1; i < runtime->num_workers; i++)
+	{
+		if (runtime->workers[i].num_sessions < worker->num_sessions)
+			worker = &runtime->workers[i];
+	}
+
+	worker->num_sessions++;
+	session->worker = worker;
+	runtime_list_add(&runtime->idle, session);
+
+	pthread_mutex_unlock(&runtime->lock);
+
+	return session;
+}
+
+/**
+ * Collect the fds of the peer and of the sources of a session. The peer
+ * socket is also polled for writing while its output queue is not empty.
+ */
+static int runtime_session_get_fds(RUNTIME_SESSION* session, int* fds, uint32* events)
+{
+	int i, j;
+	int fd;
+	int rcount;
+	int count;
+	void* rfds[RUNTIME_MAX_FDS];
+	freerdp_peer* client = session->client;
+	RUNTIME_SOURCE* source;
+
+	rcount = 0;
+
+	if (client->GetFileDescriptor != NULL)
+	{
+		if (client->GetFileDescriptor(client, rfds, &rcount) != true)
+			return -1;
+	}
+
+	for (i = 0; i < session->num_sources; i++)
+	{
+		source = &session->sources[i];
+
+		if (source->GetFileDescriptor(source->object, rfds, &rcount) != true)
+			return -1;
+	}
+
+	count = 0;
+
+	for (i = 0; i < rcount; i++)
+	{
+		fd = (int)(long) rfds[i];
+
+		for (j = 0; j < count && fds[j] != fd; j++);
+
+		if (j == count && count < RUNTIME_MAX_FDS)
+		{
+			fds[count] = fd;
+			events[count] = EPOLLIN;
+			count++;
+		}
+	}
+
+	if (client->sockfd > 0 && freerdp_peer_get_queued_bytes(client) > 0)
+	{
+		for (j = 0; j < count && fds[j] != client->sockfd; j++);
+
+		if (j < count)
+		{
+			events[j] |= EPOLLOUT;
+		}
+		else if (count < RUNTIME_MAX_FDS)
+		{
+			fds[count] = client->sockfd;
+			events[count] = EPOLLOUT;
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * Bring the fds registered for a session in line with the ones it wants
+ * now, with as few epoll_ctl() calls as possible.
+ */
+static boolean runtime_session_update(RUNTIME_SESSION* session)
+{
+	int i, j;
+	int count;
+	int fds[RUNTIME_MAX_FDS];
+	uint32 events[RUNTIME_MAX_FDS];
+	struct epoll_event event;
+	int epoll_fd = session->worker->epoll_fd;
+
+	count = runtime_session_get_fds(session, fds, events);
+
+	if (count < 0)
+		return false;
+
+	for (i = 0; i < session->num_fds; i++)
+	{
+		for (j = 0; j < count && fds[j] != session->fds[i]; j++);
+
+		/* the fd may be closed already, which removed it from the epoll set */
+		if (j == count)
+			epoll_ctl(epoll_fd, EPOLL_CTL_DEL, session->fds[i], NULL);
+	}
+
+	for (j = 0; j < count; j++)
+	{
+		for (i = 0; i < session->num_fds && session->fds[i] != fds[j]; i++);
+
+		if (i < session->num_fds && session->events[i] == events[j])
+			continue;
+
+		memset(&event, 0, sizeof(event));
+		event.events = events[j];
+		event.data.ptr = session;
+
+		if (epoll_ctl(epoll_fd, (i < session->num_fds) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fds[j], &event) != 0)
+		{
+			perror("runtime_session_update: epoll_ctl");
+			return false;
+		}
+	}
+
+	memcpy(session->fds, fds, count * sizeof(int));
+	memcpy(session->events, events, count * sizeof(uint32));
+	session->num_fds = count;
+
+	return true;
+}
+
+static boolean runtime_timer_register(RUNTIME_TIMER* timer)
+{
+	struct epoll_event event;
+
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.ptr = timer;
+
+	if (epoll_ctl(timer->session->worker->epoll_fd, EPOLL_CTL_ADD, timer->fd, &event) != 0)
+	{
+		perror("runtime_timer_register: epoll_ctl");
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Start serving a session handed over by freerdp_runtime_add_peer().
+ */
+static boolean runtime_session_start(RUNTIME_SESSION* session)
+{
+	RUNTIME_TIMER* timer;
+
+	session->started = true;
+	runtime_list_add(&session->worker->sessions, session);
+
+	for (timer = session->timers; timer != NULL; timer = timer->next)
+	{
+		if (!runtime_timer_register(timer))
+			return false;
+	}
+
+	return runtime_session_update(session);
+}
+
+/**
+ * Stop polling a session. It is freed once the worker is done with the
+ * current batch of events, which may still refer to it.
+ */
+static void runtime_session_close(RUNTIME_SESSION* session)
+{
+	int i;
+	RUNTIME_TIMER* timer;
+	RUNTIME_WORKER* worker = session->worker;
+
+	if (session->closed)
+		return;
+
+	session->closed = true;
+
+	for (i = 0; i < session->num_fds; i++)
+		epoll_ctl(worker->epoll_fd, EPOLL_CTL_DEL, session->fds[i], NULL);
+
+	session->num_fds = 0;
+
+	for (timer = session->timers; timer != NULL; timer = timer->next)
+		epoll_ctl(worker->epoll_fd, EPOLL_CTL_DEL, timer->fd, NULL);
+
+	if (session->started)
+		runtime_list_remove(&worker->sessions, session);
+
+	runtime_list_add(&worker->closed, session);
+}
+
+static void runtime_session_free(RUNTIME_SESSION* session)
+{
+	RUNTIME_TIMER* timer;
+	RUNTIME_WORKER* worker = session->worker;
+	rdpRuntime* runtime = worker->runtime;
+	freerdp_peer* client = session->client;
+
+	while (session->timers != NULL)
+	{
+		timer = session->timers;
+		session->timers = timer->next;
+		close(timer->fd);
+		xfree(timer);
+	}
+
+	pthread_mutex_lock(&runtime->lock);
+	worker->num_sessions--;
+	pthread_mutex_unlock(&runtime->lock);
+
+	client->runtime = NULL;
+	xfree(session);
+
+	if (runtime->instance->PeerClosed != NULL)
+	{
+		runtime->instance->PeerClosed(runtime->instance, client);
+	}
+	else
+	{
+		printf("Client %s disconnected.\n", client->hostname);
+
+		IFCALL(client->Disconnect, client);
+		freerdp_peer_context_free(client);
+		freerdp_peer_free(client);
+	}
+}
+
+static boolean runtime_session_check(RUNTIME_SESSION* session)
+{
+	int i;
+	freerdp_peer* client = session->client;
+	RUNTIME_SOURCE* source;
+
+	if (client->CheckFileDescriptor != NULL)
+	{
+		if (client->CheckFileDescriptor(client) != true)
+			return false;
+	}
+
+	for (i = 0; i < session->num_sources; i++)
+	{
+		source = &session->sources[i];
+
+		if (source->CheckFileDescriptor(source->object) != true)
+			return false;
+	}
+
+	return runtime_session_update(session);
+}
+
+static boolean runtime_timer_check(RUNTIME_TIMER* timer)
+{
+	uint64 expirations;
+
+	if (read(timer->fd, &expirations, sizeof(expirations)) != sizeof(expirations))
+		return true;
+
+	/* a late timer fires once, not once per missed interval */
+	if (timer->callback(timer->session->client, timer->param) != true)
+		return false;
+
+	return runtime_session_update(timer->session);
+}
+
+/**
+ * Start the sessions handed to the worker. Returns false once the runtime
+ * is being freed.
+ */
+static boolean runtime_worker_wakeup(RUNTIME_WORKER* worker)
+{
+	uint64 value;
+	boolean quit;
+	RUNTIME_SESSION* session;
+	RUNTIME_SESSION* pending;
+	rdpRuntime* runtime = worker->runtime;
+
+	if (read(worker->wakeup_fd, &value, sizeof(value)) != sizeof(value))
+		return true;
+
+	pthread_mutex_lock(&runtime->lock);
+	quit = runtime->quit;
+	pending = quit ? NULL : worker->pending;
+
+	if (!quit)
+		worker->pending = NULL;
+
+	pthread_mutex_unlock(&runtime->lock);
+
+	while (pending != NULL)
+	{
+		session = pending;
+		pending = session->next;
+
+		if (!runtime_session_start(session))
+			runtime_session_close(session);
+	}
+
+	return quit ? false : true;
+}
+
+static void* runtime_worker_main(void* arg)
+{
+	int i;
+	int count;
+	int* handle;
+	RUNTIME_TIMER* timer;
+	RUNTIME_SESSION* session;
+	struct epoll_event events[RUNTIME_MAX_EVENTS];
+	boolean running = true;
+	RUNTIME_WORKER* worker = (RUNTIME_WORKER*) arg;
+
+	while (running)
+	{
+		count = epoll_wait(worker->epoll_fd, events, RUNTIME_MAX_EVENTS, -1);
+
+		if (count < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			perror("runtime_worker_main: epoll_wait");
+			break;
+		}
+
+		/* a session with several ready fds is checked once per batch */
+		worker->serial++;
+
+		for (i = 0; i < count; i++)
+		{
+			handle = (int*) events[i].data.ptr;
+
+			if (handle == NULL)
+			{
+				running = runtime_worker_wakeup(worker);
+			}
+			else if (*handle == RUNTIME_HANDLE_TIMER)
+			{
+				timer = (RUNTIME_TIMER*) handle;
+
+				if (!timer->session->closed && !runtime_timer_check(timer))
+					runtime_session_close(timer->session);
+			}
+			else
+			{
+				session = (RUNTIME_SESSION*) handle;
+
+				if (session->closed || session->serial == worker->serial)
+					continue;
+
+				session->serial = worker->serial;
+
+				if (!runtime_session_check(session))
+					runtime_session_close(session);
+			}
+		}
+
+		while (worker->closed != NULL)
+		{
+			session = worker->closed;
+			worker->closed = session->next;
+			runtime_session_free(session);
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Create a runtime and start its worker threads.
+ * @param workers number of worker threads, at least one
+ */
+
+freerdp_runtime* freerdp_runtime_new(int workers)
+{
+	int i;
+	RUNTIME_WORKER* worker;
+	struct epoll_event event;
+	freerdp_runtime* instance;
+	rdpRuntime* runtime;
+
+	if (workers < 1)
+		workers = 1;
+
+	instance = xnew(freerdp_runtime);
+	runtime = xnew(rdpRuntime);
+	runtime->instance = instance;
+	instance->runtime = (void*) runtime;
+
+	pthread_mutex_init(&runtime->lock, 0);
+	runtime->workers = xnew0(RUNTIME_WORKER, workers);
+
+	for (i = 0; i < workers; i++)
+	{
+		worker = &runtime->workers[i];
+		worker->runtime = runtime;
+		worker->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+		worker->wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+		memset(&event, 0, sizeof(event));
+		event.events = EPOLLIN;
+		event.data.ptr = NULL;
+
+		if (worker->epoll_fd < 0 || worker->wakeup_fd < 0 ||
+			epoll_ctl(worker->epoll_fd, EPOLL_CTL_ADD, worker->wakeup_fd, &event) != 0 ||
+			pthread_create(&worker->thread, 0, runtime_worker_main, worker) != 0)
+		{
+			printf("freerdp_runtime_new: failed to create worker %d\n", i);
+
+			if (worker->epoll_fd >= 0)
+				close(worker->epoll_fd);
+
+			if (worker->wakeup_fd >= 0)
+				close(worker->wakeup_fd);
+
+			break;
+		}
+
+		runtime->num_workers++;
+	}
+
+	if (runtime->num_workers == 0)
+	{
+		freerdp_runtime_free(instance);
+		return NULL;
+	}
+
+	return instance;
+}
+
+/**
+ * Stop the workers, then close every session that is left.
+ */
+
+void freerdp_runtime_free(freerdp_runtime* instance)
+{
+	int i;
+	uint64 value = 1;
+	RUNTIME_WORKER* worker;
+	RUNTIME_SESSION* session;
+	rdpRuntime* runtime;
+
+	if (instance == NULL)
+		return;
+
+	runtime = (rdpRuntime*) instance->runtime;
+
+	pthread_mutex_lock(&runtime->lock);
+	runtime->quit = true;
+	pthread_mutex_unlock(&runtime->lock);
+
+	for (i = 0; i < runtime->num_workers; i++)
+	{
+		if (write(runtime->workers[i].wakeup_fd, &value, sizeof(value)) != sizeof(value))
+			perror("freerdp_runtime_free: write");
+	}
+
+	for (i = 0; i < runtime->num_workers; i++)
+		pthread_join(runtime->workers[i].thread, NULL);
+
+	while (runtime->idle != NULL)
+	{
+		session = runtime->idle;
+		runtime_list_remove(&runtime->idle, session);
+		runtime_session_close(session);
+	}
+
+	for (i = 0; i < runtime->num_workers; i++)
+	{
+		worker = &runtime->workers[i];
+
+		while (worker->pending != NULL)
+		{
+			session = worker->pending;
+			worker->pending = session->next;
+			runtime_session_close(session);
+		}
+
+		while (worker->sessions != NULL)
+			runtime_session_close(worker->sessions);
+
+		while (worker->closed != NULL)
+		{
+			session = worker->closed;
+			worker->closed = session->next;
+			runtime_session_free(session);
+		}
+
+		close(worker->epoll_fd);
+		close(worker->wakeup_fd);
+	}
+
+	pthread_mutex_destroy(&runtime->lock);
+	xfree(runtime->workers);
+	xfree(runtime);
+	xfree(instance);
+}
+
+/**
+ * Hand a peer to a worker, which serves it from then on. The peer has to
+ * be initialized already.
+ */
+
+boolean freerdp_runtime_add_peer(freerdp_runtime* instance, freerdp_peer* client)
+{
+	uint64 value = 1;
+	RUNTIME_SESSION* session;
+	RUNTIME_WORKER* worker;
+	rdpRuntime* runtime = (rdpRuntime*) instance->runtime;
+
+	session = runtime_session_get(runtime, client);
+
+	if (session->started)
+		return true;
+
+	worker = session->worker;
+
+	pthread_mutex_lock(&runtime->lock);
+	runtime_list_remove(&runtime->idle, session);
+	session->next = worker->pending;
+	worker->pending = session;
+	pthread_mutex_unlock(&runtime->lock);
+
+	if (write(worker->wakeup_fd, &value, sizeof(value)) != sizeof(value))
+	{
+		perror("freerdp_runtime_add_peer: write");
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Poll the fds of object along with the peer, for example those of its
+ * virtual channel manager. CheckFileDescriptor is called whenever the
+ * session wakes up.
+ */
+
+boolean freerdp_runtime_add_source(freerdp_runtime* instance, freerdp_peer* client, void* object,
+	psRuntimeGetFileDescriptor GetFileDescriptor, psRuntimeCheckFileDescriptor CheckFileDescriptor)
+{
+	RUNTIME_SOURCE* source;
+	RUNTIME_SESSION* session;
+	rdpRuntime* runtime = (rdpRuntime*) instance->runtime;
+
+	session = runtime_session_get(runtime, client);
+
+	if (session->num_sources >= RUNTIME_MAX_SOURCES)
+	{
+		printf("freerdp_runtime_add_source: too many sources\n");
+		return false;
+	}
+
+	source = &session->sources[session->num_sources++];
+	source->object = object;
+	source->GetFileDescriptor = GetFileDescriptor;
+	source->CheckFileDescriptor = CheckFileDescriptor;
+
+	if (session->started)
+		return runtime_session_update(session);
+
+	return true;
+}
+
+/**
+ * Call callback every interval milliseconds, on the worker of the peer.
+ */
+
+boolean freerdp_runtime_add_timer(freerdp_runtime* instance, freerdp_peer* client,
+	uint32 interval, psRuntimeTimer callback, void* param)
+{
+	RUNTIME_TIMER* timer;
+	RUNTIME_SESSION* session;
+	struct itimerspec spec;
+	rdpRuntime* runtime = (rdpRuntime*) instance->runtime;
+
+	if (interval < 1)
+		interval = 1;
+
+	timer = xnew(RUNTIME_TIMER);
+	timer->type = RUNTIME_HANDLE_TIMER;
+	timer->callback = callback;
+	timer->param = param;
+	timer->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+	spec.it_interval.tv_sec = interval / 1000;
+	spec.it_interval.tv_nsec = (interval % 1000) * 1000000;
+	spec.it_value = spec.it_interval;
+
+	if (timer->fd < 0 || timerfd_settime(timer->fd, 0, &spec, NULL) != 0)
+	{
+		perror("freerdp_runtime_add_timer");
+
+		if (timer->fd >= 0)
+			close(timer->fd);
+
+		xfree(timer);
+		return false;
+	}
+
+	session = runtime_session_get(runtime, client);
+	timer->session = session;
+	timer->next = session->timers;
+	session->timers = timer;
+
+	if (session->started)
+		return runtime_timer_register(timer);
+
+	return true;
+}
+
+#else
+
+freerdp_runtime* freerdp_runtime_new(int workers)
+{
+	printf("freerdp_runtime_new: not supported on this platform\n");
+	return NULL;
+}
+
+void freerdp_runtime_free(freerdp_runtime* instance)
+{
+}
+
+boolean freerdp_runtime_add_peer(freerdp_runtime* instance, freerdp_peer* client)
+{
+	return false;
+}
+
+boolean freerdp_runtime_add_source(freerdp_runtime* instance, freerdp_peer* client, void* object,
+	psRuntimeGetFileDescriptor GetFileDescriptor, psRuntimeCheckFileDescriptor CheckFileDescriptor)
+{
+	return false;
+}
+
+boolean freerdp_runtime_add_timer(freerdp_runtime* instance, freerdp_peer* client,
+	uint32 interval, psRuntimeTimer callback, void* param)
+{
+	return false;
+}
+
+#endif
@@ -31,6 +31,7 @@
 #include <unistd.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/un.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
@@ -232,6 +233,27 @@ tbool tcp_can_recv(int sck, int millis)
 	return false;
 }
 
+tbool tcp_can_send(int sck, int millis)
+{
+	fd_set wfds;
+	struct timeval time;
+	int rv;
+
+	time.tv_sec = millis / 1000;
+	time.tv_usec = (millis * 1000) % 1000000;
+	FD_ZERO(&wfds);
+	if (sck > 0)
+	{
+		FD_SET(((unsigned int)sck), &wfds);
+		rv = select(sck + 1, 0, &wfds, 0, &time);
+		if (rv > 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 int tcp_read(rdpTcp* tcp, uint8* data, int length)
 {
 	int status;
@@ -305,6 +327,58 @@ int tcp_write(rdpTcp* tcp, uint8* data, int length)
 	return status;
 }
 
+/**
+ * Send count buffers with one system call. Returns the number of bytes
+ * sent, 0 if the socket would block, or -1 on error.
+ */
+int tcp_write_gather(rdpTcp* tcp, uint8** data, int* length, int count)
+{
+#ifdef _WIN32
+	int i;
+
+	for (i = 0; i < count; i++)
+	{
+		if (length[i] > 0)
+			return tcp_write(tcp, data[i], length[i]);
+	}
+
+	return 0;
+#else
+	int i;
+	int status;
+	struct msghdr msg;
+	struct iovec iov[TCP_WRITE_GATHER_MAX];
+
+	if (count > TCP_WRITE_GATHER_MAX)
+		count = TCP_WRITE_GATHER_MAX;
+
+	for (i = 0; i < count; i++)
+	{
+		iov[i].iov_base = data[i];
+		iov[i].iov_len = length[i];
+	}
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = count;
+
+	/* sendmsg() rather than writev(), for MSG_NOSIGNAL */
+	status = sendmsg(tcp->sockfd, &msg, MSG_NOSIGNAL);
+
+	LLOGLN(10, ("tcp_write_gather: count %d status %d", count, status));
+
+	if (status < 0)
+	{
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+			status = 0;
+		else
+			perror("sendmsg");
+	}
+
+	return status;
+#endif
+}
+
 tbool tcp_disconnect(rdpTcp * tcp)
 {
 	if (tcp->sockfd != -1)
@@ -35,6 +35,9 @@
 #define MSG_NOSIGNAL 0
 #endif
 
+/* buffers tcp_write_gather() sends at once */
+#define TCP_WRITE_GATHER_MAX 16
+
 typedef struct rdp_tcp rdpTcp;
 
 struct rdp_tcp
@@ -51,8 +54,10 @@ struct rdp_tcp
 boolean tcp_connect(rdpTcp* tcp, const char* hostname, uint16 port);
 boolean tcp_disconnect(rdpTcp* tcp);
 tbool tcp_can_recv(int sck, int millis);
+tbool tcp_can_send(int sck, int millis);
 int tcp_read(rdpTcp* tcp, uint8* data, int length);
 int tcp_write(rdpTcp* tcp, uint8* data, int length);
+int tcp_write_gather(rdpTcp* tcp, uint8** data, int* length, int count);
 boolean tcp_set_blocking_mode(rdpTcp* tcp, boolean blocking);
 boolean tcp_set_keep_alive_mode(rdpTcp* tcp);
 
@@ -56,6 +56,9 @@ tbool tls_connect(rdpTls* tls)
 	// Explicitly disable deprecated SSL protocols
 	SSL_CTX_set_options(tls->ctx, SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3);
 
+	/* a write that would block is retried from the transport output queue, not the same buffer */
+	SSL_CTX_set_mode(tls->ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+
 	tls->ssl = SSL_new(tls->ctx);
 
 	if (tls->ssl == NULL)
@@ -99,6 +102,8 @@ tbool tls_accept(rdpTls* tls, const char* cert_file, const char* privatekey_file
 		return false;
 	}
 
+	SSL_CTX_set_mode(tls->ctx, SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+
 	tls->ssl = SSL_new(tls->ctx);
 
 	if (tls->ssl == NULL)
@@ -42,6 +42,14 @@
 
 #define BUFFER_SIZE (16384 * 2)
 
+/**
+ * TCP and TLS data is received into a ring of TRANSPORT_RING_SIZE bytes,
+ * larger than any PDU. ring_read and ring_write count the bytes consumed
+ * and received so far, their difference is what the ring holds.
+ */
+#define TRANSPORT_RING_SIZE 0x20000
+#define TRANSPORT_RING_MASK (TRANSPORT_RING_SIZE - 1)
+
 #define LLOG_LEVEL 1
 #define LLOGLN(_level, _args) \
   do { if (_level < LLOG_LEVEL) { printf _args ; printf("\n"); } } while (0)
@@ -323,98 +331,47 @@ int transport_read_layer(rdpTransport* transport, uint8* data, int bytes)
 	return read;
 }
 
-int transport_read(rdpTransport* transport, STREAM* s)
+static int transport_read_tsg(rdpTransport* transport, STREAM* s)
 {
 	int status;
 	int pdu_bytes;
 	int stream_bytes;
 	int transport_status;
-	int header_bytes;
 	tbool got_whole_pdu;
 
-	LLOGLN(10, ("transport_read: blocking %d", transport->blocking));
+	LLOGLN(10, ("transport_read_tsg: blocking %d", transport->blocking));
 	transport_status = 0;
 
 	/* first check if we have header */
 	stream_bytes = stream_get_length(s);
 
-	header_bytes = transport->layer == TRANSPORT_LAYER_TSG ? 10 : 4;
-
-	if (stream_bytes < header_bytes)
+	if (stream_bytes < 10)
 	{
-		LLOGLN(10, ("transport_read: transport_read_layer 1st call"));
+		LLOGLN(10, ("transport_read_tsg: transport_read_layer 1st call"));
 		status = transport_read_layer(transport, s->data + stream_bytes,
-				header_bytes - stream_bytes);
+				10 - stream_bytes);
 
 		if (status < 0)
 		{
-			LLOGLN(0, ("transport_read: transport_read_layer failed"));
+			LLOGLN(0, ("transport_read_tsg: transport_read_layer failed"));
 			return status;
 		}
 
 		transport_status += status;
 
-		if ((status + stream_bytes) < header_bytes)
+		if ((status + stream_bytes) < 10)
 		{
-			LLOGLN(10, ("transport_read: not enough for header"));
+			LLOGLN(10, ("transport_read_tsg: not enough for header"));
 			return transport_status;
 		}
 
 		stream_bytes += status;
 	}
 
-	pdu_bytes = 0;
+	pdu_bytes = s->data[8];
+	pdu_bytes |= s->data[9] << 8;
 
-	if (transport->layer == TRANSPORT_LAYER_TSG)
-	{
-		pdu_bytes = s->data[8];
-		pdu_bytes |= s->data[9] << 8;
-	}
-	else
-	{
-		/* if header is present, read in exactly one PDU */
-		if (s->data[0] == 0x03)
-		{
-			/* TPKT header */
-			pdu_bytes = (s->data[2] << 8) | s->data[3];
-		}
-		else if (s->data[0] == 0x30)
-		{
-			/* TSRequest (NLA) */
-			if (s->data[1] & 0x80)
-			{
-				if ((s->data[1] & ~(0x80)) == 1)
-				{
-					pdu_bytes = s->data[2];
-					pdu_bytes += 3;
-				}
-				else if ((s->data[1] & ~(0x80)) == 2)
-				{
-					pdu_bytes = (s->data[2] << 8) | s->data[3];
-					pdu_bytes += 4;
-				}
-				else
-				{
-					printf("Error reading TSRequest!\n");
-				}
-			}
-			else
-			{
-				pdu_bytes = s->data[1];
-				pdu_bytes += 2;
-			}
-		}
-		else
-		{
-			/* Fast-Path Header */
-			if (s->data[1] & 0x80)
-				pdu_bytes = ((s->data[1] & 0x7f) << 8) | s->data[2];
-			else
-				pdu_bytes = s->data[1];
-		}
-	}
-
-	LLOGLN(10, ("transport_read: transport_read_layer 2nd call"));
+	LLOGLN(10, ("transport_read_tsg: transport_read_layer 2nd call"));
 	status = transport_read_layer(transport, s->data + stream_bytes,
 			pdu_bytes - stream_bytes);
 
@@ -434,27 +391,247 @@ int transport_read(rdpTransport* transport, STREAM* s)
 	}
 #endif
 
-#if 1
-	if (transport->blocking)
+	if (transport->blocking && got_whole_pdu)
 	{
-		if ((transport->layer == TRANSPORT_LAYER_TSG) && got_whole_pdu)
+		LLOGLN(10, ("transport_read_tsg: calling tsg_skip_pdu"));
+		s->p = s->data;
+		if (tsg_skip_pdu(transport->tsg, s))
 		{
-			//uint8* jj = s->p; // why don't work
-			LLOGLN(10, ("transport_read: calling tsg_skip_pdu"));
+			LLOGLN(10, ("transport_read_tsg: skipping"));
 			s->p = s->data;
-			if (tsg_skip_pdu(transport->tsg, s))
+			return transport_read_tsg(transport, s);
+		}
+	}
+
+	LLOGLN(10, ("transport_read_tsg: returning %d", transport_status));
+	return transport_status;
+}
+
+/**
+ * Read as much as the connection has into the ring, without blocking on a
+ * non-blocking socket. Returns the number of bytes read, or -1 on error.
+ */
+static int transport_read_ring(rdpTransport* transport)
+{
+	int status;
+	int length;
+	int offset;
+	int total;
+
+	total = 0;
+
+	while (transport->ring_write - transport->ring_read < TRANSPORT_RING_SIZE)
+	{
+		offset = transport->ring_write & TRANSPORT_RING_MASK;
+		length = MIN(TRANSPORT_RING_SIZE - offset,
+			TRANSPORT_RING_SIZE - (int) (transport->ring_write - transport->ring_read));
+
+		switch (transport->layer)
+		{
+			case TRANSPORT_LAYER_TLS:
+				status = tls_read(transport->tls_in, transport->ring + offset, length);
+				break;
+			case TRANSPORT_LAYER_TCP:
+				status = tcp_read(transport->tcp_in, transport->ring + offset, length);
+				break;
+			default:
+				LLOGLN(0, ("transport_read_ring: unknown layer %d", transport->layer));
+				status = -1;
+				break;
+		}
+
+		/* what was read before the error is still dispatched, the next read fails again */
+		if (status < 0)
+			return (total > 0) ? total : status;
+
+		transport->ring_write += status;
+		total += status;
+
+		/**
+		 * A short recv() drained the socket. SSL_read() returns one record at
+		 * a time, so TLS keeps reading until it would block, or the records
+		 * left in the SSL buffers would not wake up select() again.
+		 */
+		if (status == 0)
+			break;
+
+		if (status < length && (transport->layer == TRANSPORT_LAYER_TCP || transport->blocking))
+			break;
+	}
+
+	return total;
+}
+
+/**
+ * Length of the PDU starting with the bytes bytes of header, 0 if more
+ * bytes are needed to tell, or -1 if this is not the start of a PDU.
+ */
+static int transport_pdu_length(uint8* header, int bytes, tbool tsrequest)
+{
+	int length;
+	int header_bytes;
+
+	if (bytes < 2)
+		return 0;
+
+	if (header[0] == 0x03)
+	{
+		/* TPKT header */
+		if (bytes < 4)
+			return 0;
+
+		length = (header[2] << 8) | header[3];
+		header_bytes = 4;
+	}
+	else if (header[0] == 0x30 && tsrequest)
+	{
+		/* TSRequest (NLA) */
+		if (header[1] & 0x80)
+		{
+			header_bytes = 2 + (header[1] & 0x7F);
+
+			if (header_bytes != 3 && header_bytes != 4)
 			{
-				LLOGLN(10, ("transport_read: skipping"));
-				s->p = s->data;
-				return transport_read(transport, s);
+				printf("Error reading TSRequest!\n");
+				return -1;
 			}
-			//s->p = jj;
+
+			if (bytes < header_bytes)
+				return 0;
+
+			if (header_bytes == 3)
+				length = header[2] + 3;
+			else
+				length = ((header[2] << 8) | header[3]) + 4;
+		}
+		else
+		{
+			length = header[1] + 2;
+			header_bytes = 2;
+		}
+	}
+	else
+	{
+		/* Fast-Path Header */
+		if (header[1] & 0x80)
+		{
+			if (bytes < 3)
+				return 0;
+
+			length = ((header[1] & 0x7F) << 8) | header[2];
+			header_bytes = 3;
+		}
+		else
+		{
+			length = header[1];
+			header_bytes = 2;
 		}
 	}
+
+	return (length < header_bytes) ? -1 : length;
+}
+
+/**
+ * Length of the whole PDU at the read position of the ring, 0 if it is
+ * not all in yet, or -1 if there is no PDU header there.
+ */
+static int transport_ring_pdu_length(rdpTransport* transport, tbool tsrequest)
+{
+	int i;
+	int bytes;
+	int length;
+	uint8 header[4];
+
+	bytes = MIN((int) (transport->ring_write - transport->ring_read), 4);
+
+	for (i = 0; i < bytes; i++)
+		header[i] = transport->ring[(transport->ring_read + i) & TRANSPORT_RING_MASK];
+
+	length = transport_pdu_length(header, bytes, tsrequest);
+
+	if (length > (int) (transport->ring_write - transport->ring_read))
+		return 0;
+
+	return length;
+}
+
+/**
+ * The PDU at the read position of the ring as contiguous bytes. A PDU that
+ * wraps around the end of the ring is copied into recv_buffer.
+ */
+static uint8* transport_ring_pdu(rdpTransport* transport, int length)
+{
+	int first;
+	int offset;
+	STREAM* s;
+
+	offset = transport->ring_read & TRANSPORT_RING_MASK;
+
+	if (offset + length <= TRANSPORT_RING_SIZE)
+		return transport->ring + offset;
+
+	s = transport->recv_buffer;
+	stream_set_pos(s, 0);
+	stream_check_size(s, length);
+
+	first = TRANSPORT_RING_SIZE - offset;
+	memcpy(s->data, transport->ring + offset, first);
+	memcpy(s->data + first, transport->ring, length - first);
+
+	return s->data;
+}
+
+/**
+ * Read one whole PDU into s, at its current position. Returns the length
+ * of the PDU, 0 if the transport is non-blocking and no whole PDU is in
+ * yet, or -1 on error.
+ */
+int transport_read(rdpTransport* transport, STREAM* s)
+{
+	int status;
+	int length;
+
+	if (transport->layer == TRANSPORT_LAYER_TSG)
+		return transport_read_tsg(transport, s);
+
+	LLOGLN(10, ("transport_read: blocking %d", transport->blocking));
+
+	while ((length = transport_ring_pdu_length(transport, true)) == 0)
+	{
+		status = transport_read_ring(transport);
+
+		if (status < 0)
+		{
+			LLOGLN(0, ("transport_read: transport_read_ring failed"));
+			return status;
+		}
+
+		if (status == 0)
+		{
+			if (transport->blocking == false)
+				return 0;
+
+			tcp_can_recv(transport->tcp_in->sockfd, 100);
+		}
+	}
+
+	if (length < 0)
+	{
+		printf("transport_read: protocol error, not a TPKT or Fast Path header.\n");
+		return -1;
+	}
+
+	stream_check_size(s, length);
+	memcpy(s->p, transport_ring_pdu(transport, length), length);
+	transport->ring_read += length;
+
+#ifdef WITH_DEBUG_TRANSPORT
+	printf("Local < Remote\n");
+	freerdp_hexdump(s->p, length);
 #endif
 
-	LLOGLN(10, ("transport_read: returning %d", transport_status));
-	return transport_status;
+	LLOGLN(10, ("transport_read: returning %d", length));
+	return length;
 }
 
 static int transport_read_nonblocking(rdpTransport* transport)
@@ -462,7 +639,7 @@ static int transport_read_nonblocking(rdpTransport* transport)
 	int status;
 
 	stream_check_size(transport->recv_buffer, 32 * 1024);
-	status = transport_read(transport, transport->recv_buffer);
+	status = transport_read_tsg(transport, transport->recv_buffer);
 	if (status <= 0)
 	{
 		/* error or blocking */
@@ -472,62 +649,253 @@ static int transport_read_nonblocking(rdpTransport* transport)
 	return status;
 }
 
-int transport_write(rdpTransport* transport, STREAM* s)
+static int transport_write_tsg(rdpTransport* transport, uint8* data, int length)
 {
 	int status = -1;
-	int length;
 
-	LLOGLN(10, ("transport_write:"));
+	while (length > 0)
+	{
+		status = tsg_write(transport->tsg, data, length);
 
-	length = stream_get_length(s);
-	stream_set_pos(s, 0);
+		if (status < 0)
+			break; /* error occurred */
 
-#ifdef WITH_DEBUG_TRANSPORT
-	if (length > 0)
-	{
-		printf("Local > Remote\n");
-		freerdp_hexdump(s->data, length);
+		if (status == 0)
+		{
+			/* blocking while sending */
+			freerdp_usleep(transport->usleep_interval);
+		}
+
+		length -= status;
+		data += status;
 	}
-#endif
 
-	while (length > 0)
+	return status;
+}
+
+/**
+ * Write the output queue and then length bytes of data, as far as the
+ * connection takes them without blocking. TCP sends both with one system
+ * call. Returns how much of data was written, or -1 on error.
+ */
+static int transport_write_queue(rdpTransport* transport, uint8* data, int length)
+{
+	int sent;
+	int queued;
+	int status;
+	uint8* buffers[2];
+	int lengths[2];
+
+	sent = 0;
+	status = 0;
+
+	while (true)
 	{
+		queued = transport->out_tail - transport->out_head;
+
+		if (queued == 0 && sent == length)
+			break;
+
+		buffers[0] = transport->out_buffer + transport->out_head;
+		lengths[0] = queued;
+		buffers[1] = data + sent;
+		lengths[1] = length - sent;
+
 		switch (transport->layer)
 		{
-			case TRANSPORT_LAYER_TLS:
-				status = tls_write(transport->tls_in, stream_get_tail(s), length);
-				break;
 			case TRANSPORT_LAYER_TCP:
-				status = tcp_write(transport->tcp_in, stream_get_tail(s), length);
+				status = tcp_write_gather(transport->tcp_in, buffers, lengths, 2);
 				break;
-			case TRANSPORT_LAYER_TSG:
-				status = tsg_write(transport->tsg, stream_get_tail(s), length);
+			case TRANSPORT_LAYER_TLS:
+				/* a write that would block is retried with the queued copy, see tls_connect() */
+				if (queued > 0)
+					status = tls_write(transport->tls_in, buffers[0], lengths[0]);
+				else
+					status = tls_write(transport->tls_in, buffers[1], lengths[1]);
 				break;
 			default:
-				LLOGLN(0, ("transport_write: unknown transport->layer %d", transport->layer));
+				LLOGLN(0, ("transport_write_queue: unknown transport->layer %d", transport->layer));
+				status = -1;
 				break;
 		}
 
-		if (status < 0)
-			break; /* error occurred */
+		if (status <= 0)
+			break;
 
-		if (status == 0)
+		if (status <= queued)
 		{
-			/* blocking while sending */
-			freerdp_usleep(transport->usleep_interval);
+			transport->out_head += status;
+		}
+		else
+		{
+			transport->out_head = transport->out_tail;
+			sent += status - queued;
 		}
+	}
 
-		length -= status;
-		stream_seek(s, status);
+	if (transport->out_head == transport->out_tail)
+	{
+		transport->out_head = 0;
+		transport->out_tail = 0;
+	}
+
+	if (status < 0)
+		return status;
+
+	return sent;
+}
+
+static boolean transport_queue(rdpTransport* transport, uint8* data, int length)
+{
+	int queued;
+
+	if (length <= 0)
+		return true;
+
+	queued = transport->out_tail - transport->out_head;
+
+	/* a client this far behind is not going to catch up */
+	if (queued + length > TRANSPORT_MAX_QUEUED)
+		return false;
+
+	if (transport->out_tail + length > transport->out_size)
+	{
+		if (transport->out_head > 0)
+		{
+			memmove(transport->out_buffer, transport->out_buffer + transport->out_head, queued);
+			transport->out_head = 0;
+			transport->out_tail = queued;
+		}
+
+		if (queued + length > transport->out_size)
+		{
+			transport->out_size = MAX(transport->out_size * 2, queued + length);
+			transport->out_buffer = (uint8*) xrealloc(transport->out_buffer, transport->out_size);
+		}
+	}
+
+	memcpy(transport->out_buffer + transport->out_tail, data, length);
+	transport->out_tail += length;
+
+	return true;
+}
+
+/**
+ * Write as much of the output queue as the connection takes. A blocking
+ * transport waits until all of it is written. Returns the number of bytes
+ * still queued, or -1 on error.
+ */
+int transport_flush(rdpTransport* transport)
+{
+	int status;
+
+	if (transport->out_cork > 0)
+		return transport->out_tail - transport->out_head;
+
+	while (true)
+	{
+		if (transport->out_tail == transport->out_head)
+			return 0;
+
+		status = transport_write_queue(transport, NULL, 0);
+
+		if (status < 0)
+		{
+			/* A write error indicates that the peer has dropped the connection */
+			transport->layer = TRANSPORT_LAYER_CLOSED;
+			return -1;
+		}
+
+		if (transport->blocking == false || transport->out_tail == transport->out_head)
+			break;
+
+		tcp_can_send(transport->tcp_in->sockfd, 100);
+	}
+
+	return transport->out_tail - transport->out_head;
+}
+
+/**
+ * Send a PDU. What the connection does not take right away is queued and
+ * written by transport_flush(), which transport_check_fds() calls. A
+ * blocking transport flushes before returning. Returns the length of the
+ * PDU, or -1 on error, which includes the queue growing past
+ * TRANSPORT_MAX_QUEUED.
+ */
+int transport_write(rdpTransport* transport, STREAM* s)
+{
+	int status;
+	int length;
+	uint8* data;
+
+	LLOGLN(10, ("transport_write:"));
+
+	length = stream_get_length(s);
+	data = stream_get_head(s);
+	stream_set_pos(s, length);
+
+#ifdef WITH_DEBUG_TRANSPORT
+	if (length > 0)
+	{
+		printf("Local > Remote\n");
+		freerdp_hexdump(data, length);
+	}
+#endif
+
+	if (transport->layer == TRANSPORT_LAYER_TSG)
+	{
+		status = transport_write_tsg(transport, data, length);
+	}
+	else
+	{
+		status = 0;
+
+		if (transport->out_cork == 0)
+			status = transport_write_queue(transport, data, length);
+
+		if (status >= 0)
+		{
+			if (transport_queue(transport, data + status, length - status))
+				status = transport_flush(transport);
+			else
+				status = -1;
+		}
 	}
 
 	if (status < 0)
 	{
 		/* A write error indicates that the peer has dropped the connection */
 		transport->layer = TRANSPORT_LAYER_CLOSED;
+		return -1;
 	}
 
-	return status;
+	return length;
+}
+
+/**
+ * Queue the PDUs written until the matching transport_uncork(), and
+ * send them together then.
+ */
+void transport_cork(rdpTransport* transport)
+{
+	transport->out_cork++;
+}
+
+int transport_uncork(rdpTransport* transport)
+{
+	if (transport->out_cork > 0)
+		transport->out_cork--;
+
+	return transport_flush(transport);
+}
+
+/**
+ * Bytes written but not sent yet. A server can skip or merge frames
+ * while this is large, instead of queueing more.
+ */
+uint32 transport_get_queued_bytes(rdpTransport* transport)
+{
+	return transport->out_tail - transport->out_head;
 }
 
 void transport_get_fds(rdpTransport* transport, void** rfds, int* rcount)
@@ -547,6 +915,18 @@ void transport_get_fds(rdpTransport* transport, void** rfds, int* rcount)
 	}
 }
 
+/**
+ * The socket to wait on for writing, while the output queue is not empty.
+ */
+void transport_get_write_fds(rdpTransport* transport, void** wfds, int* wcount)
+{
+	if (transport->out_tail == transport->out_head)
+		return;
+
+	wfds[*wcount] = (void*)(long)(transport->tcp_in->sockfd);
+	(*wcount)++;
+}
+
 int get_rdp_pdu_length(uint8* data)
 {
 	int pdu_bytes;
@@ -586,14 +966,13 @@ static int do_callback(rdpTransport* transport, STREAM* s)
 	return rv;
 }
 
-int transport_check_fds(rdpTransport* transport)
+static int transport_check_fds_tsg(rdpTransport* transport)
 {
 	int pos;
 	int status;
 	int rdp_pdu_length;
 	int extra_bytes;
 	uint16 length;
-	STREAM* proc_s;
 	STREAM* s;
 
 	int ptype;
@@ -604,162 +983,178 @@ int transport_check_fds(rdpTransport* transport)
 	int alloc_hint;
 	int auth_pad_length;
 
-	LLOGLN(10, ("transport_check_fds:"));
-
-	/* test for nested calls */
-	if (transport->level != 0)
-	{
-		LLOGLN(0, ("transport_check_fds: error, nested calls"));
-		return -1;
-	}
-
 	status = transport_read_nonblocking(transport);
 
 	if (status < 0)
 	{
-		LLOGLN(0, ("transport_check_fds: transport_read_nonblocking failed"));
+		LLOGLN(0, ("transport_check_fds_tsg: transport_read_nonblocking failed"));
 		return status;
 	}
 
 	pos = stream_get_pos(transport->recv_buffer);
-	if (pos > 0)
+
+	if (pos <= 10)
+		return 0;
+
+	stream_set_pos(transport->recv_buffer, 8);
+	stream_read_uint16(transport->recv_buffer, length);
+	stream_set_pos(transport->recv_buffer, 0);
+	LLOGLN(10, ("transport_check_fds_tsg: got header tsg packet length %d", length));
+	LLOGLN(10, ("transport_check_fds_tsg: dumping 1st 10 bytes of HTTP data"));
+	LHEXDUMP(10, (transport->recv_buffer->data, 10));
+
+	if (length == 0)
+	{
+		printf("transport_check_fds: protocol error, not a TSG header.\n");
+		freerdp_hexdump(stream_get_head(transport->recv_buffer), pos);
+		return -1;
+	}
+
+	if (pos < length)
+	{
+		stream_set_pos(transport->recv_buffer, pos);
+		return 0; /* Packet is not yet completely received. */
+	}
+
+	/* whole PDU is read in, for tsg, this is just the fragment */
+	LLOGLN(10, ("transport_check_fds_tsg: got whole transport pdu"));
+
+	if (tsg_skip_pdu(transport->tsg, transport->recv_buffer))
 	{
+		LLOGLN(10, ("transport_check_fds_tsg: tsg_skip_pdu returned true"));
 		stream_set_pos(transport->recv_buffer, 0);
-		if (transport->layer == TRANSPORT_LAYER_TSG)
-		{
-			if (pos <= 10)
-			{
-				stream_set_pos(transport->recv_buffer, pos);
-				return 0;
-			}
-			stream_set_pos(transport->recv_buffer, 8);
-			stream_read_uint16(transport->recv_buffer, length);
-			stream_set_pos(transport->recv_buffer, 0);
-			LLOGLN(10, ("transport_check_fds: got header tsg packet length %d", length));
-			LLOGLN(10, ("transport_check_fds: dumping 1st 10 bytes of HTTP data"));
-			LHEXDUMP(10, (transport->recv_buffer->data, 10));
-		}
-		else
+		return 0;
+	}
+
+	stream_set_pos(transport->recv_buffer, 0);
+	stream_seek(transport->recv_buffer, 2);
+	stream_read_uint8(transport->recv_buffer, ptype);
+	stream_read_uint8(transport->recv_buffer, pfc_flags);
+	stream_seek(transport->recv_buffer, 4);
+	stream_read_uint16(transport->recv_buffer, frag_length);
+	stream_read_uint16(transport->recv_buffer, auth_length);
+	stream_read_uint32(transport->recv_buffer, call_id);
+	stream_read_uint32(transport->recv_buffer, alloc_hint);
+	auth_pad_length = transport->recv_buffer->data[frag_length - auth_length - 6];
+	length = frag_length - auth_length - 24 - 8 - auth_pad_length;
+
+	LLOGLN(10, ("transport_check_fds_tsg: ptype %d pfc_flags %d "
+			"frag_length %d auth_length %d call_id %d alloc_hint %d auth_pad_length %d length %d",
+			ptype, pfc_flags, frag_length, auth_length, call_id, alloc_hint, auth_pad_length, length));
+
+	s = transport->proc_buffer;
+	memcpy(s->p, transport->recv_buffer->data + 24, length);
+	stream_seek(s, length);
+
+	while (true) /* can be more than one RDP PDU in one TSG PDU */
+	{
+		pos = stream_get_pos(s);
+		if (pos > 3)
 		{
-			/* Ensure header is available. */
-			if (pos <= 4)
+			rdp_pdu_length = get_rdp_pdu_length(s->data);
+			LLOGLN(10, ("transport_check_fds_tsg: rdp_pdu_length %d pos %d", rdp_pdu_length, pos));
+			if (pos >= rdp_pdu_length)
 			{
-				stream_set_pos(transport->recv_buffer, pos);
-				return 0;
-			}
-			if (tpkt_verify_header(transport->recv_buffer)) /* TPKT */
-			{
-				length = tpkt_read_header(transport->recv_buffer);
-			}
-			else /* Fast Path */
-			{
-				length = fastpath_read_header(NULL, transport->recv_buffer);
+				LLOGLN(10, ("transport_check_fds_tsg: got whole rdp pdu"));
+				stream_set_pos(s, rdp_pdu_length);
+				stream_seal(s);
+				stream_set_pos(s, 0);
+				if (do_callback(transport, s) != 0)
+				{
+					LLOGLN(0, ("transport_check_fds_tsg: do_callback failed"));
+					return -1;
+				}
+				stream_set_pos(s, 0);
+				extra_bytes = pos - rdp_pdu_length;
+				LLOGLN(10, ("transport_check_fds_tsg: extra_bytes %d", extra_bytes));
+				LHEXDUMP(10, (s->data + rdp_pdu_length - extra_bytes, extra_bytes));
+				memmove(s->p, s->data + rdp_pdu_length, extra_bytes);
+				stream_seek(s, extra_bytes);
+				continue;
 			}
 		}
+		break;
+	}
 
-		if (length == 0)
-		{
-			printf("transport_check_fds: protocol error, not a TPKT or Fast Path header.\n");
-			freerdp_hexdump(stream_get_head(transport->recv_buffer), pos);
-			return -1;
-		}
+	stream_set_pos(transport->recv_buffer, 0);
 
-		if (pos < length)
-		{
-			stream_set_pos(transport->recv_buffer, pos);
-			return 0; /* Packet is not yet completely received. */
-		}
+	return 0;
+}
+
+/**
+ * Read everything the connection has and hand every whole PDU in the ring
+ * to recv_callback, as a stream over the ring memory. A partial PDU stays
+ * where it is until the rest of it comes in.
+ */
+int transport_check_fds(rdpTransport* transport)
+{
+	int status;
+	int length;
+	tbool full;
+	STREAM* s;
 
-		/* whole PDU is read in, for tsg, this is just the fragment */
-		LLOGLN(10, ("transport_check_fds: got whole transport pdu"));
+	LLOGLN(10, ("transport_check_fds:"));
 
-		proc_s = NULL;
-		if (transport->layer == TRANSPORT_LAYER_TSG)
-		{
+	/* test for nested calls */
+	if (transport->level != 0)
+	{
+		LLOGLN(0, ("transport_check_fds: error, nested calls"));
+		return -1;
+	}
 
-			stream_set_pos(transport->recv_buffer, 0);
-			if (tsg_skip_pdu(transport->tsg, transport->recv_buffer))
-			{
-				LLOGLN(10, ("transport_check_fds: tsg_skip_pdu returned true"));
-				stream_set_pos(transport->recv_buffer, 0);
-				return 0;
-			}
+	if (transport->layer == TRANSPORT_LAYER_TSG)
+		return transport_check_fds_tsg(transport);
 
-			stream_set_pos(transport->recv_buffer, 0);
-			stream_seek(transport->recv_buffer, 2);
-			stream_read_uint8(transport->recv_buffer, ptype);
-			stream_read_uint8(transport->recv_buffer, pfc_flags);
-			stream_seek(transport->recv_buffer, 4);
-			stream_read_uint16(transport->recv_buffer, frag_length);
-			stream_read_uint16(transport->recv_buffer, auth_length);
-			stream_read_uint32(transport->recv_buffer, call_id);
-			stream_read_uint32(transport->recv_buffer, alloc_hint);
-			auth_pad_length = transport->recv_buffer->data[frag_length - auth_length - 6];
-			length = frag_length - auth_length - 24 - 8 - auth_pad_length;
-
-			LLOGLN(10, ("transport_check_fds: ptype %d pfc_flags %d "
-					"frag_length %d auth_length %d call_id %d alloc_hint %d auth_pad_length %d length %d",
-					ptype, pfc_flags, frag_length, auth_length, call_id, alloc_hint, auth_pad_length, length));
-
-			s = transport->proc_buffer;
-			memcpy(s->p, transport->recv_buffer->data + 24, length);
-			stream_seek(s, length);
-
-			while (true) /* can be more than one RDP PDU in one TSG PDU */
-			{
-				pos = stream_get_pos(s);
-				if (pos > 3)
-				{
-					rdp_pdu_length = get_rdp_pdu_length(s->data);
-					LLOGLN(10, ("transport_check_fds: rdp_pdu_length %d pos %d", rdp_pdu_length, pos));
-					if (pos >= rdp_pdu_length)
-					{
-						LLOGLN(10, ("transport_check_fds: got whole rdp pdu"));
-						stream_set_pos(s, rdp_pdu_length);
-						stream_seal(s);
-						stream_set_pos(s, 0);
-						if (do_callback(transport, s) != 0)
-						{
-							LLOGLN(0, ("transport_check_fds: do_callback failed"));
-							return -1;
-						}
-						stream_set_pos(s, 0);
-						extra_bytes = pos - rdp_pdu_length;
-						LLOGLN(10, ("transport_check_fds: extra_bytes %d", extra_bytes));
-						LHEXDUMP(10, (s->data + rdp_pdu_length - extra_bytes, extra_bytes));
-						memmove(s->p, s->data + rdp_pdu_length, extra_bytes);
-						stream_seek(s, extra_bytes);
-						continue;
-					}
-				}
-				break;
-			}
-		}
-		else
+	/* the socket may have woken up for writing */
+	if (transport_flush(transport) < 0)
+	{
+		LLOGLN(0, ("transport_check_fds: transport_flush failed"));
+		return -1;
+	}
+
+	s = transport->ring_stream;
+
+	do
+	{
+		status = transport_read_ring(transport);
+
+		if (status < 0)
 		{
-			proc_s = transport->recv_buffer;
-			stream_set_pos(transport->recv_buffer, length);
-			stream_seal(transport->recv_buffer);
-			stream_set_pos(transport->recv_buffer, 0);
+			LLOGLN(0, ("transport_check_fds: transport_read_ring failed"));
+			return status;
 		}
 
-		if (proc_s != NULL)
+		/* the ring is larger than any PDU, a full ring holds at least one */
+		full = (transport->ring_write - transport->ring_read == TRANSPORT_RING_SIZE);
+
+		while ((length = transport_ring_pdu_length(transport, false)) > 0)
 		{
-			if (do_callback(transport, proc_s) != 0)
+			stream_attach(s, transport_ring_pdu(transport, length), length);
+
+#ifdef WITH_DEBUG_TRANSPORT
+			printf("Local < Remote\n");
+			freerdp_hexdump(s->data, length);
+#endif
+
+			status = do_callback(transport, s);
+			stream_detach(s);
+
+			if (status != 0)
 			{
 				LLOGLN(0, ("transport_check_fds: do_callback failed"));
 				return -1;
 			}
-		}
 
-		stream_set_pos(transport->recv_buffer, 0);
+			transport->ring_read += length;
+		}
 
-		if (status < 0)
+		if (length < 0)
 		{
-			LLOGLN(0, ("transport_check_fds: failed"));
-			return status;
+			printf("transport_check_fds: protocol error, not a TPKT or Fast Path header.\n");
+			return -1;
 		}
 	}
+	while (full);
 
 	return 0;
 }
@@ -792,6 +1187,14 @@ rdpTransport* transport_new(rdpSettings* settings)
 		/* for tsg fragmenting */
 		transport->proc_buffer = stream_new(BUFFER_SIZE);
 
+		/* receive ring, and the stream PDUs are handed out in */
+		transport->ring = (uint8*) xmalloc(TRANSPORT_RING_SIZE);
+		transport->ring_stream = xnew(STREAM);
+
+		/* output queue, grows while the connection does not keep up */
+		transport->out_size = BUFFER_SIZE;
+		transport->out_buffer = (uint8*) xmalloc(transport->out_size);
+
 		/* buffers for blocking read/write */
 		transport->recv_stream = stream_new(BUFFER_SIZE);
 		transport->send_stream = stream_new(BUFFER_SIZE);
@@ -812,6 +1215,9 @@ void transport_free(rdpTransport* transport)
 		stream_free(transport->recv_stream);
 		stream_free(transport->send_stream);
 		stream_free(transport->proc_buffer);
+		xfree(transport->out_buffer);
+		xfree(transport->ring);
+		xfree(transport->ring_stream);
 		if (transport->tls_in)
 		{
 			tls_free(transport->tls_in);
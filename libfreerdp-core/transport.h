@@ -41,6 +41,9 @@ typedef struct rdp_transport rdpTransport;
 #include <freerdp/utils/stream.h>
 #include <freerdp/utils/wait_obj.h>
 
+/* output queue limit, a write that would queue more fails */
+#define TRANSPORT_MAX_QUEUED 0x2000000
+
 typedef boolean (*TransportRecv) (rdpTransport* transport, STREAM* stream, void* extra);
 
 struct rdp_transport
@@ -63,6 +66,15 @@ struct rdp_transport
 	int level;
 	STREAM* proc_buffer;
 	int tsg_frag_state;
+	uint8* ring;
+	uint32 ring_read;
+	uint32 ring_write;
+	STREAM* ring_stream;
+	uint8* out_buffer;
+	int out_size;
+	int out_head;
+	int out_tail;
+	int out_cork;
 };
 
 STREAM* transport_recv_stream_init(rdpTransport* transport, int size);
@@ -78,7 +90,12 @@ boolean transport_accept_tls(rdpTransport* transport);
 boolean transport_accept_nla(rdpTransport* transport);
 int transport_read(rdpTransport* transport, STREAM* s);
 int transport_write(rdpTransport* transport, STREAM* s);
+int transport_flush(rdpTransport* transport);
+void transport_cork(rdpTransport* transport);
+int transport_uncork(rdpTransport* transport);
+uint32 transport_get_queued_bytes(rdpTransport* transport);
 void transport_get_fds(rdpTransport* transport, void** rfds, int* rcount);
+void transport_get_write_fds(rdpTransport* transport, void** wfds, int* wcount);
 int transport_check_fds(rdpTransport* transport);
 boolean transport_set_blocking_mode(rdpTransport* transport, boolean blocking);
 rdpTransport* transport_new(rdpSettings* settings);
@@ -52,38 +52,38 @@ p_BitBlt BitBlt_[5] =
 INLINE GDI_COLOR gdi_GetPixel(HGDI_DC hdc, int nXPos, int nYPos)
 {
 	HGDI_BITMAP hBmp = (HGDI_BITMAP) hdc->selectedObject;
-	GDI_COLOR* colorp = (GDI_COLOR*)&(hBmp->data[(nYPos * hBmp->width * hdc->bytesPerPixel) + nXPos * hdc->bytesPerPixel]);
+	GDI_COLOR* colorp = (GDI_COLOR*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, nYPos, hdc->bytesPerPixel) + nXPos * hdc->bytesPerPixel]);
 	return (GDI_COLOR) *colorp;
 }
 
 INLINE uint8 gdi_GetPixel_8bpp(HGDI_BITMAP hBmp, int X, int Y)
 {
-	return *((uint8*)&(hBmp->data[(Y * hBmp->width) + X]));
+	return *((uint8*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 1) + X]));
 }
 
 INLINE uint16 gdi_GetPixel_16bpp(HGDI_BITMAP hBmp, int X, int Y)
 {
-	return *((uint16*)&(hBmp->data[(Y * hBmp->width * 2) + X * 2]));
+	return *((uint16*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 2) + X * 2]));
 }
 
 INLINE uint32 gdi_GetPixel_32bpp(HGDI_BITMAP hBmp, int X, int Y)
 {
-	return *((uint32*)&(hBmp->data[(Y * hBmp->width * 4) + X * 4]));
+	return *((uint32*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 4) + X * 4]));
 }
 
 INLINE uint8* gdi_GetPointer_8bpp(HGDI_BITMAP hBmp, int X, int Y)
 {
-	return ((uint8*)&(hBmp->data[(Y * hBmp->width) + X]));
+	return ((uint8*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 1) + X]));
 }
 
 INLINE uint16* gdi_GetPointer_16bpp(HGDI_BITMAP hBmp, int X, int Y)
 {
-	return ((uint16*)&(hBmp->data[(Y * hBmp->width * 2) + X * 2]));
+	return ((uint16*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 2) + X * 2]));
 }
 
 INLINE uint32* gdi_GetPointer_32bpp(HGDI_BITMAP hBmp, int X, int Y)
 {
-	return ((uint32*)&(hBmp->data[(Y * hBmp->width * 4) + X * 4]));
+	return ((uint32*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 4) + X * 4]));
 }
 
 /**
@@ -99,23 +99,23 @@ INLINE uint32* gdi_GetPointer_32bpp(HGDI_BITMAP hBmp, int X, int Y)
 INLINE GDI_COLOR gdi_SetPixel(HGDI_DC hdc, int X, int Y, GDI_COLOR crColor)
 {
 	HGDI_BITMAP hBmp = (HGDI_BITMAP) hdc->selectedObject;
-	*((GDI_COLOR*)&(hBmp->data[(Y * hBmp->width * hdc->bytesPerPixel) + X * hdc->bytesPerPixel])) = crColor;
+	*((GDI_COLOR*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, hdc->bytesPerPixel) + X * hdc->bytesPerPixel])) = crColor;
 	return 0;
 }
 
 INLINE void gdi_SetPixel_8bpp(HGDI_BITMAP hBmp, int X, int Y, uint8 pixel)
 {
-	*((uint8*)&(hBmp->data[(Y * hBmp->width) + X])) = pixel;
+	*((uint8*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 1) + X])) = pixel;
 }
 
 INLINE void gdi_SetPixel_16bpp(HGDI_BITMAP hBmp, int X, int Y, uint16 pixel)
 {
-	*((uint16*)&(hBmp->data[(Y * hBmp->width * 2) + X * 2])) = pixel;
+	*((uint16*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 2) + X * 2])) = pixel;
 }
 
 INLINE void gdi_SetPixel_32bpp(HGDI_BITMAP hBmp, int X, int Y, uint32 pixel)
 {
-	*((uint32*)&(hBmp->data[(Y * hBmp->width * 4) + X * 4])) = pixel;
+	*((uint32*)&(hBmp->data[GDI_BITMAP_ROW_OFFSET(hBmp, Y, 4) + X * 4])) = pixel;
 }
 
 /**
@@ -320,7 +320,7 @@ INLINE uint8* gdi_get_bitmap_pointer(HGDI_DC hdcBmp, int x, int y)
 
 	if (x >= 0 && x < hBmp->width && y >= 0 && y < hBmp->height)
 	{
-		p = hBmp->data + (y * hBmp->width * hdcBmp->bytesPerPixel) + (x * hdcBmp->bytesPerPixel);
+		p = hBmp->data + GDI_BITMAP_ROW_OFFSET(hBmp, y, hdcBmp->bytesPerPixel) + (x * hdcBmp->bytesPerPixel);
 		return p;
 	}
 	else
@@ -633,10 +633,35 @@ void gdi_mem3blt(rdpContext* context, MEM3BLT_ORDER* mem3blt)
 
 int tilenum = 0;
 
+/**
+ * BitBlt a bottom-up 32 bpp surface bits image straight out of data, where
+ * its rows are stored bottom row first. gdi->image is pointed at the top
+ * row with a negative scanline for the duration of the copy.
+ */
+static void gdi_surface_bits_blt_bottom_up(rdpGdi* gdi, SURFACE_BITS_COMMAND* surface_bits_command, uint8* data)
+{
+	uint8* buffer;
+	int scanline;
+	HGDI_BITMAP bitmap = gdi->image->bitmap;
+
+	buffer = bitmap->data;
+	scanline = bitmap->scanline;
+
+	bitmap->data = data + (surface_bits_command->height - 1) * surface_bits_command->width * 4;
+	bitmap->scanline = -surface_bits_command->width * 4;
+
+	gdi_BitBlt(gdi->primary->hdc, surface_bits_command->destLeft, surface_bits_command->destTop,
+			surface_bits_command->width, surface_bits_command->height, gdi->image->hdc, 0, 0, GDI_SRCCOPY);
+
+	bitmap->data = buffer;
+	bitmap->scanline = scanline;
+}
+
 void gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits_command)
 {
 	int i, j;
 	int tx, ty;
+	int tw, th;
 	char* tile_bitmap;
 	RFX_MESSAGE* message;
 	rdpGdi* gdi = context->gdi;
@@ -653,7 +678,31 @@ void gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits_co
 
 	tile_bitmap = (char*) xzalloc(32);
 
-	if (surface_bits_command->codecID == CODEC_ID_REMOTEFX)
+	if (surface_bits_command->codecID == CODEC_ID_REMOTEFX && gdi->dstBpp == 32)
+	{
+		/* decode straight into the primary surface, which is already BGRA */
+		message = rfx_process_message_to_surface(rfx_context,
+				surface_bits_command->bitmapData, surface_bits_command->bitmapDataLength,
+				gdi->primary->bitmap->data, gdi->primary->bitmap->scanline, RFX_PIXEL_FORMAT_BGRA,
+				gdi->primary->bitmap->width, gdi->primary->bitmap->height,
+				surface_bits_command->destLeft, surface_bits_command->destTop);
+
+		DEBUG_GDI("num_rects %d", message->num_rects);
+
+		for (i = 0; i < message->num_rects; i++)
+		{
+			tx = surface_bits_command->destLeft + message->rects[i].x;
+			ty = surface_bits_command->destTop + message->rects[i].y;
+			tw = message->rects[i].width;
+			th = message->rects[i].height;
+
+			if (gdi_ClipCoords(gdi->primary->hdc, &tx, &ty, &tw, &th, NULL, NULL) != 0)
+				gdi_InvalidateRegion(gdi->primary->hdc, tx, ty, tw, th);
+		}
+
+		rfx_message_free(rfx_context, message);
+	}
+	else if (surface_bits_command->codecID == CODEC_ID_REMOTEFX)
 	{
 		message = rfx_process_message(rfx_context,
 				surface_bits_command->bitmapData, surface_bits_command->bitmapDataLength);
@@ -691,56 +740,71 @@ void gdi_surface_bits(rdpContext* context, SURFACE_BITS_COMMAND* surface_bits_co
 	{
 		nsc_context->width = surface_bits_command->width;
 		nsc_context->height = surface_bits_command->height;
-		nsc_process_message(nsc_context, surface_bits_command->bitmapData, surface_bits_command->bitmapDataLength);
+		if (!nsc_process_message(nsc_context, surface_bits_command->bitmapData, surface_bits_command->bitmapDataLength))
+			goto done;
+
 		gdi->image->bitmap->width = surface_bits_command->width;
 		gdi->image->bitmap->height = surface_bits_command->height;
 		gdi->image->bitmap->bitsPerPixel = surface_bits_command->bpp;
 		gdi->image->bitmap->bytesPerPixel = gdi->image->bitmap->bitsPerPixel / 8;
-		gdi->image->bitmap->data = (uint8*) xrealloc(gdi->image->bitmap->data, gdi->image->bitmap->width * gdi->image->bitmap->height * 4);
-		freerdp_image_flip(nsc_context->bmpdata, gdi->image->bitmap->data, gdi->image->bitmap->width, gdi->image->bitmap->height, 32);
-		gdi_BitBlt(gdi->primary->hdc, surface_bits_command->destLeft, surface_bits_command->destTop, surface_bits_command->width, surface_bits_command->height, gdi->image->hdc, 0, 0, GDI_SRCCOPY);
-		nsc_context_destroy(nsc_context);
+		gdi_surface_bits_blt_bottom_up(gdi, surface_bits_command, nsc_context->bmpdata);
 	}
 	else if (surface_bits_command->codecID == CODEC_ID_NONE)
 	{
+		int bytesPerPixel = (surface_bits_command->bpp + 7) / 8;
+		uint64 scanline = (uint64) surface_bits_command->width * bytesPerPixel;
+		uint64 size = (uint64) surface_bits_command->width * surface_bits_command->height * 4;
+
+		if (surface_bits_command->width == 0 || surface_bits_command->height == 0)
+			goto done;
+
+		/* the 32 bpp image has to fit the int sizes and strides used below */
+		if (size > 0x7FFFFFFF || bytesPerPixel > 4)
+		{
+			printf("gdi_surface_bits: uncompressed bitmap too large (%dx%d)\n",
+				surface_bits_command->width, surface_bits_command->height);
+			goto done;
+		}
+
+		if ((uint64) surface_bits_command->bitmapDataLength < scanline * surface_bits_command->height)
+		{
+			printf("gdi_surface_bits: short uncompressed bitmap (%d bytes)\n", surface_bits_command->bitmapDataLength);
+			goto done;
+		}
+
 		gdi->image->bitmap->width = surface_bits_command->width;
 		gdi->image->bitmap->height = surface_bits_command->height;
 		gdi->image->bitmap->bitsPerPixel = surface_bits_command->bpp;
 		gdi->image->bitmap->bytesPerPixel = gdi->image->bitmap->bitsPerPixel / 8;
 
-		gdi->image->bitmap->data = (uint8*) xrealloc(gdi->image->bitmap->data,
-				gdi->image->bitmap->width * gdi->image->bitmap->height * 4);
-
 		if ((surface_bits_command->bpp != 32) || gdi->clrconv->alpha)
 		{
-			uint8* temp_image;
+			/* turned upright while converting, by reading the rows bottom first */
+			gdi->image->bitmap->data = (uint8*) xrealloc(gdi->image->bitmap->data, (size_t) size);
 
-			freerdp_image_convert(surface_bits_command->bitmapData, gdi->image->bitmap->data,
-				gdi->image->bitmap->width, gdi->image->bitmap->height,
-				gdi->image->bitmap->bitsPerPixel, 32, gdi->clrconv);
-
-			surface_bits_command->bpp = 32;
-			surface_bits_command->bitmapData = gdi->image->bitmap->data;
+			if (!freerdp_image_convert_ex(surface_bits_command->bitmapData + (surface_bits_command->height - 1) * scanline,
+				-((int) scanline), gdi->image->bitmap->data, surface_bits_command->width * 4,
+				surface_bits_command->width, surface_bits_command->height,
+				surface_bits_command->bpp, 32, gdi->clrconv))
+			{
+				printf("gdi_surface_bits: unsupported uncompressed bitmap bpp %d\n", surface_bits_command->bpp);
+				goto done;
+			}
 
-			temp_image = (uint8*) xmalloc(gdi->image->bitmap->width * gdi->image->bitmap->height * 4);
-			freerdp_image_flip(gdi->image->bitmap->data, temp_image, gdi->image->bitmap->width, gdi->image->bitmap->height, 32);
-			xfree(gdi->image->bitmap->data);
-			gdi->image->bitmap->data = temp_image;
+			gdi_BitBlt(gdi->primary->hdc, surface_bits_command->destLeft, surface_bits_command->destTop,
+					surface_bits_command->width, surface_bits_command->height, gdi->image->hdc, 0, 0, GDI_SRCCOPY);
 		}
 		else
 		{
-			freerdp_image_flip(surface_bits_command->bitmapData, gdi->image->bitmap->data,
-					gdi->image->bitmap->width, gdi->image->bitmap->height, 32);
+			gdi_surface_bits_blt_bottom_up(gdi, surface_bits_command, surface_bits_command->bitmapData);
 		}
-
-		gdi_BitBlt(gdi->primary->hdc, surface_bits_command->destLeft, surface_bits_command->destTop,
-				surface_bits_command->width, surface_bits_command->height, gdi->image->hdc, 0, 0, GDI_SRCCOPY);
 	}
 	else
 	{
 		printf("Unsupported codecID %d\n", surface_bits_command->codecID);
 	}
 
+done:
 	if (tile_bitmap != NULL)
 		xfree(tile_bitmap);
 }
@@ -928,6 +992,7 @@ void gdi_free(freerdp* instance)
 		gdi_bitmap_free_ex(gdi->image);
 		gdi_DeleteDC(gdi->hdc);
 		rfx_context_free((RFX_CONTEXT*)gdi->rfx_context);
+		nsc_context_free((NSC_CONTEXT*)gdi->nsc_context);
 		free(gdi->clrconv);
 		free(gdi);
 	}
@@ -60,6 +60,12 @@ void gdi_Bitmap_New(rdpContext* context, rdpBitmap* bitmap)
 	{
 		gdi_bitmap->bitmap = gdi_CreateCompatibleBitmap(gdi->hdc, bitmap->width, bitmap->height);
 	}
+	else if (bitmap->bpp == gdi->dstBpp && bitmap->bpp != gdi->srcBpp)
+	{
+		/* decompressed to the final format already, take the buffer over */
+		gdi_bitmap->bitmap = gdi_CreateBitmap(bitmap->width, bitmap->height, gdi->dstBpp, bitmap->data);
+		bitmap->data = NULL;
+	}
 	else
 	{
 		gdi_bitmap->bitmap = gdi_create_bitmap(gdi, bitmap->width, bitmap->height, gdi->dstBpp, bitmap->data);
@@ -97,7 +103,8 @@ void gdi_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 		uint8* data, int width, int height, int bpp, int length,
 		tbool compressed, int codec_id)
 {
-	uint16 size;
+	int size;
+	int dst_bpp;
 	RFX_MESSAGE* msg;
 	uint8* src;
 	uint8* dst;
@@ -107,7 +114,22 @@ void gdi_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 	tbool status;
 	bitmapExtra be;
 
-	size = width * height * (bpp + 7) / 8;
+	gdi = context->gdi;
+	/* 15 bpp bitmaps come in at 16 for v2 bitmap cache */
+	if ((bpp == 16) && (gdi->srcBpp == 15))
+	{
+		bpp = 15;
+	}
+
+	/* interleaved bitmaps are decompressed straight to a 32 bpp surface */
+	dst_bpp = bpp;
+	if (compressed && (codec_id == CODEC_ID_NONE) && (gdi->dstBpp == 32) && !gdi->clrconv->invert &&
+		((bpp == 15) || (bpp == 16) || (bpp == 24)))
+	{
+		dst_bpp = 32;
+	}
+
+	size = width * height * (dst_bpp + 7) / 8;
 
 	if (bitmap->data == NULL)
 		bitmap->data = (uint8*) xmalloc(size);
@@ -120,7 +142,6 @@ void gdi_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 			printf("gdi_Bitmap_Decompress: nsc not done\n");
 			break;
 		case CODEC_ID_REMOTEFX:
-			gdi = context->gdi;
 			rfx_context_set_pixel_format(gdi->rfx_context, RDP_PIXEL_FORMAT_B8G8R8A8);
 			msg = rfx_process_message(gdi->rfx_context, data, length);
 			if (msg == NULL)
@@ -155,7 +176,7 @@ void gdi_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 			{
 				memset(&be, 0, sizeof(be));
 				be.temp = context->temp;
-				status = bitmap_decompress_ex(data, bitmap->data, width, height, length, bpp, bpp, &be);
+				status = bitmap_decompress_ex(data, bitmap->data, width, height, length, bpp, dst_bpp, &be);
 				if (status == false)
 				{
 					printf("gdi_Bitmap_Decompress: Bitmap Decompression Failed\n");
@@ -172,7 +193,7 @@ void gdi_Bitmap_Decompress(rdpContext* context, rdpBitmap* bitmap,
 	bitmap->height = height;
 	bitmap->compressed = false;
 	bitmap->length = size;
-	bitmap->bpp = bpp;
+	bitmap->bpp = dst_bpp;
 }
 
 void gdi_Bitmap_SetSurface(rdpContext* context, rdpBitmap* bitmap, tbool primary)
@@ -0,0 +1,92 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * CPU Feature Detection Utils
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <cpuid.h>
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <freerdp/utils/cpu.h>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define HAVE_CPUID
+static void cpuid(unsigned info, unsigned sub, unsigned* eax, unsigned* ebx, unsigned* ecx, unsigned* edx)
+{
+	/* cpuid.h takes care of preserving ebx for 32bit PIC code */
+	__cpuid_count(info, sub, *eax, *ebx, *ecx, *edx);
+}
+
+static uint32 xgetbv(unsigned index)
+{
+	unsigned eax, edx;
+
+	/* xgetbv, spelled out for assemblers that do not know it */
+	__asm volatile (".byte 0x0f, 0x01, 0xd0" : "=a" (eax), "=d" (edx) : "c" (index));
+
+	return eax;
+}
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#define HAVE_CPUID
+static void cpuid(unsigned info, unsigned sub, unsigned* eax, unsigned* ebx, unsigned* ecx, unsigned* edx)
+{
+	int a[4];
+	__cpuidex(a, info, sub);
+	*eax = a[0];
+	*ebx = a[1];
+	*ecx = a[2];
+	*edx = a[3];
+}
+
+static uint32 xgetbv(unsigned index)
+{
+	return (uint32) _xgetbv(index);
+}
+#endif
+
+/**
+ * Detect the SIMD instruction sets usable on this machine.
+ * Returns a combination of the CPU_* optimization flags from constants.h.
+ */
+
+uint32 freerdp_detect_cpu(void)
+{
+	uint32 cpu_opt = 0;
+#ifdef HAVE_CPUID
+	unsigned int max_leaf, eax, ebx, ecx, edx;
+
+	cpuid(0, 0, &max_leaf, &ebx, &ecx, &edx);
+
+	if (max_leaf < 1)
+		return 0;
+
+	cpuid(1, 0, &eax, &ebx, &ecx, &edx);
+
+	if (edx & (1 << 26))
+		cpu_opt |= CPU_SSE2;
+
+	/* AVX2 also needs OSXSAVE and an OS that saves the YMM registers (XCR0 bits 1 and 2) */
+	if ((max_leaf >= 7) && (ecx & (1 << 27)) && (ecx & (1 << 28)) && ((xgetbv(0) & 0x06) == 0x06))
+	{
+		cpuid(7, 0, &eax, &ebx, &ecx, &edx);
+
+		if (ebx & (1 << 5))
+			cpu_opt |= CPU_AVX2;
+	}
+#endif
+	return cpu_opt;
+}
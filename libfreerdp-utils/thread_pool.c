@@ -0,0 +1,277 @@
+/**
+ * FreeRDP: A Remote Desktop Protocol client.
+ * Thread Pool Utils
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#ifdef _MSC_VER
+#include <process.h>
+#endif
+#else
+#include <pthread.h>
+#include <semaphore.h>
+#endif
+
+#include <freerdp/utils/memory.h>
+#include <freerdp/utils/thread_pool.h>
+
+#ifdef _WIN32
+#define pool_thread_t HANDLE
+#define pool_lock_t CRITICAL_SECTION
+#define pool_sem_t HANDLE
+#else
+#define pool_thread_t pthread_t
+#define pool_lock_t pthread_mutex_t
+#define pool_sem_t sem_t
+#endif
+
+struct _pool_worker
+{
+	int index;
+	pool_thread_t thread;
+	freerdp_thread_pool* pool;
+};
+typedef struct _pool_worker pool_worker;
+
+struct _freerdp_thread_pool
+{
+	int size;
+	pool_worker* workers;
+
+	pool_lock_t lock;
+	pool_sem_t start;
+	pool_sem_t done;
+	boolean quit;
+
+	/* current batch, protected by lock */
+	freerdp_thread_pool_func func;
+	void* arg;
+	int count;
+	int next;
+};
+
+static void pool_lock(freerdp_thread_pool* pool)
+{
+#ifdef _WIN32
+	EnterCriticalSection(&pool->lock);
+#else
+	pthread_mutex_lock(&pool->lock);
+#endif
+}
+
+static void pool_unlock(freerdp_thread_pool* pool)
+{
+#ifdef _WIN32
+	LeaveCriticalSection(&pool->lock);
+#else
+	pthread_mutex_unlock(&pool->lock);
+#endif
+}
+
+static void pool_sem_post(pool_sem_t* sem)
+{
+#ifdef _WIN32
+	ReleaseSemaphore(*sem, 1, NULL);
+#else
+	sem_post(sem);
+#endif
+}
+
+static void pool_sem_wait(pool_sem_t* sem)
+{
+#ifdef _WIN32
+	WaitForSingleObject(*sem, INFINITE);
+#else
+	while (sem_wait(sem) != 0)
+		continue; /* EINTR */
+#endif
+}
+
+static void pool_process_jobs(freerdp_thread_pool* pool, int worker)
+{
+	int index;
+
+	while (1)
+	{
+		pool_lock(pool);
+		index = pool->next;
+		if (index < pool->count)
+			pool->next++;
+		pool_unlock(pool);
+
+		if (index >= pool->count)
+			break;
+
+		pool->func(pool->arg, worker, index);
+	}
+}
+
+#ifdef _WIN32
+static DWORD WINAPI pool_worker_main(LPVOID arg)
+#else
+static void* pool_worker_main(void* arg)
+#endif
+{
+	pool_worker* worker = (pool_worker*) arg;
+	freerdp_thread_pool* pool = worker->pool;
+
+	while (1)
+	{
+		pool_sem_wait(&pool->start);
+
+		if (pool->quit)
+			break;
+
+		pool_process_jobs(pool, worker->index);
+		pool_sem_post(&pool->done);
+	}
+
+	return 0;
+}
+
+/**
+ * Create a pool of worker threads.
+ * The thread calling freerdp_thread_pool_run() always takes part in the work,
+ * so a pool of size N processes jobs on up to N + 1 threads.
+ * @param size number of worker threads
+ */
+
+freerdp_thread_pool* freerdp_thread_pool_new(int size)
+{
+	int i;
+	freerdp_thread_pool* pool;
+
+	if (size < 0)
+		size = 0;
+
+	pool = xnew(freerdp_thread_pool);
+	pool->size = size;
+	pool->workers = xnew0(pool_worker, size + 1);
+
+#ifdef _WIN32
+	InitializeCriticalSection(&pool->lock);
+	pool->start = CreateSemaphore(NULL, 0, size + 1, NULL);
+	pool->done = CreateSemaphore(NULL, 0, size + 1, NULL);
+#else
+	pthread_mutex_init(&pool->lock, 0);
+	sem_init(&pool->start, 0, 0);
+	sem_init(&pool->done, 0, 0);
+#endif
+
+	for (i = 0; i < size; i++)
+	{
+		pool->workers[i].index = i;
+		pool->workers[i].pool = pool;
+
+#ifdef _WIN32
+		pool->workers[i].thread = CreateThread(NULL, 0, pool_worker_main, &pool->workers[i], 0, NULL);
+#else
+		if (pthread_create(&pool->workers[i].thread, 0, pool_worker_main, &pool->workers[i]) != 0)
+		{
+			printf("freerdp_thread_pool_new: failed to create worker %d\n", i);
+			pool->size = i;
+			break;
+		}
+#endif
+	}
+
+	return pool;
+}
+
+void freerdp_thread_pool_free(freerdp_thread_pool* pool)
+{
+	int i;
+
+	if (pool == NULL)
+		return;
+
+	pool->quit = true;
+
+	for (i = 0; i < pool->size; i++)
+		pool_sem_post(&pool->start);
+
+	for (i = 0; i < pool->size; i++)
+	{
+#ifdef _WIN32
+		WaitForSingleObject(pool->workers[i].thread, INFINITE);
+		CloseHandle(pool->workers[i].thread);
+#else
+		pthread_join(pool->workers[i].thread, NULL);
+#endif
+	}
+
+#ifdef _WIN32
+	DeleteCriticalSection(&pool->lock);
+	CloseHandle(pool->start);
+	CloseHandle(pool->done);
+#else
+	pthread_mutex_destroy(&pool->lock);
+	sem_destroy(&pool->start);
+	sem_destroy(&pool->done);
+#endif
+
+	xfree(pool->workers);
+	xfree(pool);
+}
+
+int freerdp_thread_pool_get_size(freerdp_thread_pool* pool)
+{
+	return (pool != NULL) ? pool->size : 0;
+}
+
+/**
+ * Run func(arg, worker, index) for every index in [0, count) and return
+ * once all of them have completed. Jobs are handed out in index order.
+ * Only one batch can be in flight per pool at a time.
+ */
+
+void freerdp_thread_pool_run(freerdp_thread_pool* pool, freerdp_thread_pool_func func, void* arg, int count)
+{
+	int i;
+	int wake;
+
+	if (count < 1)
+		return;
+
+	if (pool == NULL || pool->size < 1 || count == 1)
+	{
+		for (i = 0; i < count; i++)
+			func(arg, (pool != NULL) ? pool->size : 0, i);
+		return;
+	}
+
+	pool_lock(pool);
+	pool->func = func;
+	pool->arg = arg;
+	pool->count = count;
+	pool->next = 0;
+	pool_unlock(pool);
+
+	/* the calling thread takes one share of the jobs itself */
+	wake = (count - 1 < pool->size) ? count - 1 : pool->size;
+
+	for (i = 0; i < wake; i++)
+		pool_sem_post(&pool->start);
+
+	pool_process_jobs(pool, pool->size);
+
+	for (i = 0; i < wake; i++)
+		pool_sem_wait(&pool->done);
+}
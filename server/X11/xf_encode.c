@@ -71,43 +71,98 @@ void xf_xdamage_subtract_region(xfPeerContext* xfp, int x, int y, int width, int
 #endif
 }
 
-void* xf_frame_rate_thread(void* param)
+/**
+ * Push the frame tick that makes xf_peer_check_fds() send what changed
+ * since the previous one.
+ */
+boolean xf_frame_rate_tick(freerdp_peer* client, void* param)
 {
-	xfInfo* xfi;
 	xfEvent* event;
+	xfPeerContext* xfp = (xfPeerContext*) client->context;
+
+	event = xf_event_new(XF_EVENT_TYPE_FRAME_TICK);
+	xf_event_push(xfp->event_queue, (xfEvent*) event);
+
+	return true;
+}
+
+void* xf_frame_rate_thread(void* param)
+{
 	xfPeerContext* xfp;
 	freerdp_peer* client;
 	uint32 wait_interval;
 
 	client = (freerdp_peer*) param;
 	xfp = (xfPeerContext*) client->context;
-	xfi = xfp->info;
 
 	wait_interval = 1000000 / xfp->fps;
 
 	while (1)
 	{
-		event = xf_event_new(XF_EVENT_TYPE_FRAME_TICK);
-		xf_event_push(xfp->event_queue, (xfEvent*) event);
+		xf_frame_rate_tick(client, NULL);
 		freerdp_usleep(wait_interval);
 	}
 }
 
+/**
+ * Turn the X events that are pending into region events for the peer.
+ */
+void xf_process_x_events(freerdp_peer* client)
+{
+	xfInfo* xfi;
+	XEvent xevent;
+	int pending_events;
+	xfPeerContext* xfp;
+	int x, y, width, height;
+	XDamageNotifyEvent* notify;
+	xfEventRegion* event_region;
+
+	xfp = (xfPeerContext*) client->context;
+	xfi = xfp->info;
+
+	while (1)
+	{
+		pthread_mutex_lock(&(xfp->mutex));
+		pending_events = XPending(xfi->display);
+
+		if (pending_events > 0)
+		{
+			memset(&xevent, 0, sizeof(xevent));
+			XNextEvent(xfi->display, &xevent);
+		}
+
+		pthread_mutex_unlock(&(xfp->mutex));
+
+		if (pending_events < 1)
+			break;
+
+		if (xevent.type == xfi->xdamage_notify_event)
+		{
+			notify = (XDamageNotifyEvent*) &xevent;
+
+			x = notify->area.x;
+			y = notify->area.y;
+			width = notify->area.width;
+			height = notify->area.height;
+
+			xf_xdamage_subtract_region(xfp, x, y, width, height);
+
+			event_region = xf_event_region_new(x, y, width, height);
+			xf_event_push(xfp->event_queue, (xfEvent*) event_region);
+		}
+	}
+}
+
 void* xf_monitor_updates(void* param)
 {
 	int fds;
 	xfInfo* xfi;
-	XEvent xevent;
 	fd_set rfds_set;
 	int select_status;
-	int pending_events;
 	xfPeerContext* xfp;
 	freerdp_peer* client;
 	uint32 wait_interval;
 	struct timeval timeout;
-	int x, y, width, height;
-	XDamageNotifyEvent* notify;
-	xfEventRegion* event_region;
 
 	client = (freerdp_peer*) param;
 	xfp = (xfPeerContext*) client->context;
@@ -139,32 +194,7 @@ void* xf_monitor_updates(void* param)
 			//printf("select timeout\n");
 		}
 
-		pthread_mutex_lock(&(xfp->mutex));
-		pending_events = XPending(xfi->display);
-		pthread_mutex_unlock(&(xfp->mutex));
-
-		if (pending_events > 0)
-		{
-			pthread_mutex_lock(&(xfp->mutex));
-			memset(&xevent, 0, sizeof(xevent));
-			XNextEvent(xfi->display, &xevent);
-			pthread_mutex_unlock(&(xfp->mutex));
-
-			if (xevent.type == xfi->xdamage_notify_event)
-			{
-				notify = (XDamageNotifyEvent*) &xevent;
-
-				x = notify->area.x;
-				y = notify->area.y;
-				width = notify->area.width;
-				height = notify->area.height;
-
-				xf_xdamage_subtract_region(xfp, x, y, width, height);
-
-				event_region = xf_event_region_new(x, y, width, height);
-				xf_event_push(xfp->event_queue, (xfEvent*) event_region);
-			}
-		}
+		xf_process_x_events(client);
 	}
 
 	return NULL;
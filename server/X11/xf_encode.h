@@ -27,6 +27,8 @@
 
 XImage* xf_snapshot(xfPeerContext* xfp, int x, int y, int width, int height);
 void xf_xdamage_subtract_region(xfPeerContext* xfp, int x, int y, int width, int height);
+boolean xf_frame_rate_tick(freerdp_peer* client, void* param);
+void xf_process_x_events(freerdp_peer* client);
 void* xf_monitor_updates(void* param);
 
 #endif /* __XF_ENCODE_H */
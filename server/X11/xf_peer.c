@@ -36,6 +36,7 @@
 
 extern char* xf_pcap_file;
 extern tbool xf_pcap_dump_realtime;
+extern int xf_encoder_threads;
 
 #include "xf_event.h"
 #include "xf_input.h"
@@ -43,6 +44,9 @@ extern tbool xf_pcap_dump_realtime;
 
 #include "xf_peer.h"
 
+/* frames are skipped while more than this is waiting for the client */
+#define XF_PEER_MAX_QUEUED_BYTES 0x100000
+
 #ifdef WITH_XDAMAGE
 
 void xf_xdamage_init(xfInfo* xfi)
@@ -264,6 +268,15 @@ void xf_peer_context_new(freerdp_peer* client, xfPeerContext* context)
 
 	rfx_context_set_pixel_format(context->rfx_context, RFX_PIXEL_FORMAT_BGRA);
 
+	/*
+	 * every peer gets its own encoder threads on top of the runtime's, so
+	 * frames are encoded on the session thread unless asked otherwise
+	 */
+	rfx_context_set_thread_count(context->rfx_context, xf_encoder_threads);
+
+	/* the XShm path always encodes the whole framebuffer, so unchanged tiles can be skipped */
+	rfx_context_set_tile_cache(context->rfx_context, context->info->use_xshm);
+
 	context->s = stream_new(65536);
 }
 
@@ -307,12 +320,40 @@ STREAM* xf_peer_stream_init(xfPeerContext* context)
 	return context->s;
 }
 
+static boolean xf_peer_get_x_fds(void* object, void** rfds, int* rcount)
+{
+	freerdp_peer* client = (freerdp_peer*) object;
+	xfPeerContext* xfp = (xfPeerContext*) client->context;
+
+	rfds[*rcount] = (void*)(long) xfp->info->xfds;
+	(*rcount)++;
+
+	return true;
+}
+
+static boolean xf_peer_check_x_fds(void* object)
+{
+	xf_process_x_events((freerdp_peer*) object);
+
+	return true;
+}
+
 void xf_peer_live_rfx(freerdp_peer* client)
 {
 	xfPeerContext* xfp = (xfPeerContext*) client->context;
 
-	if (xfp->activations == 1)
-		pthread_create(&(xfp->thread), 0, xf_monitor_updates, (void*) client);
+	if (xfp->activations != 1)
+		return;
+
+	if (xfp->runtime != NULL)
+	{
+		/* the X connection and the frame ticks are served on the worker of the peer */
+		freerdp_runtime_add_source(xfp->runtime, client, client, xf_peer_get_x_fds, xf_peer_check_x_fds);
+		freerdp_runtime_add_timer(xfp->runtime, client, 1000 / xfp->fps, xf_frame_rate_tick, NULL);
+		return;
+	}
+
+	pthread_create(&(xfp->thread), 0, xf_monitor_updates, (void*) client);
 }
 
 static tbool xf_peer_sleep_tsdiff(uint32 *old_sec, uint32 *old_usec, uint32 new_sec, uint32 new_usec)
@@ -393,7 +434,6 @@ void xf_peer_dump_rfx(freerdp_peer* client)
 void xf_peer_rfx_update(freerdp_peer* client, int x, int y, int width, int height)
 {
 	STREAM* s;
-	uint8* data;
 	xfInfo* xfi;
 	RFX_RECT rect;
 	XImage* image;
@@ -413,11 +453,12 @@ void xf_peer_rfx_update(freerdp_peer* client, int x, int y, int width, int heigh
 
 	if (xfi->use_xshm)
 	{
-		width = x + width;
-		height = y + height;
-		x = 0;
-		y = 0;
-
+		/**
+		 * The shared framebuffer image is always encoded from (0,0), so that
+		 * the encoder tile cache sees every tile at the same position and
+		 * only sends the tiles under the damaged rect which really changed,
+		 * each one whole.
+		 */
 		rect.x = x;
 		rect.y = y;
 		rect.width = width;
@@ -425,16 +466,20 @@ void xf_peer_rfx_update(freerdp_peer* client, int x, int y, int width, int heigh
 
 		image = xf_snapshot(xfp, x, y, width, height);
 
-		data = (uint8*) image->data;
-		data = &data[(y * image->bytes_per_line) + (x * image->bits_per_pixel)];
+		width = x + width;
+		height = y + height;
 
-		rfx_compose_message(xfp->rfx_context, s, &rect, 1, data,
+		rfx_compose_message(xfp->rfx_context, s, &rect, 1, (uint8*) image->data,
 				width, height, image->bytes_per_line);
 
-		cmd->destLeft = x;
-		cmd->destTop = y;
-		cmd->destRight = x + width;
-		cmd->destBottom = y + height;
+		/* no tile changed */
+		if (stream_get_length(s) == 0)
+			return;
+
+		cmd->destLeft = 0;
+		cmd->destTop = 0;
+		cmd->destRight = width;
+		cmd->destBottom = height;
 	}
 	else
 	{
@@ -507,6 +552,13 @@ tbool xf_peer_check_fds(freerdp_peer* client)
 			event = xf_event_pop(xfp->event_queue);
 			invalid_region = xfp->hdc->hwnd->invalid;
 
+			/* the client is behind, keep the damage for a later tick */
+			if (freerdp_peer_get_queued_bytes(client) > XF_PEER_MAX_QUEUED_BYTES)
+			{
+				xf_event_free(event);
+				return true;
+			}
+
 			if (invalid_region->null == false)
 			{
 				xf_peer_rfx_update(client, invalid_region->x, invalid_region->y,
@@ -589,19 +641,10 @@ tbool xf_peer_activate(freerdp_peer* client)
 	return true;
 }
 
-void* xf_peer_main_loop(void* arg)
+static void xf_peer_setup(freerdp_peer* client)
 {
-	int i;
-	int fds;
-	int max_fds;
-	int rcount;
-	void* rfds[32];
-	fd_set rfds_set;
 	rdpSettings* settings;
 	char* server_file_path;
-	freerdp_peer* client = (freerdp_peer*) arg;
-
-	memset(rfds, 0, sizeof(rfds));
 
 	printf("We've got a client %s\n", client->hostname);
 
@@ -635,6 +678,21 @@ void* xf_peer_main_loop(void* arg)
 	xf_input_register_callbacks(client->input);
 
 	client->Initialize(client);
+}
+
+void* xf_peer_main_loop(void* arg)
+{
+	int i;
+	int fds;
+	int max_fds;
+	int rcount;
+	void* rfds[32];
+	fd_set rfds_set;
+	freerdp_peer* client = (freerdp_peer*) arg;
+
+	memset(rfds, 0, sizeof(rfds));
+
+	xf_peer_setup(client);
 
 	while (1)
 	{
@@ -704,6 +762,21 @@ void* xf_peer_main_loop(void* arg)
 void xf_peer_accepted(freerdp_listener* instance, freerdp_peer* client)
 {
 	pthread_t th;
+	xfPeerContext* xfp;
+
+	if (instance->runtime != NULL)
+	{
+		/* the listener hands the peer to the runtime once this returns */
+		xf_peer_setup(client);
+
+		xfp = (xfPeerContext*) client->context;
+		xfp->runtime = (freerdp_runtime*) instance->runtime;
+
+		freerdp_runtime_add_source(xfp->runtime, client, client,
+			(psRuntimeGetFileDescriptor) xf_peer_get_fds, (psRuntimeCheckFileDescriptor) xf_peer_check_fds);
+
+		return;
+	}
 
 	pthread_create(&th, 0, xf_peer_main_loop, client);
 	pthread_detach(th);
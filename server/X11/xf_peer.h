@@ -25,6 +25,7 @@
 #include <freerdp/gdi/region.h>
 #include <freerdp/codec/rfx.h>
 #include <freerdp/listener.h>
+#include <freerdp/runtime.h>
 #include <freerdp/utils/stream.h>
 #include <freerdp/utils/stopwatch.h>
 
@@ -47,6 +48,7 @@ struct xf_peer_context
 	RFX_CONTEXT* rfx_context;
 	xfEventQueue* event_queue;
 	pthread_t frame_rate_thread;
+	freerdp_runtime* runtime;
 };
 
 void xf_peer_accepted(freerdp_listener* instance, freerdp_peer* client);
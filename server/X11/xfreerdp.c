@@ -25,6 +25,7 @@
 #include <X11/Xutil.h>
 #include <sys/select.h>
 #include <sys/signal.h>
+#include <unistd.h>
 
 #include <freerdp/utils/memory.h>
 
@@ -33,6 +34,7 @@
 
 char* xf_pcap_file = NULL;
 tbool xf_pcap_dump_realtime = true;
+int xf_encoder_threads = 1;
 
 void xf_server_main_loop(freerdp_listener* instance)
 {
@@ -96,7 +98,9 @@ void xf_server_main_loop(freerdp_listener* instance)
 
 int main(int argc, char* argv[])
 {
+	int i;
 	freerdp_listener* instance;
+	freerdp_runtime* runtime;
 
 	/* ignore SIGPIPE, otherwise an SSL_write failure could crash the server */
 	signal(SIGPIPE, SIG_IGN);
@@ -104,11 +108,19 @@ int main(int argc, char* argv[])
 	instance = freerdp_listener_new();
 	instance->PeerAccepted = xf_peer_accepted;
 
-	if (argc > 1)
-		xf_pcap_file = argv[1];
+	/* serve the clients on one thread per CPU, or on a thread per client where the runtime is not available */
+	runtime = freerdp_runtime_new(sysconf(_SC_NPROCESSORS_ONLN));
+	instance->runtime = runtime;
 
-	if (argc > 2 && !strcmp(argv[2], "--fast"))
-		xf_pcap_dump_realtime = false;
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "--fast"))
+			xf_pcap_dump_realtime = false;
+		else if (!strcmp(argv[i], "--encoder-threads") && i + 1 < argc)
+			xf_encoder_threads = atoi(argv[++i]);
+		else if (xf_pcap_file == NULL)
+			xf_pcap_file = argv[i];
+	}
 
 	/* Open the server socket and start listening. */
 	if (instance->Open(instance, NULL, 3389))
@@ -118,6 +130,7 @@ int main(int argc, char* argv[])
 	}
 
 	freerdp_listener_free(instance);
+	freerdp_runtime_free(runtime);
 
 	return 0;
 }
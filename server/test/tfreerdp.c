@@ -24,6 +24,7 @@
 #include <errno.h>
 #include <pthread.h>
 #include <signal.h>
+#include <unistd.h>
 #include <sys/time.h>
 #include <freerdp/constants.h>
 #include <freerdp/utils/sleep.h>
@@ -31,6 +32,7 @@
 #include <freerdp/utils/thread.h>
 #include <freerdp/codec/rfx.h>
 #include <freerdp/listener.h>
+#include <freerdp/runtime.h>
 #include <freerdp/channels/wtsvc.h>
 
 static char* test_pcap_file = NULL;
@@ -510,19 +512,8 @@ void tf_peer_extended_mouse_event(rdpInput* input, uint16 flags, uint16 x, uint1
 	printf("Client sent an extended mouse event (flags:0x%X pos:%d,%d)\n", flags, x, y);
 }
 
-static void* test_peer_mainloop(void* arg)
+static void test_peer_setup(freerdp_peer* client)
 {
-	int i;
-	int fds;
-	int max_fds;
-	int rcount;
-	void* rfds[32];
-	fd_set rfds_set;
-	testPeerContext* context;
-	freerdp_peer* client = (freerdp_peer*) arg;
-
-	memset(rfds, 0, sizeof(rfds));
-
 	test_peer_init(client);
 
 	/* Initialize the real server settings here */
@@ -541,9 +532,25 @@ static void* test_peer_mainloop(void* arg)
 	client->input->ExtendedMouseEvent = tf_peer_extended_mouse_event;
 
 	client->Initialize(client);
-	context = (testPeerContext*) client->context;
 
 	printf("We've got a client %s\n", client->hostname);
+}
+
+static void* test_peer_mainloop(void* arg)
+{
+	int i;
+	int fds;
+	int max_fds;
+	int rcount;
+	void* rfds[32];
+	fd_set rfds_set;
+	testPeerContext* context;
+	freerdp_peer* client = (freerdp_peer*) arg;
+
+	memset(rfds, 0, sizeof(rfds));
+
+	test_peer_setup(client);
+	context = (testPeerContext*) client->context;
 
 	while (1)
 	{
@@ -600,9 +607,34 @@ static void* test_peer_mainloop(void* arg)
 	return NULL;
 }
 
+static boolean test_vcm_get_fds(void* object, void** rfds, int* rcount)
+{
+	WTSVirtualChannelManagerGetFileDescriptor((WTSVirtualChannelManager*) object, rfds, rcount);
+
+	return true;
+}
+
+static boolean test_vcm_check_fds(void* object)
+{
+	return WTSVirtualChannelManagerCheckFileDescriptor((WTSVirtualChannelManager*) object);
+}
+
 static void test_peer_accepted(freerdp_listener* instance, freerdp_peer* client)
 {
 	pthread_t th;
+	testPeerContext* context;
+
+	if (instance->runtime != NULL)
+	{
+		/* the listener hands the peer to the runtime once this returns */
+		test_peer_setup(client);
+		context = (testPeerContext*) client->context;
+
+		freerdp_runtime_add_source((freerdp_runtime*) instance->runtime, client, context->vcm,
+			test_vcm_get_fds, test_vcm_check_fds);
+
+		return;
+	}
 
 	pthread_create(&th, 0, test_peer_mainloop, client);
 	pthread_detach(th);
@@ -671,6 +703,7 @@ static void test_server_mainloop(freerdp_listener* instance)
 int main(int argc, char* argv[])
 {
 	freerdp_listener* instance;
+	freerdp_runtime* runtime;
 
 	/* Ignore SIGPIPE, otherwise an SSL_write failure could crash your server */
 	signal(SIGPIPE, SIG_IGN);
@@ -679,6 +712,10 @@ int main(int argc, char* argv[])
 
 	instance->PeerAccepted = test_peer_accepted;
 
+	/* Serve the clients on one thread per CPU, or on a thread per client where the runtime is not available. */
+	runtime = freerdp_runtime_new(sysconf(_SC_NPROCESSORS_ONLN));
+	instance->runtime = runtime;
+
 	if (argc > 1)
 		test_pcap_file = argv[1];
 
@@ -693,6 +730,7 @@ int main(int argc, char* argv[])
 	}
 
 	freerdp_listener_free(instance);
+	freerdp_runtime_free(runtime);
 
 	return 0;
 }